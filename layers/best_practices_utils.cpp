@@ -1128,7 +1128,7 @@ bool BestPractices::PreCallValidateCreateComputePipelines(VkDevice device, VkPip
 
         if (IsExtEnabled(device_extensions.vk_khr_maintenance4)) {
             auto module_state = Get<SHADER_MODULE_STATE>(createInfo.stage.module);
-            for (const auto& builtin : module_state->static_data_.builtin_decoration_list) {
+            for (const auto& builtin : module_state->static_data_->builtin_decoration_list) {
                 if (builtin.builtin == spv::BuiltInWorkgroupSize) {
                     skip |= LogWarning(device, kVUID_BestPractices_SpirvDeprecated_WorkgroupSize,
                                        "vkCreateComputePipelines(): pCreateInfos[ %" PRIu32
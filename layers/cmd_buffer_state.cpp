@@ -437,6 +437,11 @@ void CMD_BUFFER_STATE::ResetPushConstantDataIfIncompatible(const PIPELINE_LAYOUT
 }
 
 void CMD_BUFFER_STATE::Destroy() {
+    // Destroy() is called again by the destructor, which may run long after the command buffer was freed, once the last
+    // reference is dropped. By then the handle may name a new command buffer, or the device may be gone.
+    if (Destroyed()) {
+        return;
+    }
     // Allow any derived class to clean up command buffer state
     if (dev_data->command_buffer_reset_callback) {
         (*dev_data->command_buffer_reset_callback)(commandBuffer());
@@ -3929,46 +3929,30 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
             cb_node->SetImageViewInitialLayout(iv_state, layout);
         });
 
+    if ((validation_worker_threads > 0 || deferred_shader_validation) && !validation_thread_pool) {
+        // Deferred shader validation needs a worker even if validation_worker_threads is 0
+        validation_thread_pool.reset(new ValidationThreadPool(std::max(validation_worker_threads, 1u)));
+    }
+
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
-        auto tmp_path = GetEnvironment("XDG_CACHE_HOME");
-        if (!tmp_path.size()) {
-            auto cachepath = GetEnvironment("HOME") + "/.cache";
-            struct stat info;
-            if (stat(cachepath.c_str(), &info) == 0) {
-                if ((info.st_mode & S_IFMT) == S_IFDIR) {
-                    tmp_path = cachepath;
-                }
-            }
-        }
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TMPDIR");
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TMP");
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TEMP");
-        if (!tmp_path.size()) tmp_path = "/tmp";
-        validation_cache_path = tmp_path + "/shader_validation_cache";
-#if defined(__linux__) || defined(__FreeBSD__)
-        validation_cache_path += "-" + std::to_string(getuid());
-#endif
-        validation_cache_path += ".bin";
-
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
+        validation_cache_path = GetCacheFilePath("shader_validation_cache");
+        spirv_static_data_cache_path = GetCacheFilePath("shader_static_data_cache");
 
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
+        if (!SpirvStaticDataCache::Get().Load(spirv_static_data_cache_path)) {
             LogInfo(device, "UNASSIGNED-cache-file-error",
-                    "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
+                    "Cannot load shader module cache at %s (it may not exist yet or be from another version)",
+                    spirv_static_data_cache_path.c_str());
         }
 
-        VkValidationCacheCreateInfoEXT cacheCreateInfo = {};
-        cacheCreateInfo.sType = VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT;
-        cacheCreateInfo.pNext = NULL;
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
-        cacheCreateInfo.flags = 0;
-        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
+        // The file is used in place where possible, so lookups need no parsing at startup
+        bool loaded = false;
+        core_validation_cache = ValidationCache::CreateFromFile(validation_cache_path, &loaded);
+        if (!loaded) {
+            LogInfo(device, "UNASSIGNED-cache-file-error",
+                    "Cannot open shader validation cache at %s for reading (it may not exist yet or be from another version)",
+                    validation_cache_path.c_str());
+        }
     }
 }
 
@@ -3977,6 +3961,14 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
 
+    // Finishes any deferred shader validation, which may still log errors and add to core_validation_cache
+    validation_thread_pool.reset();
+
+    if (spirv_static_data_cache_path.size() > 0 && !SpirvStaticDataCache::Get().Save(spirv_static_data_cache_path)) {
+        LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot write shader module cache at %s",
+                spirv_static_data_cache_path.c_str());
+    }
+
     if (core_validation_cache) {
         size_t validation_cache_size = 0;
         void *validation_cache_data = nullptr;
@@ -3998,11 +3990,8 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
         }
 
         if (validation_cache_path.size() > 0) {
-            FILE *write_file = fopen(validation_cache_path.c_str(), "wb");
-            if (write_file) {
-                fwrite(validation_cache_data, sizeof(char), validation_cache_size, write_file);
-                fclose(write_file);
-            } else {
+            // The old file may still be mapped by other devices' caches, so it is replaced rather than rewritten
+            if (!ReplaceCacheFile(validation_cache_path, validation_cache_data, validation_cache_size)) {
                 LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot open shader validation cache at %s for writing",
                         validation_cache_path.c_str());
             }
@@ -6515,9 +6504,7 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                      pPipelines, cgpl_state_data);
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
 
-    for (uint32_t i = 0; i < count; i++) {
-        skip |= ValidatePipeline(cgpl_state->pipe_state, i);
-    }
+    skip |= ValidateInParallel(count, [&](uint32_t i) { return ValidatePipeline(cgpl_state->pipe_state, i); });
 
     if (IsExtEnabled(device_extensions.vk_ext_vertex_attribute_divisor)) {
         skip |= ValidatePipelineVertexDivisors(cgpl_state->pipe_state, count, pCreateInfos);
@@ -6585,12 +6572,13 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                                                                     pPipelines, ccpl_state_data);
 
     auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= ValidateInParallel(count, [&](uint32_t i) {
         // TODO: Add Compute Pipeline Verification
-        skip |= ValidateComputePipelineShaderState(ccpl_state->pipe_state[i].get());
-        skip |= ValidatePipelineCacheControlFlags(pCreateInfos->flags, i, "vkCreateComputePipelines",
-                                                  "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
-    }
+        bool pipeline_skip = ValidateComputePipelineShaderState(ccpl_state->pipe_state[i].get());
+        pipeline_skip |= ValidatePipelineCacheControlFlags(pCreateInfos->flags, i, "vkCreateComputePipelines",
+                                                           "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
+        return pipeline_skip;
+    });
     return skip;
 }
 
@@ -175,6 +175,11 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    // Where SpirvStaticDataCache is persisted, empty if shader validation caching is disabled
+    std::string spirv_static_data_cache_path;
+    // Only created if validation_worker_threads or deferred_shader_validation is set, see ValidateInParallel() and
+    // PreCallValidateCreateShaderModule()
+    std::unique_ptr<ValidationThreadPool> validation_thread_pool;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
@@ -199,6 +204,33 @@ class CoreChecks : public ValidationStateTracker {
     void StoreMemRanges(VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size);
     bool ValidateIdleDescriptorSet(VkDescriptorSet set, const char* func_str) const;
     bool ValidatePipeline(std::vector<std::shared_ptr<PIPELINE_STATE>> const& pipelines, int pipe_index) const;
+
+    // Returns the OR of validate(i) for every i in [0, count). If there is a validation_thread_pool, validate(i) is first
+    // run for every index across its workers with logging captured; the indices that have nothing to report keep that
+    // result, and the others are validated again in index order on the calling thread without capture. The messages,
+    // duplicate counts and Log*() return values (and any early return based on them) are thus those of a serial loop.
+    // validate must only read state that is stable for the duration of the call. Callees that write shared state must
+    // synchronize it themselves, e.g. ValidationCache takes its own lock.
+    template <typename Validate>
+    bool ValidateInParallel(uint32_t count, const Validate& validate) const {
+        bool skip = false;
+        if (!validation_thread_pool || validation_worker_threads == 0 || count < 2) {
+            for (uint32_t i = 0; i < count; ++i) {
+                skip |= validate(i);
+            }
+            return skip;
+        }
+        std::vector<CapturedLogMessages> captured(count);
+        std::vector<uint8_t> results(count, 0);
+        validation_thread_pool->ParallelFor(count, [&](size_t i) {
+            LogCaptureScope capture(&captured[i]);
+            results[i] = validate(static_cast<uint32_t>(i)) ? 1 : 0;
+        });
+        for (uint32_t i = 0; i < count; ++i) {
+            skip |= (captured[i].count == 0) ? (results[i] != 0) : validate(i);
+        }
+        return skip;
+    }
     bool ValidImageBufferQueue(const CMD_BUFFER_STATE* cb_node, const VulkanTypedHandle& object, uint32_t queueFamilyIndex,
                                uint32_t count, const uint32_t* indices) const;
     bool ValidateFenceForSubmit(const FENCE_STATE* pFence, const char* inflight_vuid, const char* retired_vuid,
@@ -543,26 +575,31 @@ class CoreChecks : public ValidationStateTracker {
 
     // Validate contents of a CopyUpdate
     using DescriptorSet = cvdescriptorset::DescriptorSet;
-    bool ValidateCopyUpdate(const VkCopyDescriptorSet* update, const DescriptorSet* dst_set, const DescriptorSet* src_set,
-                            const char* func_name, std::string* error_code, std::string* error_msg) const;
-    bool VerifyCopyUpdateContents(const VkCopyDescriptorSet* update, const DescriptorSet* src_set, VkDescriptorType src_type,
-                                  uint32_t src_index, const DescriptorSet* dst_set, VkDescriptorType dst_type, uint32_t dst_index,
-                                  const char* func_name, std::string* error_code, std::string* error_msg) const;
+    // The update validation helpers borrow state objects, which stay valid for the lifetime of the caller's EpochGuard
+    bool ValidateCopyUpdate(const EpochGuard& epoch, const VkCopyDescriptorSet* update, const DescriptorSet* dst_set,
+                            const DescriptorSet* src_set, const char* func_name, std::string* error_code,
+                            std::string* error_msg) const;
+    bool VerifyCopyUpdateContents(const EpochGuard& epoch, const VkCopyDescriptorSet* update, const DescriptorSet* src_set,
+                                  VkDescriptorType src_type, uint32_t src_index, const DescriptorSet* dst_set,
+                                  VkDescriptorType dst_type, uint32_t dst_index, const char* func_name, std::string* error_code,
+                                  std::string* error_msg) const;
     // Validate contents of a WriteUpdate
-    bool ValidateWriteUpdate(const DescriptorSet* descriptor_set, const VkWriteDescriptorSet* update, const char* func_name,
-                             std::string* error_code, std::string* error_msg, bool push) const;
-    bool VerifyWriteUpdateContents(const DescriptorSet* dest_set, const VkWriteDescriptorSet* update, const uint32_t index,
-                                   const char* func_name, std::string* error_code, std::string* error_msg, bool push) const;
+    bool ValidateWriteUpdate(const EpochGuard& epoch, const DescriptorSet* descriptor_set, const VkWriteDescriptorSet* update,
+                             const char* func_name, std::string* error_code, std::string* error_msg, bool push) const;
+    bool VerifyWriteUpdateContents(const EpochGuard& epoch, const DescriptorSet* dest_set, const VkWriteDescriptorSet* update,
+                                   const uint32_t index, const char* func_name, std::string* error_code, std::string* error_msg,
+                                   bool push) const;
     // Shared helper functions - These are useful because the shared sampler image descriptor type
     //  performs common functions with both sampler and image descriptors so they can share their common functions
-    bool ValidateImageUpdate(VkImageView, VkImageLayout, VkDescriptorType, const char* func_name, std::string*, std::string*) const;
+    bool ValidateImageUpdate(const EpochGuard& epoch, VkImageView, VkImageLayout, VkDescriptorType, const char* func_name,
+                             std::string*, std::string*) const;
     // Validate contents of a push descriptor update
     bool ValidatePushDescriptorsUpdate(const DescriptorSet* push_set, uint32_t write_count, const VkWriteDescriptorSet* p_wds,
                                        const char* func_name) const;
     // Descriptor Set Validation Functions
     bool ValidateSampler(VkSampler) const;
-    bool ValidateBufferUpdate(VkDescriptorBufferInfo const* buffer_info, VkDescriptorType type, const char* func_name,
-                              std::string* error_code, std::string* error_msg) const;
+    bool ValidateBufferUpdate(const EpochGuard& epoch, VkDescriptorBufferInfo const* buffer_info, VkDescriptorType type,
+                              const char* func_name, std::string* error_code, std::string* error_msg) const;
     template <typename T>
     bool ValidateAccelerationStructureUpdate(T acc, const char* func_name, std::string* error_code, std::string* error_msg) const;
     bool ValidateUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet, const UPDATE_TEMPLATE_STATE* template_state,
@@ -583,7 +620,10 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateRayTracingPipeline(PIPELINE_STATE* pipeline, const safe_VkRayTracingPipelineCreateInfoCommon& create_info,
                                     VkPipelineCreateFlags flags, bool isKHR) const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
-                                           const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const override;
+                                           const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
+                                           void* csm_state_data) const override;
+    bool ValidateSpirv(const uint32_t* code, size_t word_count, ValidationCache* cache,
+                       const ValidationCache::ShaderHash& hash) const;
     bool ValidatePipelineShaderStage(const PIPELINE_STATE* pipeline, const PipelineStageState& stage_state,
                                      bool check_point_size) const;
     bool ValidatePointListShaderState(const PIPELINE_STATE* pipeline, SHADER_MODULE_STATE const* module_state,
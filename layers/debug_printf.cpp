@@ -21,6 +21,8 @@
 #include "spirv-tools/optimizer.hpp"
 #include "spirv-tools/instrument.hpp"
 #include <iostream>
+#include <future>
+#include <tuple>
 #include "layer_chassis_dispatch.h"
 #include "sync_utils.h"
 #include "cmd_buffer_state.h"
@@ -38,14 +40,14 @@ void DebugPrintf::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         aborted = true;
         return;
     }
-    const char *size_string = getLayerOption("khronos_validation.printf_buffer_size");
-    output_buffer_size = *size_string ? atoi(size_string) : 1024;
+    const std::string size_string = GpuGetSetting("khronos_validation.printf_buffer_size");
+    output_buffer_size = !size_string.empty() ? atoi(size_string.c_str()) : 1024;
 
-    std::string verbose_string = getLayerOption("khronos_validation.printf_verbose");
+    std::string verbose_string = GpuGetSetting("khronos_validation.printf_verbose");
     transform(verbose_string.begin(), verbose_string.end(), verbose_string.begin(), ::tolower);
     verbose = verbose_string.length() ? !verbose_string.compare("true") : false;
 
-    std::string stdout_string = getLayerOption("khronos_validation.printf_to_stdout");
+    std::string stdout_string = GpuGetSetting("khronos_validation.printf_to_stdout");
     transform(stdout_string.begin(), stdout_string.end(), stdout_string.begin(), ::tolower);
     use_stdout = stdout_string.length() ? !stdout_string.compare("true") : false;
     if (getenv("DEBUG_PRINTF_TO_STDOUT")) use_stdout = true;
@@ -74,11 +76,70 @@ void DebugPrintf::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         aborted = true;
         return;
     }
+
+    output_buffer_manager.reset(new UtilOutputBufferManager(vmaAllocator, output_buffer_size,
+                                                            phys_dev_props.limits.minStorageBufferOffsetAlignment, VK_NULL_HANDLE));
+    message_worker.reset(new ValidationThreadPool(1));
+
+    const std::string trace_path = GpuGetSetting("khronos_validation.printf_trace_file");
+    if (!trace_path.empty()) {
+        trace_file = fopen(trace_path.c_str(), "wb");
+        if (trace_file) {
+            const uint32_t header[] = {kDPFTraceMagic, kDPFTraceVersion};
+            fwrite(header, sizeof(uint32_t), 2, trace_file);
+        } else {
+            ReportSetupProblem(device, "Unable to open Debug Printf trace file.  Formatting Debug Printf output instead.");
+        }
+    }
+}
+
+void DebugPrintf::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    GpuAssistedBase::PreCallRecordDestroyDevice(device, pAllocator);
+    // Reports whatever the worker still has queued, including anything read back above
+    message_worker.reset();
+    if (trace_file) {
+        fclose(trace_file);
+        trace_file = nullptr;
+    }
+}
+
+// Apps waiting for their work to complete expect to see its output
+void DebugPrintf::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    GpuAssistedBase::PostCallRecordGetFenceStatus(device, fence, result);
+    if (result == VK_SUCCESS) FlushMessages();
+}
+
+void DebugPrintf::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                              uint64_t timeout, VkResult result) {
+    GpuAssistedBase::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    if (result == VK_SUCCESS) FlushMessages();
+}
+
+void DebugPrintf::PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                               VkResult result) {
+    GpuAssistedBase::PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
+    if (result == VK_SUCCESS) FlushMessages();
+}
+
+void DebugPrintf::PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                                  VkResult result) {
+    GpuAssistedBase::PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
+    if (result == VK_SUCCESS) FlushMessages();
+}
+
+void DebugPrintf::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    GpuAssistedBase::PostCallRecordQueueWaitIdle(queue, result);
+    FlushMessages();
+}
+
+void DebugPrintf::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    GpuAssistedBase::PostCallRecordDeviceWaitIdle(device, result);
+    FlushMessages();
 }
 
 // Free the device memory and descriptor set associated with a command buffer.
 void DebugPrintf::DestroyBuffer(DPFBufferInfo &buffer_info) {
-    vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
+    output_buffer_manager->PutBackBlock(buffer_info.output_mem_block);
     if (buffer_info.desc_set != VK_NULL_HANDLE) {
         desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
     }
@@ -144,9 +205,6 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
 
     // Load original shader SPIR-V
     uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
-    new_pgm.clear();
-    new_pgm.reserve(num_words);
-    new_pgm.insert(new_pgm.end(), &pCreateInfo->pCode[0], &pCreateInfo->pCode[num_words]);
 
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
@@ -154,7 +212,22 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     using namespace spvtools;
     spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
     spvtools::ValidatorOptions val_options;
-    AdjustValidatorOptions(device_extensions, enabled_features, val_options);
+    const uint32_t validator_options = AdjustValidatorOptions(device_extensions, enabled_features, val_options);
+    *unique_shader_id = unique_shader_module_id++;
+    CacheFormatStrings(*unique_shader_id, pCreateInfo->pCode, num_words);
+
+    auto &instrumented_shader_cache = UtilInstrumentedShaderCache::Get();
+    const auto cache_key = UtilInstrumentedShaderCache::MakeKey(pCreateInfo->pCode, num_words, target_env, kUtilInstDebugPrintf,
+                                                                validator_options, desc_set_bind_index);
+    if (instrumented_shader_cache.Find(cache_key, *unique_shader_id, new_pgm)) return true;
+    uint32_t instrumented_shader_id = *unique_shader_id;
+    const bool cacheable =
+        UtilInstrumentedShaderCache::PickPlaceholderShaderId(pCreateInfo->pCode, num_words, &instrumented_shader_id);
+
+    new_pgm.clear();
+    new_pgm.reserve(num_words);
+    new_pgm.insert(new_pgm.end(), &pCreateInfo->pCode[0], &pCreateInfo->pCode[num_words]);
+
     spvtools::OptimizerOptions opt_options;
     opt_options.set_run_validator(true);
     opt_options.set_validator_options(val_options);
@@ -173,12 +246,13 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
         }
     };
     optimizer.SetMessageConsumer(debug_printf_console_message_consumer);
-    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, unique_shader_module_id));
+    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, instrumented_shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, opt_options);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (cacheable) {
+        instrumented_shader_cache.Insert(cache_key, new_pgm, instrumented_shader_id, *unique_shader_id);
     }
-    *unique_shader_id = unique_shader_module_id++;
     return pass;
 }
 // Create the instrumented shader data to provide to the driver.
@@ -193,160 +267,122 @@ void DebugPrintf::PreCallRecordCreateShaderModule(VkDevice device, const VkShade
     }
 }
 
-vartype vartype_lookup(char intype) {
-    switch (intype) {
-        case 'd':
-        case 'i':
-            return varsigned;
-            break;
-
-        case 'f':
-        case 'F':
-        case 'a':
-        case 'A':
-        case 'e':
-        case 'E':
-        case 'g':
-        case 'G':
-            return varfloat;
-            break;
-
-        case 'u':
-        case 'x':
-        case 'o':
-        default:
-            return varunsigned;
-            break;
-    }
-}
-
-std::vector<DPFSubstring> DebugPrintf::ParseFormatString(const std::string format_string) {
-    const char types[] = {'d', 'i', 'o', 'u', 'x', 'X', 'a', 'A', 'e', 'E', 'f', 'F', 'g', 'G', 'v', '\0'};
-    std::vector<DPFSubstring> parsed_strings;
-    size_t pos = 0;
-    size_t begin = 0;
-    size_t percent = 0;
-
-    while (begin < format_string.length()) {
-        DPFSubstring substring;
-
-        // Find a percent sign
-        pos = percent = format_string.find_first_of('%', pos);
-        if (pos == std::string::npos) {
-            // End of the format string   Push the rest of the characters
-            substring.string = format_string.substr(begin, format_string.length());
-            substring.needs_value = false;
-            parsed_strings.push_back(substring);
-            break;
-        }
-        pos++;
-        if (format_string[pos] == '%') {
-            pos++;
-            continue;  // %% - skip it
-        }
-        // Find the type of the value
-        pos = format_string.find_first_of(types, pos);
-        if (pos == format_string.npos) {
-            // This really shouldn't happen with a legal value string
-            pos = format_string.length();
-        } else {
-            char tempstring[32];
-            int count = 0;
-            std::string specifier = {};
-
-            if (format_string[pos] == 'v') {
-                // Vector must be of size 2, 3, or 4
-                // and format %v<size><type>
-                specifier = format_string.substr(percent, pos - percent);
-                count = atoi(&format_string[pos + 1]);
-                pos += 2;
-
-                // skip v<count>, handle long
-                specifier.push_back(format_string[pos]);
-                if (format_string[pos + 1] == 'l') {
-                    specifier.push_back('l');
-                    pos++;
-                }
-
-                // Take the preceding characters, and the percent through the type
-                substring.string = format_string.substr(begin, percent - begin);
-                substring.string += specifier;
-                substring.needs_value = true;
-                substring.type = vartype_lookup(specifier.back());
-                parsed_strings.push_back(substring);
-
-                // Continue with a comma separated list
-                sprintf(tempstring, ", %s", specifier.c_str());
-                substring.string = tempstring;
-                for (int i = 0; i < (count - 1); i++) {
-                    parsed_strings.push_back(substring);
+// Parse the format string of every printf in the shader, and rewrite the 64 bit specifiers for the host's printf, so that
+// output records can be formatted without searching the SPIR-V for them.
+void DebugPrintf::CacheFormatStrings(uint32_t shader_id, const uint32_t *pgm, uint32_t num_words) {
+    auto literal_string = [pgm](uint32_t offset, uint32_t end) {
+        const char *str = reinterpret_cast<const char *>(&pgm[offset]);
+        return std::string(str, strnlen(str, (end - offset) * sizeof(uint32_t)));
+    };
+    layer_data::unordered_map<uint32_t, std::string> strings;
+    layer_data::unordered_set<uint32_t> printf_sets;
+    std::vector<uint32_t> format_string_ids;
+    uint32_t offset = 5;  // Skip the header
+    while (offset < num_words) {
+        const uint32_t opcode = pgm[offset] & spv::OpCodeMask;
+        const uint32_t length = pgm[offset] >> spv::WordCountShift;
+        if (length == 0 || offset + length > num_words) break;
+        switch (opcode) {
+            case spv::OpString:
+                if (length > 2) strings.emplace(pgm[offset + 1], literal_string(offset + 2, offset + length));
+                break;
+            case spv::OpExtInstImport:
+                if (length > 2 && literal_string(offset + 2, offset + length) == "NonSemantic.DebugPrintf") {
+                    printf_sets.insert(pgm[offset + 1]);
                 }
-            } else {
-                // Single non-vector value
-                if (format_string[pos + 1] == 'l') pos++;  // Save long size
-                substring.string = format_string.substr(begin, pos - begin + 1);
-                substring.needs_value = true;
-                substring.type = vartype_lookup(format_string[pos]);
-                parsed_strings.push_back(substring);
-            }
-            begin = pos + 1;
+                break;
+            case spv::OpExtInst:
+                // DebugPrintf takes the format string as its first operand
+                if (length > 5 && printf_sets.count(pgm[offset + 3])) format_string_ids.push_back(pgm[offset + 5]);
+                break;
+            default:
+                break;
         }
+        offset += length;
+    }
+    if (format_string_ids.empty()) return;
+
+    auto format_strings = std::make_shared<DPFFormatStrings>();
+    auto trace_chunks = std::make_shared<std::vector<uint32_t>>();
+    for (uint32_t string_id : format_string_ids) {
+        if (format_strings->count(string_id)) continue;
+        auto it = strings.find(string_id);
+        if (it == strings.end()) continue;
+        format_strings->emplace(string_id, DPFParseFormatString(it->second));
+        if (trace_file) {
+            const uint32_t string_words = static_cast<uint32_t>(it->second.size() / sizeof(uint32_t) + 1);
+            const size_t chunk = trace_chunks->size();
+            trace_chunks->insert(trace_chunks->end(), {kDPFTraceFormatString, 2 + string_words, shader_id, string_id});
+            trace_chunks->resize(trace_chunks->size() + string_words, 0);
+            memcpy(&(*trace_chunks)[chunk + 4], it->second.data(), it->second.size());
+        }
+    }
+    format_string_cache.insert_or_assign(shader_id, std::move(format_strings));
+    if (!trace_chunks->empty()) {
+        // Going through the worker puts the format strings in the trace ahead of any output of the shader
+        message_worker->Post([this, trace_chunks]() { WriteTrace(*trace_chunks); });
     }
-    return parsed_strings;
 }
 
-std::string DebugPrintf::FindFormatString(std::vector<uint32_t> pgm, uint32_t string_id) {
-    std::string format_string;
-    SHADER_MODULE_STATE module_state(pgm);
-    if (module_state.words.size() > 0) {
-        for (const auto &insn : module_state) {
-            if (insn.opcode() == spv::OpString) {
-                uint32_t offset = insn.offset();
-                if (pgm[offset + 1] == string_id) {
-                    format_string = reinterpret_cast<char *>(&pgm[offset + 2]);
-                    break;
-                }
+// Copy the output records out of the block, so it can be reused right away, and leave the decoding and formatting of them
+// to the message worker.
+void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, DPFBufferInfo &buffer_info,
+                                             uint32_t operation_index, uint32_t *const debug_output_buffer) {
+    uint32_t expect = debug_output_buffer[0];
+    if (!expect) return;
+
+    // Word 0 counts every word the shaders tried to write, which can be more than the block has room for
+    const uint32_t output_words = std::min(expect + 1, static_cast<uint32_t>(output_buffer_size / sizeof(uint32_t)));
+    if (trace_file) {
+        // Decoding is left to the offline decoder, the block goes out as is
+        const uint64_t command_buffer_handle = HandleToUint64(command_buffer);
+        auto chunk = std::make_shared<std::vector<uint32_t>>();
+        chunk->reserve(2 + kDPFTraceOutputHeader + output_words);
+        chunk->insert(chunk->end(),
+                      {kDPFTraceOutput, kDPFTraceOutputHeader + output_words, static_cast<uint32_t>(command_buffer_handle),
+                       static_cast<uint32_t>(command_buffer_handle >> 32),
+                       static_cast<uint32_t>(buffer_info.pipeline_bind_point), operation_index});
+        chunk->insert(chunk->end(), debug_output_buffer, debug_output_buffer + output_words);
+        memset(debug_output_buffer, 0, output_words * sizeof(uint32_t));
+        message_worker->Post([this, chunk]() { WriteTrace(*chunk); });
+        messages_posted = true;
+        return;
+    }
+    std::vector<uint32_t> debug_output(debug_output_buffer, debug_output_buffer + output_words);
+    memset(debug_output_buffer, 0, output_words * sizeof(uint32_t));
+
+    // The pipeline can be destroyed before the worker gets to the records, so look up what the verbose messages need now
+    layer_data::unordered_map<uint32_t, GpuAssistedShaderTracker> shaders;
+    if (verbose) {
+        for (uint32_t index = 1;
+             index + kDebugPrintfRecordValues <= output_words && debug_output[index] >= kDebugPrintfRecordValues;
+             index += debug_output[index]) {
+            const uint32_t shader_id = debug_output[index + 1];
+            if (shaders.count(shader_id)) continue;
+            auto it = shader_map.find(shader_id);
+            if (it != shader_map.end()) {
+                shaders.emplace(shader_id, it->second);
             }
         }
     }
 
-    return format_string;
-}
-
-// GCC and clang don't like using variables as format strings in sprintf.
-// #pragma GCC is recognized by both compilers
-#if defined(__GNUC__) || defined(__clang__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wformat-security"
-#endif
-
-void snprintf_with_malloc(std::stringstream &shader_message, DPFSubstring substring, size_t needed, void *values) {
-    char *buffer = static_cast<char *>(malloc((needed + 1) * sizeof(char)));  // Add 1 for terminator
-    if (substring.longval) {
-        snprintf(buffer, needed, substring.string.c_str(), substring.longval);
-    } else if (!substring.needs_value) {
-        snprintf(buffer, needed, substring.string.c_str());
+    const VkPipelineBindPoint pipeline_bind_point = buffer_info.pipeline_bind_point;
+    if (message_worker) {
+        // The worker runs tasks in the order they are posted, so messages keep the order of submission
+        using Task = std::tuple<std::vector<uint32_t>, layer_data::unordered_map<uint32_t, GpuAssistedShaderTracker>>;
+        auto task = std::make_shared<Task>(std::move(debug_output), std::move(shaders));
+        message_worker->Post([this, command_buffer, queue, pipeline_bind_point, operation_index, task]() {
+            GenerateMessages(command_buffer, queue, pipeline_bind_point, operation_index, std::get<0>(*task), std::get<1>(*task));
+        });
+        messages_posted = true;
     } else {
-        switch (substring.type) {
-            case varunsigned:
-                needed = snprintf(buffer, needed, substring.string.c_str(), *static_cast<uint32_t *>(values) - 1);
-                break;
-
-            case varsigned:
-                needed = snprintf(buffer, needed, substring.string.c_str(), *static_cast<int32_t *>(values) - 1);
-                break;
-
-            case varfloat:
-                needed = snprintf(buffer, needed, substring.string.c_str(), *static_cast<float *>(values) - 1);
-                break;
-        }
+        GenerateMessages(command_buffer, queue, pipeline_bind_point, operation_index, debug_output, shaders);
     }
-    shader_message << buffer;
-    free(buffer);
 }
 
-void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, DPFBufferInfo &buffer_info,
-                                             uint32_t operation_index, uint32_t *const debug_output_buffer) {
+void DebugPrintf::GenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, VkPipelineBindPoint pipeline_bind_point,
+                                   uint32_t operation_index, const std::vector<uint32_t> &debug_output,
+                                   const layer_data::unordered_map<uint32_t, GpuAssistedShaderTracker> &shaders) {
     // Word         Content
     //    0         Size of output record, including this word
     //    1         Shader ID
@@ -358,115 +394,98 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
     //    7         Printf Format String Id
     //    8         Printf Values Word 0 (optional)
     //    9         Printf Values Word 1 (optional)
-    uint32_t expect = debug_output_buffer[0];
-    if (!expect) return;
+    const uint32_t expect = debug_output[0];
+    const uint32_t output_words = static_cast<uint32_t>(debug_output.size());
+    const std::vector<uint32_t> no_pgm;
+    const std::vector<DPFSubstring> no_substrings;
+    // Records from the same shader tend to come in runs, so hold on to the last format strings looked up
+    uint32_t format_strings_shader_id = 0;
+    std::shared_ptr<const DPFFormatStrings> format_strings;
 
     uint32_t index = 1;
-    while (debug_output_buffer[index]) {
-        std::stringstream shader_message;
+    while (index + kDebugPrintfRecordValues <= output_words && debug_output[index] >= kDebugPrintfRecordValues &&
+           index + debug_output[index] <= output_words) {
         VkShaderModule shader_module_handle = VK_NULL_HANDLE;
         VkPipeline pipeline_handle = VK_NULL_HANDLE;
-        std::vector<uint32_t> pgm;
+        const std::vector<uint32_t> *pgm = &no_pgm;
 
-        DPFOutputRecord *debug_record = reinterpret_cast<DPFOutputRecord *>(&debug_output_buffer[index]);
+        const uint32_t *const debug_record = &debug_output[index];
+        const uint32_t record_end = index + debug_record[0];
+        const uint32_t shader_id = debug_record[1];
+        const uint32_t format_string_id = debug_record[7];
         // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
         // by the instrumented shader.
-        auto it = shader_map.find(debug_record->shader_id);
-        if (it != shader_map.end()) {
-            shader_module_handle = it->second.shader_module;
-            pipeline_handle = it->second.pipeline;
-            pgm = it->second.pgm;
+        auto shader = shaders.find(shader_id);
+        if (shader != shaders.end()) {
+            shader_module_handle = shader->second.shader_module;
+            pipeline_handle = shader->second.pipeline;
+            pgm = &shader->second.pgm;
         }
-        // Search through the shader source for the printf format string for this invocation
-        auto format_string = FindFormatString(pgm, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
-        void *values = static_cast<void *>(&debug_record->values);
-        const uint32_t static_size = 1024;
-        // Sprintf each format substring into a temporary string then add that to the message
-        for (auto &substring : format_substrings) {
-            char temp_string[static_size];
-            size_t needed = 0;
-            std::vector<std::string> format_strings = { "%ul", "%lu", "%lx" };
-            size_t ul_pos = 0;
-            bool print_hex = true;
-            for (auto ul_string : format_strings) {
-                ul_pos = substring.string.find(ul_string);
-                if (ul_pos != std::string::npos) {
-                    if (ul_string == "%lu") print_hex = false;
-                    break;
-                }
-            }
-            if (ul_pos != std::string::npos) {
-                // Unsigned 64 bit value
-                substring.longval = *static_cast<uint64_t *>(values);
-                values = static_cast<uint64_t *>(values) + 1;
-                if (print_hex) {
-                    substring.string.replace(ul_pos + 1, 2, PRIx64);
-                } else {
-                    substring.string.replace(ul_pos + 1, 2, PRIu64);
-                }
-                needed = snprintf(temp_string, static_size, substring.string.c_str(), substring.longval);
-            } else {
-                if (substring.needs_value) {
-                    switch (substring.type) {
-                        case varunsigned:
-                            needed = snprintf(temp_string, static_size, substring.string.c_str(), *static_cast<uint32_t *>(values));
-                            break;
-
-                        case varsigned:
-                            needed = snprintf(temp_string, static_size, substring.string.c_str(), *static_cast<int32_t *>(values));
-                            break;
-
-                        case varfloat:
-                            needed = snprintf(temp_string, static_size, substring.string.c_str(), *static_cast<float *>(values));
-                            break;
-                    }
-                    values = static_cast<uint32_t *>(values) + 1;
-                } else {
-                    needed = snprintf(temp_string, static_size, substring.string.c_str());
-                }
-            }
-
-            if (needed < static_size) {
-                shader_message << temp_string;
-            } else {
-                // Static buffer not big enough for message, use malloc to get enough
-                snprintf_with_malloc(shader_message, substring, needed, values);
+        // The printf format string for this invocation was broken into strings with 1 or 0 value when the shader was instrumented
+        if (!format_strings || format_strings_shader_id != shader_id) {
+            auto it = format_string_cache.find(shader_id);
+            format_strings = (it != format_string_cache.end()) ? it->second : nullptr;
+            format_strings_shader_id = shader_id;
+        }
+        const std::vector<DPFSubstring> *format_substrings = &no_substrings;
+        if (format_strings) {
+            auto it = format_strings->find(format_string_id);
+            if (it != format_strings->end()) {
+                format_substrings = &it->second;
             }
         }
+        const std::string shader_message = DPFFormatMessage(*format_substrings, &debug_output[index + kDebugPrintfRecordValues],
+                                                            record_end - index - kDebugPrintfRecordValues);
 
         if (verbose) {
             std::string stage_message;
             std::string common_message;
             std::string filename_message;
             std::string source_message;
-            UtilGenerateStageMessage(&debug_output_buffer[index], stage_message);
-            UtilGenerateCommonMessage(report_data, command_buffer, &debug_output_buffer[index], shader_module_handle,
-                                      pipeline_handle, buffer_info.pipeline_bind_point, operation_index, common_message);
-            UtilGenerateSourceMessages(pgm, &debug_output_buffer[index], true, filename_message, source_message);
+            UtilGenerateStageMessage(debug_record, stage_message);
+            UtilGenerateCommonMessage(report_data, command_buffer, debug_record, shader_module_handle, pipeline_handle,
+                                      pipeline_bind_point, operation_index, common_message);
+            UtilGenerateSourceMessages(*pgm, debug_record, true, filename_message, source_message);
             if (use_stdout) {
                 std::cout << "UNASSIGNED-DEBUG-PRINTF " << common_message.c_str() << " " << stage_message.c_str() << " "
-                          << shader_message.str().c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
+                          << shader_message.c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
             } else {
                 LogInfo(queue, "UNASSIGNED-DEBUG-PRINTF", "%s %s %s %s%s", common_message.c_str(), stage_message.c_str(),
-                        shader_message.str().c_str(), filename_message.c_str(), source_message.c_str());
+                        shader_message.c_str(), filename_message.c_str(), source_message.c_str());
             }
         } else {
             if (use_stdout) {
-                std::cout << shader_message.str();
+                std::cout << shader_message;
             } else {
                 // Don't let LogInfo process any '%'s in the string
-                LogInfo(device, "UNASSIGNED-DEBUG-PRINTF", "%s", shader_message.str().c_str());
+                LogInfo(device, "UNASSIGNED-DEBUG-PRINTF", "%s", shader_message.c_str());
             }
         }
-        index += debug_record->size;
+        index = record_end;
     }
     if ((index - 1) != expect) {
         LogWarning(device, "UNASSIGNED-DEBUG-PRINTF",
                    "WARNING - Debug Printf message was truncated, likely due to a buffer size that was too small for the message");
     }
-    memset(debug_output_buffer, 0, 4 * (debug_output_buffer[0] + 1));
+}
+
+// Wait for the worker to report every message read back so far
+void DebugPrintf::FlushMessages() {
+    if (!message_worker || !messages_posted.exchange(false)) return;
+    std::promise<void> flushed;
+    auto done = flushed.get_future();
+    message_worker->Post([this, &flushed]() {
+        if (trace_file) fflush(trace_file);
+        flushed.set_value();
+    });
+    done.wait();
+}
+
+// Only called on the message worker, which keeps the chunks in order
+void DebugPrintf::WriteTrace(const std::vector<uint32_t> &chunks) {
+    if (fwrite(chunks.data(), sizeof(uint32_t), chunks.size(), trace_file) != chunks.size()) {
+        LogWarning(device, "UNASSIGNED-DEBUG-PRINTF", "WARNING - Failed to write to the Debug Printf trace file");
+    }
 }
 
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
@@ -479,8 +498,6 @@ void debug_printf_state::CommandBuffer::Process(VkQueue queue) {
         uint32_t ray_trace_index = 0;
 
         for (auto &buffer_info : gpu_buffer_list) {
-            char *data;
-
             uint32_t operation_index = 0;
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 operation_index = draw_index;
@@ -492,11 +509,8 @@ void debug_printf_state::CommandBuffer::Process(VkQueue queue) {
                 assert(false);
             }
 
-            VkResult result = vmaMapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&data);
-            if (result == VK_SUCCESS) {
-                device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index, (uint32_t *)data);
-                vmaUnmapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+            device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index,
+                                                     buffer_info.output_mem_block.data);
 
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 draw_index++;
@@ -511,10 +525,6 @@ void debug_printf_state::CommandBuffer::Process(VkQueue queue) {
     }
 }
 
-#if defined(__GNUC__)
-#pragma GCC diagnostic pop
-#endif
-
 void DebugPrintf::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                        uint32_t firstVertex, uint32_t firstInstance) {
     AllocateDebugPrintfResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS);
@@ -738,34 +748,21 @@ void DebugPrintf::AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer,
         return;
     }
 
-    // Allocate memory for the output block that the gpu will use to return values for printf
-    DPFDeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    buffer_info.size = output_buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
+    // Get a zeroed output block that the gpu will use to return values for printf
+    UtilOutputBlock output_block = {};
+    result = output_buffer_manager->GetBlock(&output_block);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
         aborted = true;
         return;
     }
 
-    // Clear the output block to zeros so that only printf values from the gpu will be present
-    uint32_t *data;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&data));
-    if (result == VK_SUCCESS) {
-        memset(data, 0, output_buffer_size);
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
-    }
-
     auto desc_writes = LvlInitStruct<VkWriteDescriptorSet>();
     const uint32_t desc_count = 1;
 
     // Write the descriptor
     output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
+    output_desc_buffer_info.offset = output_block.offset;
 
     desc_writes.descriptorCount = 1;
     desc_writes.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -784,7 +781,7 @@ void DebugPrintf::AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer,
         cb_node->buffer_infos.emplace_back(output_block, desc_sets[0], desc_pool, bind_point);
     } else {
         ReportSetupProblem(device, "Unable to find pipeline state");
-        vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
+        output_buffer_manager->PutBackBlock(output_block);
         aborted = true;
         return;
     }
@@ -802,7 +799,7 @@ debug_printf_state::CommandBuffer::CommandBuffer(DebugPrintf *dp, VkCommandBuffe
     : gpu_utils_state::CommandBuffer(dp, cb, pCreateInfo, pool) {}
 
 void debug_printf_state::CommandBuffer::Reset() {
-    CMD_BUFFER_STATE::Reset();
+    gpu_utils_state::CommandBuffer::Reset();
     auto debug_printf = static_cast<DebugPrintf *>(dev_data);
     // Free the device memory and descriptor set(s) associated with a command buffer.
     if (debug_printf->aborted) {
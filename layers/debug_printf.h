@@ -20,30 +20,23 @@
 #pragma once
 
 #include "gpu_utils.h"
-class DebugPrintf;
+#include "debug_printf_format.h"
 
-struct DPFDeviceMemoryBlock {
-    VkBuffer buffer;
-    VmaAllocation allocation;
-};
+#include <atomic>
+class DebugPrintf;
 
 struct DPFBufferInfo {
-    DPFDeviceMemoryBlock output_mem_block;
+    UtilOutputBlock output_mem_block;
     VkDescriptorSet desc_set;
     VkDescriptorPool desc_pool;
     VkPipelineBindPoint pipeline_bind_point;
-    DPFBufferInfo(DPFDeviceMemoryBlock output_mem_block, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
+    DPFBufferInfo(UtilOutputBlock output_mem_block, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
                   VkPipelineBindPoint pipeline_bind_point)
         : output_mem_block(output_mem_block), desc_set(desc_set), desc_pool(desc_pool), pipeline_bind_point(pipeline_bind_point){};
 };
 
-enum vartype { varsigned, varunsigned, varfloat };
-struct DPFSubstring {
-    std::string string;
-    bool needs_value;
-    vartype type;
-    uint64_t longval = 0;
-};
+// Parsed format strings of one shader, keyed by the id of their OpString
+typedef layer_data::unordered_map<uint32_t, std::vector<DPFSubstring>> DPFFormatStrings;
 
 struct DPFOutputRecord {
     uint32_t size;
@@ -98,10 +91,24 @@ class DebugPrintf : public GpuAssistedBase {
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          void* csm_state_data) override;
-    std::vector<DPFSubstring> ParseFormatString(std::string format_string);
-    std::string FindFormatString(std::vector<uint32_t> pgm, uint32_t string_id);
+    void CacheFormatStrings(uint32_t shader_id, const uint32_t* pgm, uint32_t num_words);
     void AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, DPFBufferInfo &buffer_info,
                                     uint32_t operation_index, uint32_t* const debug_output_buffer);
+    void GenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, VkPipelineBindPoint pipeline_bind_point,
+                          uint32_t operation_index, const std::vector<uint32_t>& debug_output,
+                          const layer_data::unordered_map<uint32_t, GpuAssistedShaderTracker>& shaders);
+    void FlushMessages();
+    void WriteTrace(const std::vector<uint32_t>& chunks);
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) override;
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result) override;
+    void PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout,
+                                      VkResult result) override;
+    void PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout,
+                                         VkResult result) override;
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
                               uint32_t firstInstance) override;
     void PreCallRecordCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo,
@@ -193,4 +200,12 @@ class DebugPrintf : public GpuAssistedBase {
   private:
     bool verbose = false;
     bool use_stdout = false;
+    // Filled in as shaders are instrumented, so that records can be formatted without going back to the SPIR-V
+    vl_concurrent_unordered_map<uint32_t, std::shared_ptr<const DPFFormatStrings>> format_string_cache;
+    // Decodes and reports output records in the order they were read back, off the submitting thread
+    std::unique_ptr<ValidationThreadPool> message_worker;
+    // Set when output is posted to the worker, so that polling a fence doesn't wait on the worker when there is nothing to report
+    std::atomic<bool> messages_posted{false};
+    // Raw output goes here instead of being formatted when khronos_validation.printf_trace_file is set
+    FILE* trace_file = nullptr;
 };
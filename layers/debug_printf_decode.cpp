@@ -0,0 +1,47 @@
+/* Copyright (c) 2020-2022 The Khronos Group Inc.
+ * Copyright (c) 2020-2022 Valve Corporation
+ * Copyright (c) 2020-2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Decodes the files written by Debug Printf when khronos_validation.printf_trace_file is set, and prints the messages
+// the layer would have printed to stdout.
+//
+// Usage: debug_printf_decode <trace file>
+
+#include "debug_printf_format.h"
+
+#include <cstdio>
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <trace file>\n", argv[0]);
+        return 1;
+    }
+    FILE *trace_file = fopen(argv[1], "rb");
+    if (!trace_file) {
+        fprintf(stderr, "Unable to open %s\n", argv[1]);
+        return 1;
+    }
+
+    std::string error;
+    const bool decoded = DPFDecodeTrace(
+        trace_file, [](const std::string &line) { fputs(line.c_str(), stdout); }, error);
+    fclose(trace_file);
+    if (!decoded) {
+        fprintf(stderr, "%s: %s\n", argv[1], error.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,314 @@
+/* Copyright (c) 2020-2022 The Khronos Group Inc.
+ * Copyright (c) 2020-2022 Valve Corporation
+ * Copyright (c) 2020-2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author: Tony Barbour <tony@lunarg.com>
+ */
+
+// Debug Printf format string handling that doesn't depend on Vulkan or the layer, so that it can be shared with the
+// offline trace decoder.
+
+#include "debug_printf_format.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <utility>
+
+static vartype vartype_lookup(char intype) {
+    switch (intype) {
+        case 'd':
+        case 'i':
+            return varsigned;
+            break;
+
+        case 'f':
+        case 'F':
+        case 'a':
+        case 'A':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+            return varfloat;
+            break;
+
+        case 'u':
+        case 'x':
+        case 'o':
+        default:
+            return varunsigned;
+            break;
+    }
+}
+
+std::vector<DPFSubstring> DPFParseFormatString(const std::string &format_string) {
+    const char types[] = {'d', 'i', 'o', 'u', 'x', 'X', 'a', 'A', 'e', 'E', 'f', 'F', 'g', 'G', 'v', '\0'};
+    std::vector<DPFSubstring> parsed_strings;
+    size_t pos = 0;
+    size_t begin = 0;
+    size_t percent = 0;
+
+    while (begin < format_string.length()) {
+        DPFSubstring substring;
+
+        // Find a percent sign
+        pos = percent = format_string.find_first_of('%', pos);
+        if (pos == std::string::npos) {
+            // End of the format string   Push the rest of the characters
+            substring.string = format_string.substr(begin, format_string.length());
+            substring.needs_value = false;
+            parsed_strings.push_back(substring);
+            break;
+        }
+        pos++;
+        if (format_string[pos] == '%') {
+            pos++;
+            continue;  // %% - skip it
+        }
+        // Find the type of the value
+        pos = format_string.find_first_of(types, pos);
+        if (pos == format_string.npos) {
+            // This really shouldn't happen with a legal value string
+            pos = format_string.length();
+        } else {
+            char tempstring[32];
+            int count = 0;
+            std::string specifier = {};
+
+            if (format_string[pos] == 'v') {
+                // Vector must be of size 2, 3, or 4
+                // and format %v<size><type>
+                specifier = format_string.substr(percent, pos - percent);
+                count = atoi(&format_string[pos + 1]);
+                pos += 2;
+
+                // skip v<count>, handle long
+                specifier.push_back(format_string[pos]);
+                if (format_string[pos + 1] == 'l') {
+                    specifier.push_back('l');
+                    pos++;
+                }
+
+                // Take the preceding characters, and the percent through the type
+                substring.string = format_string.substr(begin, percent - begin);
+                substring.string += specifier;
+                substring.needs_value = true;
+                substring.type = vartype_lookup(specifier.back());
+                parsed_strings.push_back(substring);
+
+                // Continue with a comma separated list
+                sprintf(tempstring, ", %s", specifier.c_str());
+                substring.string = tempstring;
+                for (int i = 0; i < (count - 1); i++) {
+                    parsed_strings.push_back(substring);
+                }
+            } else {
+                // Single non-vector value
+                if (format_string[pos + 1] == 'l') pos++;  // Save long size
+                substring.string = format_string.substr(begin, pos - begin + 1);
+                substring.needs_value = true;
+                substring.type = vartype_lookup(format_string[pos]);
+                parsed_strings.push_back(substring);
+            }
+            begin = pos + 1;
+        }
+    }
+
+    // The shader writes 64 bit values as two words, rewrite their specifiers for the host's printf
+    for (auto &substring : parsed_strings) {
+        static const std::string long_specifiers[] = {"%ul", "%lu", "%lx"};
+        for (const auto &long_specifier : long_specifiers) {
+            size_t ul_pos = substring.string.find(long_specifier);
+            if (ul_pos != std::string::npos) {
+                substring.string.replace(ul_pos + 1, 2, long_specifier == "%lu" ? PRIu64 : PRIx64);
+                substring.is_64bit = true;
+                break;
+            }
+        }
+    }
+    return parsed_strings;
+}
+
+// GCC and clang don't like using variables as format strings in sprintf.
+// #pragma GCC is recognized by both compilers
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-security"
+#endif
+
+static void snprintf_with_malloc(std::stringstream &shader_message, DPFSubstring substring, size_t needed, void *values) {
+    char *buffer = static_cast<char *>(malloc((needed + 1) * sizeof(char)));  // Add 1 for terminator
+    if (substring.is_64bit) {
+        snprintf(buffer, needed + 1, substring.string.c_str(), substring.longval);
+    } else if (!substring.needs_value) {
+        snprintf(buffer, needed + 1, substring.string.c_str());
+    } else {
+        switch (substring.type) {
+            case varunsigned:
+                snprintf(buffer, needed + 1, substring.string.c_str(), *static_cast<uint32_t *>(values));
+                break;
+
+            case varsigned:
+                snprintf(buffer, needed + 1, substring.string.c_str(), *static_cast<int32_t *>(values));
+                break;
+
+            case varfloat:
+                snprintf(buffer, needed + 1, substring.string.c_str(), *static_cast<float *>(values));
+                break;
+        }
+    }
+    shader_message << buffer;
+    free(buffer);
+}
+
+std::string DPFFormatMessage(const std::vector<DPFSubstring> &format_substrings, const uint32_t *values, uint32_t value_count) {
+    std::stringstream shader_message;
+    uint32_t value_index = 0;
+    const uint32_t static_size = 1024;
+    // Sprintf each format substring into a temporary string then add that to the message
+    for (const auto &format_substring : format_substrings) {
+        DPFSubstring substring = format_substring;
+        char temp_string[static_size];
+        size_t needed = 0;
+        uint32_t value = 0;
+        if (substring.is_64bit) {
+            // Unsigned 64 bit value
+            if (value_index + 2 > value_count) break;
+            memcpy(&substring.longval, &values[value_index], sizeof(uint64_t));
+            value_index += 2;
+            needed = snprintf(temp_string, static_size, substring.string.c_str(), substring.longval);
+        } else {
+            if (substring.needs_value) {
+                if (value_index + 1 > value_count) break;
+                value = values[value_index];
+                switch (substring.type) {
+                    case varunsigned:
+                        needed = snprintf(temp_string, static_size, substring.string.c_str(), value);
+                        break;
+
+                    case varsigned:
+                        needed = snprintf(temp_string, static_size, substring.string.c_str(), static_cast<int32_t>(value));
+                        break;
+
+                    case varfloat:
+                        float float_value;
+                        memcpy(&float_value, &value, sizeof(float));
+                        needed = snprintf(temp_string, static_size, substring.string.c_str(), float_value);
+                        break;
+                }
+                value_index++;
+            } else {
+                needed = snprintf(temp_string, static_size, substring.string.c_str());
+            }
+        }
+
+        if (needed < static_size) {
+            shader_message << temp_string;
+        } else {
+            // Static buffer not big enough for message, use malloc to get enough
+            snprintf_with_malloc(shader_message, substring, needed, &value);
+        }
+    }
+    return shader_message.str();
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+static const char *BindPointName(uint32_t pipeline_bind_point) {
+    switch (pipeline_bind_point) {
+        case 0:  // VK_PIPELINE_BIND_POINT_GRAPHICS
+            return "draw";
+        case 1:  // VK_PIPELINE_BIND_POINT_COMPUTE
+            return "dispatch";
+        case 1000165000:  // VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR
+            return "trace rays";
+        default:
+            return "operation";
+    }
+}
+
+bool DPFDecodeTrace(FILE *trace_file, const std::function<void(const std::string &)> &print, std::string &error) {
+    uint32_t header[2] = {};
+    if (fread(header, sizeof(uint32_t), 2, trace_file) != 2 || header[0] != kDPFTraceMagic) {
+        error = "not a Debug Printf trace file";
+        return false;
+    }
+    if (header[1] != kDPFTraceVersion) {
+        error = "version " + std::to_string(header[1]) + ", only version " + std::to_string(kDPFTraceVersion) + " is supported";
+        return false;
+    }
+
+    // Format strings by shader ID and OpString ID
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<DPFSubstring>> format_strings;
+    const std::vector<DPFSubstring> no_substrings;
+    std::vector<uint32_t> chunk;
+    uint32_t chunk_header[2];
+    while (fread(chunk_header, sizeof(uint32_t), 2, trace_file) == 2) {
+        chunk.resize(chunk_header[1]);
+        if (fread(chunk.data(), sizeof(uint32_t), chunk.size(), trace_file) != chunk.size()) {
+            error = "ends in the middle of a chunk";
+            return false;
+        }
+        const uint32_t chunk_words = static_cast<uint32_t>(chunk.size());
+
+        if (chunk_header[0] == kDPFTraceFormatString) {
+            if (chunk_words < 3) continue;
+            const char *str = reinterpret_cast<const char *>(&chunk[2]);
+            const std::string format_string(str, strnlen(str, (chunk_words - 2) * sizeof(uint32_t)));
+            format_strings[std::make_pair(chunk[0], chunk[1])] = DPFParseFormatString(format_string);
+        } else if (chunk_header[0] == kDPFTraceOutput) {
+            if (chunk_words <= kDPFTraceOutputHeader) continue;
+            const uint64_t command_buffer = chunk[0] | (static_cast<uint64_t>(chunk[1]) << 32);
+            const uint32_t pipeline_bind_point = chunk[2];
+            const uint32_t operation_index = chunk[3];
+            const uint32_t *debug_output = &chunk[kDPFTraceOutputHeader];
+            const uint32_t output_words = chunk_words - kDPFTraceOutputHeader;
+            const uint32_t expect = debug_output[0];
+
+            // Same walk as DebugPrintf::GenerateMessages
+            uint32_t index = 1;
+            while (index + kDebugPrintfRecordValues <= output_words && debug_output[index] >= kDebugPrintfRecordValues &&
+                   index + debug_output[index] <= output_words) {
+                const uint32_t *const debug_record = &debug_output[index];
+                const uint32_t record_end = index + debug_record[0];
+                const uint32_t shader_id = debug_record[1];
+                auto it = format_strings.find(std::make_pair(shader_id, debug_record[7]));
+                const std::string shader_message = DPFFormatMessage(it != format_strings.end() ? it->second : no_substrings,
+                                                                    &debug_output[index + kDebugPrintfRecordValues],
+                                                                    record_end - index - kDebugPrintfRecordValues);
+                char prefix[128];
+                snprintf(prefix, sizeof(prefix), "VkCommandBuffer 0x%" PRIx64 ", %s %u, shader %u: ", command_buffer,
+                         BindPointName(pipeline_bind_point), operation_index, shader_id);
+                std::string line = prefix + shader_message;
+                if (shader_message.empty() || shader_message.back() != '\n') line += '\n';
+                print(line);
+                index = record_end;
+            }
+            if ((index - 1) != expect) {
+                print(
+                    "WARNING - Debug Printf message was truncated, likely due to a buffer size that was too small for the "
+                    "message\n");
+            }
+        }
+        // Chunks of types this version doesn't know about are skipped
+    }
+    return true;
+}
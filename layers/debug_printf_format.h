@@ -0,0 +1,63 @@
+/* Copyright (c) 2020-2022 The Khronos Group Inc.
+ * Copyright (c) 2020-2022 Valve Corporation
+ * Copyright (c) 2020-2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author: Tony Barbour <tony@lunarg.com>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+enum vartype { varsigned, varunsigned, varfloat };
+struct DPFSubstring {
+    std::string string;
+    bool needs_value;
+    vartype type;
+    uint64_t longval = 0;
+    bool is_64bit = false;
+};
+
+// Number of words in an output record ahead of its values
+static const uint32_t kDebugPrintfRecordValues = 8;
+
+// Breaks a format string into strings with 1 or 0 value
+std::vector<DPFSubstring> DPFParseFormatString(const std::string &format_string);
+// Formats the values of one output record, stopping early if the record runs out of values
+std::string DPFFormatMessage(const std::vector<DPFSubstring> &format_substrings, const uint32_t *values, uint32_t value_count);
+
+// Layout of the files written when khronos_validation.printf_trace_file is set. Everything is in the byte order of the host
+// that wrote the file. The file starts with kDPFTraceMagic and kDPFTraceVersion, followed by chunks that each start with
+// their DPFTraceChunkType and the number of words in the rest of the chunk:
+//   kDPFTraceFormatString   Shader ID, OpString ID, the string itself padded with zeros to a whole word
+//   kDPFTraceOutput         Command buffer handle (2 words), pipeline bind point, operation index, then the contents of
+//                           the output block: the number of words the shaders wrote, followed by the output records
+// The format strings of a shader are written before any output of it.
+static const uint32_t kDPFTraceMagic = 0x54465044;  // "DPFT"
+static const uint32_t kDPFTraceVersion = 1;
+enum DPFTraceChunkType : uint32_t {
+    kDPFTraceFormatString = 1,
+    kDPFTraceOutput = 2,
+};
+// Words in a kDPFTraceOutput chunk ahead of the output block
+static const uint32_t kDPFTraceOutputHeader = 4;
+
+// Decodes a trace file, handing each line of the messages the layer would have printed to print. Returns false with the
+// reason in error if the file is not a trace of a supported version or ends early.
+bool DPFDecodeTrace(FILE *trace_file, const std::function<void(const std::string &)> &print, std::string &error);
@@ -150,7 +150,8 @@ bool CoreChecks::PreCallValidateCmdBindDescriptorSets(VkCommandBuffer commandBuf
                                                       VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
                                                       const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
                                                       const uint32_t *pDynamicOffsets) const {
-    auto cb_state = GetRead<CMD_BUFFER_STATE>(commandBuffer);
+    EpochGuard epoch;
+    auto cb_state = BorrowRead<CMD_BUFFER_STATE>(epoch, commandBuffer);
     assert(cb_state);
     bool skip = false;
     skip |= ValidateCmd(cb_state.get(), CMD_BINDDESCRIPTORSETS);
@@ -158,9 +159,9 @@ bool CoreChecks::PreCallValidateCmdBindDescriptorSets(VkCommandBuffer commandBuf
     uint32_t total_dynamic_descriptors = 0;
     std::string error_string = "";
 
-    auto pipeline_layout = Get<PIPELINE_LAYOUT_STATE>(layout);
+    auto pipeline_layout = Borrow<PIPELINE_LAYOUT_STATE>(epoch, layout);
     for (uint32_t set_idx = 0; set_idx < setCount; set_idx++) {
-        auto descriptor_set = Get<cvdescriptorset::DescriptorSet>(pDescriptorSets[set_idx]);
+        auto descriptor_set = Borrow<cvdescriptorset::DescriptorSet>(epoch, pDescriptorSets[set_idx]);
         if (descriptor_set) {
             // Verify that set being bound is compatible with overlapping setLayout of pipelineLayout
             if (!VerifySetLayoutCompatibility(*descriptor_set, *pipeline_layout, set_idx + firstSet, error_string)) {
@@ -1700,8 +1701,9 @@ static bool VerifyUpdateConsistency(debug_report_data *report_data, DescriptorSe
 }
 
 // Validate Copy update
-bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const DescriptorSet *dst_set, const DescriptorSet *src_set,
-                                    const char *func_name, std::string *error_code, std::string *error_msg) const {
+bool CoreChecks::ValidateCopyUpdate(const EpochGuard &epoch, const VkCopyDescriptorSet *update, const DescriptorSet *dst_set,
+                                    const DescriptorSet *src_set, const char *func_name, std::string *error_code,
+                                    std::string *error_msg) const {
     const auto *dst_layout = dst_set->GetLayout().get();
     const auto *src_layout = src_set->GetLayout().get();
 
@@ -1987,8 +1989,8 @@ bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const Des
     }
 
     // Update parameters all look good and descriptor updated so verify update contents
-    if (!VerifyCopyUpdateContents(update, src_set, src_type, src_start_idx, dst_set, dst_type, dst_start_idx, func_name, error_code,
-                                  error_msg)) {
+    if (!VerifyCopyUpdateContents(epoch, update, src_set, src_type, src_start_idx, dst_set, dst_type, dst_start_idx, func_name,
+                                  error_code, error_msg)) {
         return false;
     }
 
@@ -1999,9 +2001,10 @@ bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const Des
 // Validate given sampler. Currently this only checks to make sure it exists in the samplerMap
 bool CoreChecks::ValidateSampler(const VkSampler sampler) const { return Get<SAMPLER_STATE>(sampler).get() != nullptr; }
 
-bool CoreChecks::ValidateImageUpdate(VkImageView image_view, VkImageLayout image_layout, VkDescriptorType type,
-                                     const char *func_name, std::string *error_code, std::string *error_msg) const {
-    auto iv_state = Get<IMAGE_VIEW_STATE>(image_view);
+bool CoreChecks::ValidateImageUpdate(const EpochGuard &epoch, VkImageView image_view, VkImageLayout image_layout,
+                                     VkDescriptorType type, const char *func_name, std::string *error_code,
+                                     std::string *error_msg) const {
+    auto iv_state = Borrow<IMAGE_VIEW_STATE>(epoch, image_view);
     assert(iv_state);
 
     // Note that when an imageview is created, we validated that memory is bound so no need to re-check here
@@ -2329,11 +2332,12 @@ bool CoreChecks::ValidateImageUpdate(VkImageView image_view, VkImageLayout image
 // If there is no issue with the update, then false is returned.
 bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                               const VkCopyDescriptorSet *p_cds, const char *func_name) const {
+    EpochGuard epoch;
     bool skip = false;
     // Validate Write updates
     for (uint32_t i = 0; i < write_count; i++) {
         auto dest_set = p_wds[i].dstSet;
-        auto set_node = Get<cvdescriptorset::DescriptorSet>(dest_set);
+        auto set_node = Borrow<cvdescriptorset::DescriptorSet>(epoch, dest_set);
         if (!set_node) {
             skip |= LogError(dest_set, kVUID_Core_DrawState_InvalidDescriptorSet,
                              "Cannot call %s on %s that has not been allocated in pDescriptorWrites[%u].", func_name,
@@ -2341,7 +2345,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
         } else {
             std::string error_code;
             std::string error_str;
-            if (!ValidateWriteUpdate(set_node.get(), &p_wds[i], func_name, &error_code, &error_str, false)) {
+            if (!ValidateWriteUpdate(epoch, set_node, &p_wds[i], func_name, &error_code, &error_str, false)) {
                 skip |=
                     LogError(dest_set, error_code, "%s pDescriptorWrites[%u] failed write update validation for %s with error: %s.",
                              func_name, i, report_data->FormatHandle(dest_set).c_str(), error_str.c_str());
@@ -2351,7 +2355,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
             const auto *pnext_struct = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureKHR>(p_wds[i].pNext);
             if (pnext_struct) {
                 for (uint32_t j = 0; j < pnext_struct->accelerationStructureCount; ++j) {
-                    auto as_state = Get<ACCELERATION_STRUCTURE_STATE_KHR>(pnext_struct->pAccelerationStructures[j]);
+                    auto as_state = Borrow<ACCELERATION_STRUCTURE_STATE_KHR>(epoch, pnext_struct->pAccelerationStructures[j]);
                     if (as_state && (as_state->create_infoKHR.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR &&
                                      (as_state->create_infoKHR.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR &&
                                       as_state->create_infoKHR.type != VK_ACCELERATION_STRUCTURE_TYPE_GENERIC_KHR))) {
@@ -2367,7 +2371,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
             const auto *pnext_struct_nv = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureNV>(p_wds[i].pNext);
             if (pnext_struct_nv) {
                 for (uint32_t j = 0; j < pnext_struct_nv->accelerationStructureCount; ++j) {
-                    auto as_state = Get<ACCELERATION_STRUCTURE_STATE>(pnext_struct_nv->pAccelerationStructures[j]);
+                    auto as_state = Borrow<ACCELERATION_STRUCTURE_STATE>(epoch, pnext_struct_nv->pAccelerationStructures[j]);
                     if (as_state && (as_state->create_infoNV.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV &&
                                      as_state->create_infoNV.info.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_NV)) {
                         skip |= LogError(dest_set, "VUID-VkWriteDescriptorSetAccelerationStructureNV-pAccelerationStructures-03748",
@@ -2384,14 +2388,14 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
     for (uint32_t i = 0; i < copy_count; ++i) {
         auto dst_set = p_cds[i].dstSet;
         auto src_set = p_cds[i].srcSet;
-        auto src_node = Get<cvdescriptorset::DescriptorSet>(src_set);
-        auto dst_node = Get<cvdescriptorset::DescriptorSet>(dst_set);
+        auto src_node = Borrow<cvdescriptorset::DescriptorSet>(epoch, src_set);
+        auto dst_node = Borrow<cvdescriptorset::DescriptorSet>(epoch, dst_set);
         // Object_tracker verifies that src & dest descriptor set are valid
         assert(src_node);
         assert(dst_node);
         std::string error_code;
         std::string error_str;
-        if (!ValidateCopyUpdate(&p_cds[i], dst_node.get(), src_node.get(), func_name, &error_code, &error_str)) {
+        if (!ValidateCopyUpdate(epoch, &p_cds[i], dst_node, src_node, func_name, &error_code, &error_str)) {
             LogObjectList objlist(dst_set);
             objlist.add(src_set);
             skip |= LogError(objlist, error_code, "%s pDescriptorCopies[%u] failed copy update from %s to %s with error: %s.",
@@ -2532,11 +2536,12 @@ std::string cvdescriptorset::DescriptorSet::StringifySetAndLayout() const {
 bool CoreChecks::ValidatePushDescriptorsUpdate(const DescriptorSet *push_set, uint32_t write_count,
                                                const VkWriteDescriptorSet *p_wds, const char *func_name) const {
     assert(push_set->IsPushDescriptor());
+    EpochGuard epoch;
     bool skip = false;
     for (uint32_t i = 0; i < write_count; i++) {
         std::string error_code;
         std::string error_str;
-        if (!ValidateWriteUpdate(push_set, &p_wds[i], func_name, &error_code, &error_str, true)) {
+        if (!ValidateWriteUpdate(epoch, push_set, &p_wds[i], func_name, &error_code, &error_str, true)) {
             skip |= LogError(push_set->GetDescriptorSetLayout(), error_code,
                              "%s VkWriteDescriptorSet[%u] failed update validation: %s.", func_name, i, error_str.c_str());
         }
@@ -2599,19 +2604,19 @@ static bool ValidateBufferUsage(debug_report_data *report_data, BUFFER_STATE con
 //  4. range is either VK_WHOLE_SIZE or falls in (0, (buffer size - offset)]
 //  5. range and offset are within the device's limits
 // If there's an error, update the error_msg string with details and return false, else return true
-bool CoreChecks::ValidateBufferUpdate(VkDescriptorBufferInfo const *buffer_info, VkDescriptorType type, const char *func_name,
-                                      std::string *error_code, std::string *error_msg) const {
+bool CoreChecks::ValidateBufferUpdate(const EpochGuard &epoch, VkDescriptorBufferInfo const *buffer_info, VkDescriptorType type,
+                                      const char *func_name, std::string *error_code, std::string *error_msg) const {
     // First make sure that buffer is valid
-    auto buffer_node = Get<BUFFER_STATE>(buffer_info->buffer);
+    auto buffer_node = Borrow<BUFFER_STATE>(epoch, buffer_info->buffer);
     // Any invalid buffer should already be caught by object_tracker
     assert(buffer_node);
-    if (ValidateMemoryIsBoundToBuffer(buffer_node.get(), func_name, "VUID-VkWriteDescriptorSet-descriptorType-00329")) {
+    if (ValidateMemoryIsBoundToBuffer(buffer_node, func_name, "VUID-VkWriteDescriptorSet-descriptorType-00329")) {
         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00329";
         *error_msg = "No memory bound to buffer.";
         return false;
     }
     // Verify usage bits
-    if (!ValidateBufferUsage(report_data, buffer_node.get(), type, error_code, error_msg)) {
+    if (!ValidateBufferUsage(report_data, buffer_node, type, error_code, error_msg)) {
         // error_msg will have been updated by ValidateBufferUsage()
         return false;
     }
@@ -2706,10 +2711,10 @@ bool CoreChecks::ValidateAccelerationStructureUpdate(T acc_node, const char *fun
 }
 
 // Verify that the contents of the update are ok, but don't perform actual update
-bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, const DescriptorSet *src_set,
-                                          VkDescriptorType src_type, uint32_t src_index, const DescriptorSet *dst_set,
-                                          VkDescriptorType dst_type, uint32_t dst_index, const char *func_name,
-                                          std::string *error_code, std::string *error_msg) const {
+bool CoreChecks::VerifyCopyUpdateContents(const EpochGuard &epoch, const VkCopyDescriptorSet *update,
+                                          const DescriptorSet *src_set, VkDescriptorType src_type, uint32_t src_index,
+                                          const DescriptorSet *dst_set, VkDescriptorType dst_type, uint32_t dst_index,
+                                          const char *func_name, std::string *error_code, std::string *error_msg) const {
     // Note : Repurposing some Write update error codes here as specific details aren't called out for copy updates like they are
     // for write updates
     using DescriptorClass = cvdescriptorset::DescriptorClass;
@@ -2779,7 +2784,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                 auto image_view = img_samp_desc->GetImageView();
                 auto image_layout = img_samp_desc->GetImageLayout();
                 if (image_view) {
-                    if (!ValidateImageUpdate(image_view, image_layout, src_type, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(epoch, image_view, image_layout, src_type, func_name, error_code, error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted copy update to combined image sampler descriptor failed due to: "
                                   << error_msg->c_str();
@@ -2798,7 +2803,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                 auto image_view = img_desc->GetImageView();
                 auto image_layout = img_desc->GetImageLayout();
                 if (image_view) {
-                    if (!ValidateImageUpdate(image_view, image_layout, src_type, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(epoch, image_view, image_layout, src_type, func_name, error_code, error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted copy update to image descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -2824,8 +2829,8 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                         return false;
                     }
                     auto buffer = bv_state->create_info.buffer;
-                    auto buffer_state = Get<BUFFER_STATE>(buffer);
-                    if (!ValidateBufferUsage(report_data, buffer_state.get(), src_type, error_code, error_msg)) {
+                    auto buffer_state = Borrow<BUFFER_STATE>(epoch, buffer);
+                    if (!ValidateBufferUsage(report_data, buffer_state, src_type, error_code, error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted copy update to texel buffer descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -2948,8 +2953,8 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
 
 // Validate the state for a given write update but don't actually perform the update
 //  If an error would occur for this update, return false and fill in details in error_msg string
-bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWriteDescriptorSet *update, const char *func_name,
-                                     std::string *error_code, std::string *error_msg, bool push) const {
+bool CoreChecks::ValidateWriteUpdate(const EpochGuard &epoch, const DescriptorSet *dest_set, const VkWriteDescriptorSet *update,
+                                     const char *func_name, std::string *error_code, std::string *error_msg, bool push) const {
     const auto *dest_layout = dest_set->GetLayout().get();
 
     // Verify dst layout still valid
@@ -3120,7 +3125,7 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
         }
     }
     // Update is within bounds and consistent so last step is to validate update contents
-    if (!VerifyWriteUpdateContents(dest_set, update, start_idx, func_name, error_code, error_msg, push)) {
+    if (!VerifyWriteUpdateContents(epoch, dest_set, update, start_idx, func_name, error_code, error_msg, push)) {
         std::stringstream error_str;
         error_str << "Write update to " << dest_set->StringifySetAndLayout() << " binding #" << update->dstBinding
                   << " failed with error message: " << error_msg->c_str();
@@ -3145,9 +3150,9 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
 }
 
 // Verify that the contents of the update are ok, but don't perform actual update
-bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const VkWriteDescriptorSet *update, const uint32_t index,
-                                           const char *func_name, std::string *error_code, std::string *error_msg,
-                                           bool push) const {
+bool CoreChecks::VerifyWriteUpdateContents(const EpochGuard &epoch, const DescriptorSet *dest_set,
+                                           const VkWriteDescriptorSet *update, const uint32_t index, const char *func_name,
+                                           std::string *error_code, std::string *error_msg, bool push) const {
     using ImageSamplerDescriptor = cvdescriptorset::ImageSamplerDescriptor;
     using Descriptor = cvdescriptorset::Descriptor;
 
@@ -3158,12 +3163,13 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                 auto image_view = update->pImageInfo[di].imageView;
                 auto image_layout = update->pImageInfo[di].imageLayout;
                 auto sampler = update->pImageInfo[di].sampler;
-                auto iv_state = Get<IMAGE_VIEW_STATE>(image_view);
+                auto iv_state = Borrow<IMAGE_VIEW_STATE>(epoch, image_view);
                 const ImageSamplerDescriptor *desc =
                     (const ImageSamplerDescriptor *)dest_set->GetDescriptorFromGlobalIndex(index + di);
                 if (image_view) {
                     const auto *image_state = iv_state->image_state.get();
-                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(epoch, image_view, image_layout, update->descriptorType, func_name, error_code,
+                                             error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to combined image sampler descriptor failed due to: "
                                   << error_msg->c_str();
@@ -3172,7 +3178,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                     }
                     if (IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
                         if (desc->IsImmutableSampler()) {
-                            auto sampler_state = Get<SAMPLER_STATE>(desc->GetSampler());
+                            auto sampler_state = Borrow<SAMPLER_STATE>(epoch, desc->GetSampler());
                             if (iv_state && sampler_state) {
                                 if (iv_state->samplerConversion != sampler_state->samplerConversion) {
                                     *error_code = "VUID-VkWriteDescriptorSet-descriptorType-01948";
@@ -3228,7 +3234,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                     }
 
                     // Verify portability
-                    auto sampler_state = Get<SAMPLER_STATE>(sampler);
+                    auto sampler_state = Borrow<SAMPLER_STATE>(epoch, sampler);
                     if (sampler_state) {
                         if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
                             if ((VK_FALSE == enabled_features.portability_subset_features.mutableComparisonSamplers) &&
@@ -3271,7 +3277,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                 auto image_view = update->pImageInfo[di].imageView;
                 auto image_layout = update->pImageInfo[di].imageLayout;
                 if (image_view) {
-                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(epoch, image_view, image_layout, update->descriptorType, func_name, error_code,
+                                             error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to image descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -3286,7 +3293,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
                 auto buffer_view = update->pTexelBufferView[di];
                 if (buffer_view) {
-                    auto bv_state = Get<BUFFER_VIEW_STATE>(buffer_view);
+                    auto bv_state = Borrow<BUFFER_VIEW_STATE>(epoch, buffer_view);
                     if (!bv_state) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-02994";
                         std::stringstream error_str;
@@ -3296,7 +3303,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                         return false;
                     }
                     auto buffer = bv_state->create_info.buffer;
-                    auto buffer_state = Get<BUFFER_STATE>(buffer);
+                    auto buffer_state = Borrow<BUFFER_STATE>(epoch, buffer);
                     // Verify that buffer underlying the view hasn't been destroyed prematurely
                     if (!buffer_state) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-02994";
@@ -3305,7 +3312,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                                   << report_data->FormatHandle(buffer) << ") has been destroyed: " << error_msg->c_str();
                         *error_msg = error_str.str();
                         return false;
-                    } else if (!ValidateBufferUsage(report_data, buffer_state.get(), update->descriptorType, error_code,
+                    } else if (!ValidateBufferUsage(report_data, buffer_state, update->descriptorType, error_code,
                                                     error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to texel buffer descriptor failed due to: " << error_msg->c_str();
@@ -3322,7 +3329,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
                 if (update->pBufferInfo[di].buffer) {
-                    if (!ValidateBufferUpdate(update->pBufferInfo + di, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!ValidateBufferUpdate(epoch, update->pBufferInfo + di, update->descriptorType, func_name, error_code,
+                                              error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to buffer descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -3337,8 +3345,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
         case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
             const auto *acc_info = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureNV>(update->pNext);
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                auto as_state = Get<ACCELERATION_STRUCTURE_STATE>(acc_info->pAccelerationStructures[di]);
-                if (!ValidateAccelerationStructureUpdate(as_state.get(), func_name, error_code, error_msg)) {
+                auto as_state = Borrow<ACCELERATION_STRUCTURE_STATE>(epoch, acc_info->pAccelerationStructures[di]);
+                if (!ValidateAccelerationStructureUpdate(as_state, func_name, error_code, error_msg)) {
                     std::stringstream error_str;
                     error_str << "Attempted write update to acceleration structure descriptor failed due to: "
                               << error_msg->c_str();
@@ -31,13 +31,11 @@
 #include "layer_options.h"
 #include "layer_chassis_dispatch.h"
 
-small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
+dispatch_key_map<ValidationObject> layer_data_map;
 
-// Global unique object identifier.
-std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+vl_wrapped_handle_map<4, HashedUint64> unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -285,8 +283,15 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
     bool lock_setting;
+    bool slab_handle_setting = false;
+    uint32_t sample_period_setting = 1;
+    uint32_t worker_threads_setting = 0;
+    bool deferred_shader_setting = false;
+    layer_data::unordered_map<std::string, std::string> gpu_settings;
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting, &slab_handle_setting,
+        &sample_period_setting, &worker_threads_setting, &deferred_shader_setting,
+        &gpu_settings};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
@@ -322,6 +327,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     if (local_disables[handle_wrapping]) {
         wrap_handles = false;
     }
+    // The wrapping scheme can only change while no handles are wrapped, so the first instance decides it
+    unique_id_mapping.set_slab_mode(slab_handle_setting);
 
     // Init dispatch array and call registration functions
     bool skip = false;
@@ -345,6 +352,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->disabled = local_disables;
     framework->enabled = local_enables;
     framework->fine_grained_locking = lock_setting;
+    framework->thread_safety_sample_period = sample_period_setting;
+    framework->validation_worker_threads = worker_threads_setting;
+    framework->deferred_shader_validation = deferred_shader_setting;
+    framework->gpu_settings = std::move(gpu_settings);
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -1120,17 +1131,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
     DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
 }
@@ -1143,17 +1154,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -1164,17 +1175,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueWaitIdle]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueWaitIdle(queue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueWaitIdle(queue);
     }
     VkResult result = DispatchQueueWaitIdle(queue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueWaitIdle(queue, result);
     }
     return result;
@@ -1185,17 +1196,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeviceWaitIdle]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeviceWaitIdle(device);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeviceWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDeviceWaitIdle(device);
     }
     VkResult result = DispatchDeviceWaitIdle(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeviceWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDeviceWaitIdle(device, result);
     }
     return result;
@@ -1209,17 +1220,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     }
     VkResult result = DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     }
     return result;
@@ -1232,17 +1243,17 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeMemory(device, memory, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordFreeMemory(device, memory, pAllocator);
     }
     DispatchFreeMemory(device, memory, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordFreeMemory(device, memory, pAllocator);
     }
 }
@@ -1257,17 +1268,17 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMapMemory(device, memory, offset, size, flags, ppData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordMapMemory(device, memory, offset, size, flags, ppData);
     }
     VkResult result = DispatchMapMemory(device, memory, offset, size, flags, ppData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     }
     return result;
@@ -1279,17 +1290,17 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnmapMemory(device, memory);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUnmapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordUnmapMemory(device, memory);
     }
     DispatchUnmapMemory(device, memory);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUnmapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordUnmapMemory(device, memory);
     }
 }
@@ -1301,17 +1312,17 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFlushMappedMemoryRanges]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFlushMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFlushMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1324,17 +1335,17 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInvalidateMappedMemoryRanges]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInvalidateMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInvalidateMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1347,17 +1358,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryCommitment]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryCommitment]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
     DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryCommitment]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
 }
@@ -1370,17 +1381,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory(device, buffer, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
     }
     VkResult result = DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     }
     return result;
@@ -1394,17 +1405,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory(device, image, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindImageMemory(device, image, memory, memoryOffset);
     }
     VkResult result = DispatchBindImageMemory(device, image, memory, memoryOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     }
     return result;
@@ -1417,17 +1428,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
 }
@@ -1439,17 +1450,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements(device, image, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
 }
@@ -1462,17 +1473,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -1512,17 +1523,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBindSparse]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBindSparse]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     }
     VkResult result = DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBindSparse]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
     }
     return result;
@@ -1536,17 +1547,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFence]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFence(device, pCreateInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence);
     }
     VkResult result = DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     }
     return result;
@@ -1559,17 +1570,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFence]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFence(device, fence, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyFence(device, fence, pAllocator);
     }
     DispatchDestroyFence(device, fence, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyFence(device, fence, pAllocator);
     }
 }
@@ -1581,17 +1592,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetFences]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetFences(device, fenceCount, pFences);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordResetFences(device, fenceCount, pFences);
     }
     VkResult result = DispatchResetFences(device, fenceCount, pFences);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordResetFences(device, fenceCount, pFences, result);
     }
     return result;
@@ -1603,17 +1614,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceStatus]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceStatus(device, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetFenceStatus(device, fence);
     }
     VkResult result = DispatchGetFenceStatus(device, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetFenceStatus(device, fence, result);
     }
     return result;
@@ -1628,17 +1639,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForFences]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForFences(device, fenceCount, pFences, waitAll, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitForFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     }
     VkResult result = DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitForFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     }
     return result;
@@ -1652,17 +1663,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSemaphore]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     }
     VkResult result = DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     }
     return result;
@@ -1675,17 +1686,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySemaphore]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySemaphore(device, semaphore, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
     DispatchDestroySemaphore(device, semaphore, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
 }
@@ -1698,17 +1709,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateEvent(device, pCreateInfo, pAllocator, pEvent);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     }
     VkResult result = DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     }
     return result;
@@ -1721,17 +1732,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyEvent(device, event, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyEvent(device, event, pAllocator);
     }
     DispatchDestroyEvent(device, event, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyEvent(device, event, pAllocator);
     }
 }
@@ -1742,17 +1753,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetEventStatus]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetEventStatus(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetEventStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetEventStatus(device, event);
     }
     VkResult result = DispatchGetEventStatus(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetEventStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetEventStatus(device, event, result);
     }
     return result;
@@ -1764,17 +1775,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetEvent(device, event);
     }
     VkResult result = DispatchSetEvent(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetEvent(device, event, result);
     }
     return result;
@@ -1786,17 +1797,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordResetEvent(device, event);
     }
     VkResult result = DispatchResetEvent(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordResetEvent(device, event, result);
     }
     return result;
@@ -1810,17 +1821,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     VkResult result = DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     }
     return result;
@@ -1833,17 +1844,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyQueryPool(device, queryPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
     DispatchDestroyQueryPool(device, queryPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
 }
@@ -1860,17 +1871,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueryPoolResults]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     }
     VkResult result = DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     }
     return result;
@@ -1883,17 +1894,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBuffer(device, buffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
     DispatchDestroyBuffer(device, buffer, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
 }
@@ -1906,17 +1917,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -1929,17 +1940,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferView(device, bufferView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
     DispatchDestroyBufferView(device, bufferView, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
 }
@@ -1952,17 +1963,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImage(device, pCreateInfo, pAllocator, pImage);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     VkResult result = DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     }
     return result;
@@ -1975,17 +1986,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImage(device, image, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyImage(device, image, pAllocator);
     }
     DispatchDestroyImage(device, image, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyImage(device, image, pAllocator);
     }
 }
@@ -1998,17 +2009,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout(device, image, pSubresource, pLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSubresourceLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSubresourceLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
 }
@@ -2021,17 +2032,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImageView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -2044,17 +2055,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImageView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImageView(device, imageView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyImageView(device, imageView, pAllocator);
     }
     DispatchDestroyImageView(device, imageView, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyImageView(device, imageView, pAllocator);
     }
 }
@@ -2066,17 +2077,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderModule]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyShaderModule(device, shaderModule, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyShaderModule]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
     DispatchDestroyShaderModule(device, shaderModule, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyShaderModule]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
 }
@@ -2089,17 +2100,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineCache]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     }
     VkResult result = DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     }
     return result;
@@ -2112,17 +2123,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineCache]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineCache(device, pipelineCache, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
     DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
 }
@@ -2135,17 +2146,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineCacheData]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineCacheData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     }
     VkResult result = DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineCacheData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     }
     return result;
@@ -2159,17 +2170,17 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMergePipelineCaches]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMergePipelineCaches]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     }
     VkResult result = DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMergePipelineCaches]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     }
     return result;
@@ -2182,17 +2193,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipeline]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipeline(device, pipeline, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
     DispatchDestroyPipeline(device, pipeline, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
 }
@@ -2204,17 +2215,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineLayout(device, pipelineLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
     DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
 }
@@ -2227,17 +2238,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSampler]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     }
     VkResult result = DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     }
     return result;
@@ -2250,17 +2261,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySampler]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySampler(device, sampler, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroySampler(device, sampler, pAllocator);
     }
     DispatchDestroySampler(device, sampler, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroySampler(device, sampler, pAllocator);
     }
 }
@@ -2273,17 +2284,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorSetLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     }
     VkResult result = DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     }
     return result;
@@ -2296,17 +2307,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorSetLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
     DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
 }
@@ -2319,17 +2330,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     }
     VkResult result = DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     }
     return result;
@@ -2342,17 +2353,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorPool(device, descriptorPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
     DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
 }
@@ -2364,17 +2375,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetDescriptorPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetDescriptorPool(device, descriptorPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordResetDescriptorPool(device, descriptorPool, flags);
     }
     VkResult result = DispatchResetDescriptorPool(device, descriptorPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordResetDescriptorPool(device, descriptorPool, flags, result);
     }
     return result;
@@ -2388,17 +2399,17 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeDescriptorSets]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     }
     VkResult result = DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets, result);
     }
     return result;
@@ -2413,17 +2424,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
     DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
 }
@@ -2436,17 +2447,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFramebuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     }
     VkResult result = DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     }
     return result;
@@ -2459,17 +2470,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFramebuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFramebuffer(device, framebuffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
     DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
 }
@@ -2482,17 +2493,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -2505,17 +2516,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyRenderPass(device, renderPass, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
     DispatchDestroyRenderPass(device, renderPass, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
 }
@@ -2527,17 +2538,17 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRenderAreaGranularity]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRenderAreaGranularity(device, renderPass, pGranularity);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRenderAreaGranularity]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
     DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRenderAreaGranularity]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
 }
@@ -2550,17 +2561,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     }
     VkResult result = DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     }
     return result;
@@ -2573,17 +2584,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCommandPool(device, commandPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
     DispatchDestroyCommandPool(device, commandPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
 }
@@ -2595,17 +2606,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandPool(device, commandPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordResetCommandPool(device, commandPool, flags);
     }
     VkResult result = DispatchResetCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordResetCommandPool(device, commandPool, flags, result);
     }
     return result;
@@ -2618,17 +2629,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateCommandBuffers]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     }
     VkResult result = DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     }
     return result;
@@ -2642,17 +2653,17 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeCommandBuffers]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
     DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
 }
@@ -2663,17 +2674,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     VkResult result = DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     }
     return result;
@@ -2684,17 +2695,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEndCommandBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEndCommandBuffer(commandBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEndCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordEndCommandBuffer(commandBuffer);
     }
     VkResult result = DispatchEndCommandBuffer(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEndCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordEndCommandBuffer(commandBuffer, result);
     }
     return result;
@@ -2706,17 +2717,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandBuffer(commandBuffer, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordResetCommandBuffer(commandBuffer, flags);
     }
     VkResult result = DispatchResetCommandBuffer(commandBuffer, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     }
     return result;
@@ -2729,17 +2740,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
     DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
 }
@@ -2752,17 +2763,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
     DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
 }
@@ -2775,17 +2786,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissor]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
     DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissor]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
 }
@@ -2796,17 +2807,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineWidth]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
     DispatchCmdSetLineWidth(commandBuffer, lineWidth);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineWidth]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
 }
@@ -2819,17 +2830,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBias]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
     DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBias]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
 }
@@ -2840,17 +2851,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetBlendConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
     DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetBlendConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
 }
@@ -2862,17 +2873,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBounds]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
     DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBounds]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
 }
@@ -2884,17 +2895,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilCompareMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
     DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilCompareMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
 }
@@ -2906,17 +2917,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilWriteMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
     DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilWriteMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
 }
@@ -2928,17 +2939,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilReference]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
     DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilReference]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
 }
@@ -2955,17 +2966,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
     DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 }
@@ -2978,17 +2989,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindIndexBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
     DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindIndexBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
 }
@@ -3002,17 +3013,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
     DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
 }
@@ -3026,17 +3037,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDraw]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
     DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDraw]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
 }
@@ -3051,17 +3062,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexed]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
     DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexed]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 }
@@ -3075,17 +3086,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3099,17 +3110,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3122,17 +3133,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatch]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatch]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3144,17 +3155,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
     DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
 }
@@ -3168,17 +3179,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3194,17 +3205,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3221,17 +3232,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
     DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
 }
@@ -3246,17 +3257,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3271,17 +3282,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3295,17 +3306,17 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdUpdateBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
     DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdUpdateBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
 }
@@ -3319,17 +3330,17 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdFillBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
     DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdFillBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
 }
@@ -3344,17 +3355,17 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearColorImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
     DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearColorImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
 }
@@ -3369,17 +3380,17 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearDepthStencilImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
     DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearDepthStencilImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
 }
@@ -3393,17 +3404,17 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearAttachments]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearAttachments]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
 }
@@ -3419,17 +3430,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3441,17 +3452,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdSetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3463,17 +3474,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3493,17 +3504,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3522,17 +3533,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3545,17 +3556,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
     DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
 }
@@ -3567,17 +3578,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
     DispatchCmdEndQuery(commandBuffer, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
 }
@@ -3590,17 +3601,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
     DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
 }
@@ -3613,17 +3624,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
     DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
 }
@@ -3640,17 +3651,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
     DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
 }
@@ -3665,17 +3676,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
     DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
 }
@@ -3687,17 +3698,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
     DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
 }
@@ -3708,17 +3719,17 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass(commandBuffer, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents);
     }
     DispatchCmdNextSubpass(commandBuffer, contents);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents);
     }
 }
@@ -3728,17 +3739,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndRenderPass(commandBuffer);
     }
     DispatchCmdEndRenderPass(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndRenderPass(commandBuffer);
     }
 }
@@ -3750,17 +3761,17 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteCommands]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
     DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteCommands]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
 }
@@ -3773,17 +3784,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3796,17 +3807,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3821,17 +3832,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -3842,17 +3853,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
 }
@@ -3868,17 +3879,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBase]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBase]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3913,17 +3924,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -3935,17 +3946,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -3958,17 +3969,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -4133,17 +4144,17 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPool(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordTrimCommandPool(device, commandPool, flags);
     }
     DispatchTrimCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordTrimCommandPool(device, commandPool, flags);
     }
 }
@@ -4155,17 +4166,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue2(device, pQueueInfo, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
     DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
 }
@@ -4178,17 +4189,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversion]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -4201,17 +4212,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversion]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
 }
@@ -4224,17 +4235,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplate]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -4247,17 +4258,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -4270,17 +4281,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -4358,17 +4369,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupport]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
 }
@@ -4385,17 +4396,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4411,17 +4422,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4434,17 +4445,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -4457,17 +4468,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -4479,17 +4490,17 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -4500,17 +4511,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -4523,17 +4534,17 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPool(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -4545,17 +4556,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValue]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValue(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSemaphoreCounterValue(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     }
     return result;
@@ -4568,17 +4579,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphores]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphores(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphores]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordWaitSemaphores(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphores(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphores]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -4590,17 +4601,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphore]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphore(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSignalSemaphore(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphore(device, pSignalInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     }
     return result;
@@ -4612,17 +4623,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddress]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferDeviceAddress(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferDeviceAddress(device, pInfo, result);
     }
     return result;
@@ -4634,17 +4645,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4656,17 +4667,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4704,17 +4715,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlot]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     }
     VkResult result = DispatchCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot, result);
     }
     return result;
@@ -4727,17 +4738,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlot]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
     }
     DispatchDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
     }
 }
@@ -4751,17 +4762,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateData]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
     }
     VkResult result = DispatchSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetPrivateData(device, objectType, objectHandle, privateDataSlot, data, result);
     }
     return result;
@@ -4776,17 +4787,17 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateData]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
     }
     DispatchGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
     }
 }
@@ -4798,17 +4809,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent2(commandBuffer, event, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo);
     }
     DispatchCmdSetEvent2(commandBuffer, event, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo);
     }
 }
@@ -4820,17 +4831,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent2(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdResetEvent2(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent2(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdResetEvent2(commandBuffer, event, stageMask);
     }
 }
@@ -4843,17 +4854,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
     DispatchCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
 }
@@ -4864,17 +4875,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
     }
     DispatchCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
     }
 }
@@ -4887,17 +4898,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
     }
     DispatchCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
     }
 }
@@ -4910,17 +4921,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit2(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit2(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -4932,17 +4943,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
     }
     DispatchCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
     }
 }
@@ -4953,17 +4964,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage2(commandBuffer, pCopyImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo);
     }
     DispatchCmdCopyImage2(commandBuffer, pCopyImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo);
     }
 }
@@ -4974,17 +4985,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
     }
     DispatchCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
     }
 }
@@ -4995,17 +5006,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
     }
     DispatchCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
     }
 }
@@ -5016,17 +5027,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage2(commandBuffer, pBlitImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo);
     }
     DispatchCmdBlitImage2(commandBuffer, pBlitImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo);
     }
 }
@@ -5037,17 +5048,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage2(commandBuffer, pResolveImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo);
     }
     DispatchCmdResolveImage2(commandBuffer, pResolveImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo);
     }
 }
@@ -5058,17 +5069,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRendering]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRendering(commandBuffer, pRenderingInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo);
     }
     DispatchCmdBeginRendering(commandBuffer, pRenderingInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo);
     }
 }
@@ -5078,17 +5089,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRendering(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRendering]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRendering(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndRendering(commandBuffer);
     }
     DispatchCmdEndRendering(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndRendering(commandBuffer);
     }
 }
@@ -5099,17 +5110,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullMode]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCullMode(commandBuffer, cullMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullMode]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetCullMode(commandBuffer, cullMode);
     }
     DispatchCmdSetCullMode(commandBuffer, cullMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullMode]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetCullMode(commandBuffer, cullMode);
     }
 }
@@ -5120,17 +5131,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFace]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFrontFace(commandBuffer, frontFace);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFace]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetFrontFace(commandBuffer, frontFace);
     }
     DispatchCmdSetFrontFace(commandBuffer, frontFace);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFace]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetFrontFace(commandBuffer, frontFace);
     }
 }
@@ -5141,17 +5152,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopology]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopology]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
     }
     DispatchCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopology]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
     }
 }
@@ -5163,17 +5174,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
     }
     DispatchCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
     }
 }
@@ -5185,17 +5196,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
     }
     DispatchCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
     }
 }
@@ -5211,17 +5222,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
     DispatchCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
 }
@@ -5232,17 +5243,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
     }
     DispatchCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
     }
 }
@@ -5253,17 +5264,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
     }
     DispatchCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
     }
 }
@@ -5274,17 +5285,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOp]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
     }
     DispatchCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
     }
 }
@@ -5295,17 +5306,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
     }
     DispatchCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
     }
 }
@@ -5316,17 +5327,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
     }
     DispatchCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
     }
 }
@@ -5341,17 +5352,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOp]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
     DispatchCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
 }
@@ -5362,17 +5373,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizerDiscardEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizerDiscardEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
     }
     DispatchCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizerDiscardEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
     }
 }
@@ -5383,17 +5394,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBiasEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
     }
     DispatchCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBiasEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
     }
 }
@@ -5404,17 +5415,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveRestartEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveRestartEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
     }
     DispatchCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveRestartEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
     }
 }
@@ -5426,17 +5437,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceBufferMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
 }
@@ -5448,17 +5459,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
 }
@@ -5471,17 +5482,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageSparseMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -5613,17 +5624,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSwapchainKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     }
     VkResult result = DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     }
     return result;
@@ -5636,17 +5647,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySwapchainKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySwapchainKHR(device, swapchain, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
     DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
 }
@@ -5659,17 +5670,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainImagesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainImagesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     }
     VkResult result = DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainImagesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     }
     return result;
@@ -5685,17 +5696,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImageKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImageKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImageKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     }
     return result;
@@ -5707,17 +5718,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueuePresentKHR(queue, pPresentInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueuePresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo);
     }
     VkResult result = DispatchQueuePresentKHR(queue, pPresentInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueuePresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     }
     return result;
@@ -5729,17 +5740,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupPresentCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     }
     VkResult result = DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     }
     return result;
@@ -5752,17 +5763,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     }
     return result;
@@ -5799,17 +5810,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     }
     return result;
@@ -5993,17 +6004,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSharedSwapchainsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSharedSwapchainsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     }
     VkResult result = DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSharedSwapchainsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     }
     return result;
@@ -6295,17 +6306,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateVideoSessionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
     }
     VkResult result = DispatchCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession, result);
     }
     return result;
@@ -6318,17 +6329,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyVideoSessionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyVideoSessionKHR(device, videoSession, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyVideoSessionKHR(device, videoSession, pAllocator);
     }
     DispatchDestroyVideoSessionKHR(device, videoSession, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyVideoSessionKHR(device, videoSession, pAllocator);
     }
 }
@@ -6341,17 +6352,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetVideoSessionMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetVideoSessionMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetVideoSessionMemoryRequirementsKHR(device, videoSession, pVideoSessionMemoryRequirementsCount, pVideoSessionMemoryRequirements);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetVideoSessionMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetVideoSessionMemoryRequirementsKHR(device, videoSession, pVideoSessionMemoryRequirementsCount, pVideoSessionMemoryRequirements);
     }
     VkResult result = DispatchGetVideoSessionMemoryRequirementsKHR(device, videoSession, pVideoSessionMemoryRequirementsCount, pVideoSessionMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetVideoSessionMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetVideoSessionMemoryRequirementsKHR(device, videoSession, pVideoSessionMemoryRequirementsCount, pVideoSessionMemoryRequirements, result);
     }
     return result;
@@ -6365,17 +6376,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindVideoSessionMemoryKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindVideoSessionMemoryKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindVideoSessionMemoryKHR(device, videoSession, videoSessionBindMemoryCount, pVideoSessionBindMemories);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindVideoSessionMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindVideoSessionMemoryKHR(device, videoSession, videoSessionBindMemoryCount, pVideoSessionBindMemories);
     }
     VkResult result = DispatchBindVideoSessionMemoryKHR(device, videoSession, videoSessionBindMemoryCount, pVideoSessionBindMemories);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindVideoSessionMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindVideoSessionMemoryKHR(device, videoSession, videoSessionBindMemoryCount, pVideoSessionBindMemories, result);
     }
     return result;
@@ -6389,17 +6400,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateVideoSessionParametersKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
     }
     VkResult result = DispatchCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters, result);
     }
     return result;
@@ -6412,17 +6423,17 @@ VKAPI_ATTR VkResult VKAPI_CALL UpdateVideoSessionParametersKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateVideoSessionParametersKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
     }
     VkResult result = DispatchUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo, result);
     }
     return result;
@@ -6435,17 +6446,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionParametersKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyVideoSessionParametersKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
     }
     DispatchDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
     }
 }
@@ -6456,17 +6467,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginVideoCodingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
     }
     DispatchCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
     }
 }
@@ -6477,17 +6488,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndVideoCodingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
     }
     DispatchCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
     }
 }
@@ -6498,17 +6509,17 @@ VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdControlVideoCodingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdControlVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
     }
     DispatchCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdControlVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
     }
 }
@@ -6522,17 +6533,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecodeVideoKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDecodeVideoKHR(commandBuffer, pFrameInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDecodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDecodeVideoKHR(commandBuffer, pFrameInfo);
     }
     DispatchCmdDecodeVideoKHR(commandBuffer, pFrameInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDecodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDecodeVideoKHR(commandBuffer, pFrameInfo);
     }
 }
@@ -6545,17 +6556,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
     }
     DispatchCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
     }
 }
@@ -6565,17 +6576,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderingKHR(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndRenderingKHR(commandBuffer);
     }
     DispatchCmdEndRenderingKHR(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndRenderingKHR(commandBuffer);
     }
 }
@@ -6745,17 +6756,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -6766,17 +6777,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMaskKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMaskKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
 }
@@ -6792,17 +6803,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBaseKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBaseKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -6816,17 +6827,17 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPoolKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPoolKHR(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPoolKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
     DispatchTrimCommandPoolKHR(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPoolKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
 }
@@ -6888,17 +6899,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -6912,17 +6923,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     }
     VkResult result = DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     }
     return result;
@@ -6937,17 +6948,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -6961,17 +6972,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdPropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     }
     VkResult result = DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     }
     return result;
@@ -7012,17 +7023,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     }
     VkResult result = DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     }
     return result;
@@ -7035,17 +7046,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -7059,17 +7070,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     }
     VkResult result = DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     }
     return result;
@@ -7082,17 +7093,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -7109,17 +7120,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
     DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
 }
@@ -7133,17 +7144,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
     DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
 }
@@ -7160,17 +7171,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -7183,17 +7194,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -7206,17 +7217,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -7231,17 +7242,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -7254,17 +7265,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -7276,17 +7287,17 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -7297,17 +7308,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -7319,17 +7330,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainStatusKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainStatusKHR(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainStatusKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSwapchainStatusKHR(device, swapchain);
     }
     VkResult result = DispatchGetSwapchainStatusKHR(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainStatusKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     }
     return result;
@@ -7367,17 +7378,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     }
     VkResult result = DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     }
     return result;
@@ -7390,17 +7401,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -7414,17 +7425,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceFdKHR(device, pImportFenceFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordImportFenceFdKHR(device, pImportFenceFdInfo);
     }
     VkResult result = DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     }
     return result;
@@ -7437,17 +7448,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -7507,17 +7518,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireProfilingLockKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireProfilingLockKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordAcquireProfilingLockKHR(device, pInfo);
     }
     VkResult result = DispatchAcquireProfilingLockKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     }
     return result;
@@ -7528,17 +7539,17 @@ VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseProfilingLockKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseProfilingLockKHR(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordReleaseProfilingLockKHR(device);
     }
     DispatchReleaseProfilingLockKHR(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordReleaseProfilingLockKHR(device);
     }
 }
@@ -7698,17 +7709,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -7720,17 +7731,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -7743,17 +7754,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -7768,17 +7779,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -7791,17 +7802,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
 }
@@ -7814,17 +7825,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -7837,17 +7848,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -7864,17 +7875,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
 }
@@ -7891,17 +7902,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7917,17 +7928,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7949,17 +7960,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValueKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValueKHR(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValueKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValueKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     }
     return result;
@@ -7972,17 +7983,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphoresKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphoresKHR(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphoresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphoresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -7994,17 +8005,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphoreKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphoreKHR(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphoreKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSignalSemaphoreKHR(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphoreKHR(device, pSignalInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphoreKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     }
     return result;
@@ -8043,17 +8054,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     }
     DispatchCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     }
 }
@@ -8070,17 +8081,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForPresentKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForPresentKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForPresentKHR(device, swapchain, presentId, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitForPresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordWaitForPresentKHR(device, swapchain, presentId, timeout);
     }
     VkResult result = DispatchWaitForPresentKHR(device, swapchain, presentId, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitForPresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordWaitForPresentKHR(device, swapchain, presentId, timeout, result);
     }
     return result;
@@ -8094,17 +8105,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -8116,17 +8127,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -8138,17 +8149,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -8162,17 +8173,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDeferredOperationKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     }
     VkResult result = DispatchCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation, result);
     }
     return result;
@@ -8185,17 +8196,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDeferredOperationKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDeferredOperationKHR(device, operation, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
     DispatchDestroyDeferredOperationKHR(device, operation, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
 }
@@ -8206,17 +8217,17 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationMaxConcurrencyKHR(device, operation);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     uint32_t result = DispatchGetDeferredOperationMaxConcurrencyKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     return result;
@@ -8228,17 +8239,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationResultKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationResultKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationResultKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeferredOperationResultKHR(device, operation);
     }
     VkResult result = DispatchGetDeferredOperationResultKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationResultKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeferredOperationResultKHR(device, operation, result);
     }
     return result;
@@ -8250,17 +8261,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoinKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeferredOperationJoinKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeferredOperationJoinKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeferredOperationJoinKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDeferredOperationJoinKHR(device, operation);
     }
     VkResult result = DispatchDeferredOperationJoinKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeferredOperationJoinKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDeferredOperationJoinKHR(device, operation, result);
     }
     return result;
@@ -8275,17 +8286,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     }
     VkResult result = DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     }
     return result;
@@ -8299,17 +8310,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     }
     VkResult result = DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     }
     return result;
@@ -8323,17 +8334,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     }
     VkResult result = DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     }
     return result;
@@ -8351,17 +8362,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEncodeVideoKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEncodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
     }
     DispatchCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEncodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
     }
 }
@@ -8375,17 +8386,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
     }
     DispatchCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
     }
 }
@@ -8397,17 +8408,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent2KHR(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent2KHR(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask);
     }
 }
@@ -8420,17 +8431,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
     DispatchCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
 }
@@ -8441,17 +8452,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
     }
     DispatchCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
     }
 }
@@ -8464,17 +8475,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
     }
     DispatchCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
     }
 }
@@ -8487,17 +8498,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -8512,17 +8523,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarker2AMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarker2AMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarker2AMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
     }
 }
@@ -8534,17 +8545,17 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointData2NV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointData2NV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueueCheckpointData2NV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueueCheckpointData2NV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
     }
 }
@@ -8559,17 +8570,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
     DispatchCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
 }
@@ -8580,17 +8591,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
     DispatchCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
 }
@@ -8601,17 +8612,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
     DispatchCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
 }
@@ -8622,17 +8633,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
     DispatchCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
 }
@@ -8643,17 +8654,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
     DispatchCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
 }
@@ -8664,17 +8675,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
     DispatchCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
 }
@@ -8687,17 +8698,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirect2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirect2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
     }
     DispatchCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirect2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
     }
 }
@@ -8711,17 +8722,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceBufferMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceBufferMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceBufferMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -8733,17 +8744,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -8756,17 +8767,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageSparseMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageSparseMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageSparseMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -8860,17 +8871,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -8882,18 +8893,18 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);
     VkResult result = DispatchDebugMarkerSetObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -8905,17 +8916,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerBeginEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerBeginEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -8925,17 +8936,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerEndEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
     DispatchCmdDebugMarkerEndEXT(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerEndEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
 }
@@ -8946,17 +8957,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerInsertEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerInsertEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -8974,17 +8985,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
     DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
 }
@@ -8998,17 +9009,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -9022,17 +9033,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndTransformFeedbackEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -9046,17 +9057,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
     DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
 }
@@ -9069,17 +9080,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
     DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
 }
@@ -9095,17 +9106,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
     DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
 }
@@ -9119,17 +9130,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuModuleNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
     }
     VkResult result = DispatchCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule, result);
     }
     return result;
@@ -9143,17 +9154,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuFunctionNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
     }
     VkResult result = DispatchCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction, result);
     }
     return result;
@@ -9166,17 +9177,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuModuleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuModuleNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCuModuleNVX(device, module, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyCuModuleNVX(device, module, pAllocator);
     }
     DispatchDestroyCuModuleNVX(device, module, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyCuModuleNVX(device, module, pAllocator);
     }
 }
@@ -9188,17 +9199,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuFunctionNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuFunctionNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCuFunctionNVX(device, function, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyCuFunctionNVX(device, function, pAllocator);
     }
     DispatchDestroyCuFunctionNVX(device, function, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyCuFunctionNVX(device, function, pAllocator);
     }
 }
@@ -9209,17 +9220,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCuLaunchKernelNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCuLaunchKernelNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
     }
     DispatchCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCuLaunchKernelNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
     }
 }
@@ -9231,17 +9242,17 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewHandleNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewHandleNVX(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewHandleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     uint32_t result = DispatchGetImageViewHandleNVX(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewHandleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     return result;
@@ -9254,17 +9265,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewAddressNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewAddressNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewAddressNVX(device, imageView, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewAddressNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageViewAddressNVX(device, imageView, pProperties);
     }
     VkResult result = DispatchGetImageViewAddressNVX(device, imageView, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewAddressNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageViewAddressNVX(device, imageView, pProperties, result);
     }
     return result;
@@ -9282,17 +9293,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9308,17 +9319,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9347,17 +9358,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderInfoAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetShaderInfoAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     }
     VkResult result = DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetShaderInfoAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     }
     return result;
@@ -9433,17 +9444,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     }
     return result;
@@ -9492,17 +9503,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
     DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
 }
@@ -9512,17 +9523,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndConditionalRenderingEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
     DispatchCmdEndConditionalRenderingEXT(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
 }
@@ -9536,17 +9547,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
     DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
 }
@@ -9656,17 +9667,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDisplayPowerControlEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDisplayPowerControlEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     }
     VkResult result = DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDisplayPowerControlEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo, result);
     }
     return result;
@@ -9680,17 +9691,17 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDeviceEventEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDeviceEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDeviceEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -9705,17 +9716,17 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDisplayEventEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDisplayEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDisplayEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -9729,17 +9740,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainCounterEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainCounterEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     }
     VkResult result = DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainCounterEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     }
     return result;
@@ -9753,17 +9764,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     }
     VkResult result = DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     }
     return result;
@@ -9777,17 +9788,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     }
     VkResult result = DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     }
     return result;
@@ -9807,17 +9818,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
     DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
 }
@@ -9834,17 +9845,17 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetHdrMetadataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetHdrMetadataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
     DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetHdrMetadataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
 }
@@ -9912,18 +9923,18 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);
     VkResult result = DispatchSetDebugUtilsObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -9935,17 +9946,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -9957,18 +9968,18 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -9978,18 +9989,18 @@ VKAPI_ATTR void VKAPI_CALL QueueEndDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueEndDebugUtilsLabelEXT(queue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
     DispatchQueueEndDebugUtilsLabelEXT(queue);
     EndQueueDebugUtilsLabel(layer_data->report_data, queue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
 }
@@ -10000,18 +10011,18 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -10022,17 +10033,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -10042,17 +10053,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
     DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
 }
@@ -10063,17 +10074,17 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -10158,17 +10169,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     }
     VkResult result = DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     }
     return result;
@@ -10181,17 +10192,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     }
     VkResult result = DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     }
     return result;
@@ -10211,17 +10222,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
     DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
 }
@@ -10262,17 +10273,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     }
     VkResult result = DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties, result);
     }
     return result;
@@ -10289,17 +10300,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindShadingRateImageNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindShadingRateImageNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
 }
@@ -10312,17 +10323,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
     DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
 }
@@ -10335,17 +10346,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
     DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
 }
@@ -10359,17 +10370,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -10382,17 +10393,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
 }
@@ -10404,17 +10415,17 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -10426,17 +10437,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindAccelerationStructureMemoryNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindAccelerationStructureMemoryNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindAccelerationStructureMemoryNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -10455,17 +10466,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
     DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
 }
@@ -10478,17 +10489,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
     DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
 }
@@ -10512,17 +10523,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
     DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
 }
@@ -10537,17 +10548,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -10563,17 +10574,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -10587,17 +10598,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureHandleNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureHandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     }
     VkResult result = DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureHandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     }
     return result;
@@ -10613,17 +10624,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -10635,17 +10646,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCompileDeferredNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCompileDeferredNV(device, pipeline, shader);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCompileDeferredNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCompileDeferredNV(device, pipeline, shader);
     }
     VkResult result = DispatchCompileDeferredNV(device, pipeline, shader);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCompileDeferredNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     }
     return result;
@@ -10664,17 +10675,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     }
     VkResult result = DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     }
     return result;
@@ -10690,17 +10701,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarkerAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarkerAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
 }
@@ -10739,17 +10750,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetCalibratedTimestampsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     }
     VkResult result = DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetCalibratedTimestampsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     }
     return result;
@@ -10775,17 +10786,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
     DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
 }
@@ -10799,17 +10810,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -10825,17 +10836,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -10851,17 +10862,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExclusiveScissorNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
     DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExclusiveScissorNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
 }
@@ -10873,17 +10884,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCheckpointNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
     DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCheckpointNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
 }
@@ -10895,17 +10906,17 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointDataNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueueCheckpointDataNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueueCheckpointDataNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
 }
@@ -10918,17 +10929,17 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInitializePerformanceApiINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInitializePerformanceApiINTEL(device, pInitializeInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo);
     }
     VkResult result = DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     }
     return result;
@@ -10939,17 +10950,17 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUninitializePerformanceApiINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUninitializePerformanceApiINTEL(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUninitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordUninitializePerformanceApiINTEL(device);
     }
     DispatchUninitializePerformanceApiINTEL(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUninitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordUninitializePerformanceApiINTEL(device);
     }
 }
@@ -10960,17 +10971,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -10982,17 +10993,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -11004,17 +11015,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     }
     VkResult result = DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     }
     return result;
@@ -11027,17 +11038,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     }
     VkResult result = DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     }
     return result;
@@ -11049,17 +11060,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleasePerformanceConfigurationINTEL(device, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordReleasePerformanceConfigurationINTEL(device, configuration);
     }
     VkResult result = DispatchReleasePerformanceConfigurationINTEL(device, configuration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     }
     return result;
@@ -11071,17 +11082,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSetPerformanceConfigurationINTEL(queue, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration);
     }
     VkResult result = DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     }
     return result;
@@ -11094,17 +11105,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPerformanceParameterINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPerformanceParameterINTEL(device, parameter, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPerformanceParameterINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPerformanceParameterINTEL(device, parameter, pValue);
     }
     VkResult result = DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPerformanceParameterINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     }
     return result;
@@ -11119,17 +11130,17 @@ VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLocalDimmingAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetLocalDimmingAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
     DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetLocalDimmingAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
 }
@@ -11206,17 +11217,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressEXT(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferDeviceAddressEXT(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressEXT(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferDeviceAddressEXT(device, pInfo, result);
     }
     return result;
@@ -11308,17 +11319,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -11330,17 +11341,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -11353,17 +11364,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     }
     return result;
@@ -11403,17 +11414,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
     DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
 }
@@ -11428,17 +11439,17 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPoolEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPoolEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPoolEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -11451,17 +11462,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCullModeEXT(commandBuffer, cullMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
     DispatchCmdSetCullModeEXT(commandBuffer, cullMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
 }
@@ -11472,17 +11483,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFrontFaceEXT(commandBuffer, frontFace);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFaceEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
     DispatchCmdSetFrontFaceEXT(commandBuffer, frontFace);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFaceEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
 }
@@ -11493,17 +11504,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
     DispatchCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
 }
@@ -11515,17 +11526,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCountEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
     DispatchCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
 }
@@ -11537,17 +11548,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
     DispatchCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
 }
@@ -11563,17 +11574,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
     DispatchCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
 }
@@ -11584,17 +11595,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
     DispatchCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
 }
@@ -11605,17 +11616,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
     DispatchCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
 }
@@ -11626,17 +11637,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
     DispatchCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
 }
@@ -11647,17 +11658,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
     DispatchCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
 }
@@ -11668,17 +11679,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
     DispatchCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
 }
@@ -11693,17 +11704,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
     DispatchCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
 }
@@ -11718,17 +11729,17 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -11739,17 +11750,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
     DispatchCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
 }
@@ -11761,17 +11772,17 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
     DispatchCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
 }
@@ -11784,17 +11795,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
     DispatchCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
 }
@@ -11807,17 +11818,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     }
     VkResult result = DispatchCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     }
     return result;
@@ -11830,17 +11841,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
     DispatchDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
 }
@@ -11909,17 +11920,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlotEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     }
     VkResult result = DispatchCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot, result);
     }
     return result;
@@ -11932,17 +11943,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlotEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
     DispatchDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
 }
@@ -11956,17 +11967,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     }
     VkResult result = DispatchSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data, result);
     }
     return result;
@@ -11981,17 +11992,17 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
     DispatchGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
 }
@@ -12009,17 +12020,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateEnumNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateEnumNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     }
     DispatchCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateEnumNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     }
 }
@@ -12038,17 +12049,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout2EXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSubresourceLayout2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSubresourceLayout2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
     }
 }
@@ -12165,17 +12176,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetVertexInputEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetVertexInputEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
     }
     DispatchCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetVertexInputEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
     }
 }
@@ -12192,17 +12203,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryZirconHandleFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryZirconHandleFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     }
     VkResult result = DispatchGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle, result);
     }
     return result;
@@ -12216,17 +12227,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryZirconHandlePropertiesFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryZirconHandlePropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
     }
     VkResult result = DispatchGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties, result);
     }
     return result;
@@ -12241,17 +12252,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreZirconHandleFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
     }
     VkResult result = DispatchImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo, result);
     }
     return result;
@@ -12264,17 +12275,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreZirconHandleFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     }
     VkResult result = DispatchGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle, result);
     }
     return result;
@@ -12291,17 +12302,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferCollectionFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
     }
     VkResult result = DispatchCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection, result);
     }
     return result;
@@ -12314,17 +12325,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionImageConstraintsFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetBufferCollectionImageConstraintsFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetBufferCollectionImageConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
     }
     VkResult result = DispatchSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetBufferCollectionImageConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo, result);
     }
     return result;
@@ -12337,17 +12348,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionBufferConstraintsFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetBufferCollectionBufferConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
     }
     VkResult result = DispatchSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo, result);
     }
     return result;
@@ -12360,17 +12371,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferCollectionFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferCollectionFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
     }
     DispatchDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
     }
 }
@@ -12382,17 +12393,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetBufferCollectionPropertiesFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferCollectionPropertiesFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferCollectionPropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
     }
     VkResult result = DispatchGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferCollectionPropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties, result);
     }
     return result;
@@ -12407,17 +12418,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
     }
     VkResult result = DispatchGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize, result);
     }
     return result;
@@ -12428,17 +12439,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSubpassShadingHUAWEI]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSubpassShadingHUAWEI(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSubpassShadingHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSubpassShadingHUAWEI(commandBuffer);
     }
     DispatchCmdSubpassShadingHUAWEI(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSubpassShadingHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSubpassShadingHUAWEI(commandBuffer);
     }
 }
@@ -12451,17 +12462,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindInvocationMaskHUAWEI(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindInvocationMaskHUAWEI]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindInvocationMaskHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindInvocationMaskHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
     }
 }
@@ -12474,17 +12485,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryRemoteAddressNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryRemoteAddressNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryRemoteAddressNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
     }
     VkResult result = DispatchGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryRemoteAddressNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress, result);
     }
     return result;
@@ -12498,17 +12509,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelinePropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelinePropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelinePropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
     }
     VkResult result = DispatchGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelinePropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties, result);
     }
     return result;
@@ -12521,17 +12532,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPatchControlPointsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPatchControlPointsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
     }
     DispatchCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPatchControlPointsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
     }
 }
@@ -12542,17 +12553,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizerDiscardEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizerDiscardEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
     }
     DispatchCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizerDiscardEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
     }
 }
@@ -12563,17 +12574,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBiasEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
     }
     DispatchCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBiasEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
     }
 }
@@ -12584,17 +12595,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLogicOpEXT(commandBuffer, logicOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLogicOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp);
     }
     DispatchCmdSetLogicOpEXT(commandBuffer, logicOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLogicOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp);
     }
 }
@@ -12605,17 +12616,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveRestartEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveRestartEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
     }
     DispatchCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveRestartEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
     }
 }
@@ -12678,17 +12689,17 @@ VKAPI_ATTR void                                    VKAPI_CALL CmdSetColorWriteEn
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
     }
     DispatchCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
     }
 }
@@ -12707,17 +12718,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMultiEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
     }
     DispatchCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMultiEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
     }
 }
@@ -12733,17 +12744,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiIndexedEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMultiIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
     }
     DispatchCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMultiIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
     }
 }
@@ -12759,17 +12770,17 @@ VKAPI_ATTR void VKAPI_CALL SetDeviceMemoryPriorityEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDeviceMemoryPriorityEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDeviceMemoryPriorityEXT(device, memory, priority);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDeviceMemoryPriorityEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordSetDeviceMemoryPriorityEXT(device, memory, priority);
     }
     DispatchSetDeviceMemoryPriorityEXT(device, memory, priority);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDeviceMemoryPriorityEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordSetDeviceMemoryPriorityEXT(device, memory, priority);
     }
 }
@@ -12782,17 +12793,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutHostMappingInfoVALVE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
     }
     DispatchGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
     }
 }
@@ -12804,17 +12815,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetHostMappingVALVE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetHostMappingVALVE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetHostMappingVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
     }
     DispatchGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetHostMappingVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
     }
 }
@@ -12833,17 +12844,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -12856,17 +12867,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
 }
@@ -12879,17 +12890,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     }
     DispatchCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     }
 }
@@ -12904,17 +12915,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresIndirectKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     }
     DispatchCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     }
 }
@@ -12928,17 +12939,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildAccelerationStructuresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
     }
     VkResult result = DispatchBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos, result);
     }
     return result;
@@ -12951,17 +12962,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCopyAccelerationStructureKHR(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -12974,17 +12985,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -12997,17 +13008,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -13024,17 +13035,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     }
     VkResult result = DispatchWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride, result);
     }
     return result;
@@ -13046,17 +13057,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
 }
@@ -13067,17 +13078,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
 }
@@ -13088,17 +13099,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
 }
@@ -13109,17 +13120,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetAccelerationStructureDeviceAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -13135,17 +13146,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -13157,17 +13168,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     }
     DispatchGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     }
 }
@@ -13181,17 +13192,17 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureBuildSizesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureBuildSizesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     }
     DispatchGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureBuildSizesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     }
 }
@@ -13209,17 +13220,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
     DispatchCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
 }
@@ -13234,17 +13245,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -13260,17 +13271,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     }
     DispatchCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     }
 }
@@ -13283,17 +13294,17 @@ VKAPI_ATTR VkDeviceSize VKAPI_CALL GetRayTracingShaderGroupStackSizeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupStackSizeKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     }
     VkDeviceSize result = DispatchGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     }
     return result;
@@ -13305,17 +13316,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRayTracingPipelineStackSizeKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->InterceptReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PreCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     }
     DispatchCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->InterceptWriteLock();
         intercept->PostCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     }
 }
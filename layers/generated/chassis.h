@@ -52,8 +52,6 @@
 #include "vk_typemap_helper.h"
 
 
-extern std::atomic<uint64_t> global_unique_id;
-
 // To avoid re-hashing unique ids on each use, we precompute the hash and store the
 // hash's LSBs in the high 24 bits.
 struct HashedUint64 {
@@ -67,7 +65,7 @@ struct HashedUint64 {
     }
 };
 
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vl_wrapped_handle_map<4, HashedUint64> unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -3535,6 +3533,13 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{true};
+        uint32_t thread_safety_sample_period{1};
+        // Object uses of this instance or device that were checked by thread safety validation while sampling
+        std::atomic<uint64_t> thread_safety_sampled_uses{0};
+        uint32_t validation_worker_threads{0};
+        bool deferred_shader_validation{false};
+        // GPU-AV and Debug Printf settings given through VkLayerSettingsEXT, by their settings file key
+        layer_data::unordered_map<std::string, std::string> gpu_settings;
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -3565,6 +3570,16 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Set by InitObjectDispatchVectors() for objects whose ReadLock()/WriteLock() never take validation_object_mutex
+        // (i.e. those relying on fine_grained_locking), so the generated intercepts can skip the virtual lock calls.
+        bool intercept_lock_elided{false};
+        ReadLockGuard InterceptReadLock() {
+            return intercept_lock_elided ? ReadLockGuard() : ReadLock();
+        }
+        WriteLockGuard InterceptWriteLock() {
+            return intercept_lock_elided ? WriteLockGuard() : WriteLock();
+        }
+
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
             if (vo_enabled) {
@@ -3579,6 +3594,10 @@ class ValidationObject {
             enabled = framework->enabled;
             disabled = framework->disabled;
             fine_grained_locking = framework->fine_grained_locking;
+            thread_safety_sample_period = framework->thread_safety_sample_period;
+            validation_worker_threads = framework->validation_worker_threads;
+            deferred_shader_validation = framework->deferred_shader_validation;
+            gpu_settings = framework->gpu_settings;
             instance = inst;
         }
 
@@ -3594,6 +3613,10 @@ class ValidationObject {
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
                 fine_grained_locking = inst_obj->fine_grained_locking;
+                thread_safety_sample_period = inst_obj->thread_safety_sample_period;
+                validation_worker_threads = inst_obj->validation_worker_threads;
+                deferred_shader_validation = inst_obj->deferred_shader_validation;
+                gpu_settings = inst_obj->gpu_settings;
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -3776,26 +3799,19 @@ class ValidationObject {
         // Unwrap a handle.
         template <typename HandleType>
         HandleType Unwrap(HandleType wrappedHandle) {
-            auto iter = unique_id_mapping.find(reinterpret_cast<uint64_t const &>(wrappedHandle));
-            if (iter == unique_id_mapping.end())
-                return (HandleType)0;
-            return (HandleType)iter->second;
+            return (HandleType)unique_id_mapping.Unwrap(reinterpret_cast<uint64_t const &>(wrappedHandle));
         }
 
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -5643,4 +5659,4 @@ class ValidationObject {
         };
 };
 
-extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
+extern dispatch_key_map<ValidationObject> layer_data_map;
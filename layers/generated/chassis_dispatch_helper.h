@@ -2790,5 +2790,10 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRayTracingPipelineStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRayTracingPipelineStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRayTracingPipelineStackSizeKHR);
+    // ReadLock()/WriteLock() are fixed once the device is created, so probe them once here rather than making two virtual
+    // calls per intercept per API call.
+    for (auto item : this->object_dispatch) {
+        item->intercept_lock_elided = !item->ReadLock().owns_lock() && !item->WriteLock().owns_lock();
+    }
 };
 
@@ -0,0 +1,414 @@
+#include <stdint.h>
+#pragma once
+
+// This file is ***GENERATED***.  Do Not Edit.
+/* Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author: Tony Barbour <tony@lunarg.com>
+ */
+
+#if 0
+./layers/gpu_compact_output_shader.comp
+// Module Version 10000
+// Generated by (magic number): 8000a
+// Id's are bound by 114
+
+                              Capability Shader
+               1:             ExtInstImport  "GLSL.std.450"
+                              MemoryModel Logical GLSL450
+                              EntryPoint GLCompute 4  "main" 10
+                              ExecutionMode 4 LocalSize 64 1 1
+                              Source GLSL 450
+                              Name 4  "main"
+                              Name 37  "i"
+                              Name 10  "gl_GlobalInvocationID"
+                              Name 13  "ufoo"
+                              MemberName 13(ufoo) 0  "first_entry"
+                              MemberName 13(ufoo) 1  "entry_count"
+                              MemberName 13(ufoo) 2  "block_words"
+                              Name 15  "u_info"
+                              Name 38  "entry"
+                              Name 39  "block"
+                              Name 23  "TableBuffer"
+                              MemberName 23(TableBuffer) 0  "data"
+                              Name 25  "Table"
+                              Name 40  "words"
+                              Name 28  "BlockBuffer"
+                              MemberName 28(BlockBuffer) 0  "data"
+                              Name 30  "Blocks"
+                              Name 41  "out_idx"
+                              Name 34  "CompactBuffer"
+                              MemberName 34(CompactBuffer) 0  "count"
+                              MemberName 34(CompactBuffer) 1  "data"
+                              Name 36  "Compact"
+                              Name 42  "w"
+                              Decorate 10(gl_GlobalInvocationID) BuiltIn GlobalInvocationId
+                              MemberDecorate 13(ufoo) 0 Offset 0
+                              MemberDecorate 13(ufoo) 1 Offset 4
+                              MemberDecorate 13(ufoo) 2 Offset 8
+                              Decorate 13(ufoo) Block
+                              Decorate 22 ArrayStride 4
+                              MemberDecorate 23(TableBuffer) 0 Offset 0
+                              Decorate 23(TableBuffer) BufferBlock
+                              Decorate 25(Table) DescriptorSet 0
+                              Decorate 25(Table) Binding 1
+                              Decorate 27 ArrayStride 4
+                              MemberDecorate 28(BlockBuffer) 0 Offset 0
+                              Decorate 28(BlockBuffer) BufferBlock
+                              Decorate 30(Blocks) DescriptorSet 0
+                              Decorate 30(Blocks) Binding 0
+                              Decorate 33 ArrayStride 4
+                              MemberDecorate 34(CompactBuffer) 0 Offset 0
+                              MemberDecorate 34(CompactBuffer) 1 Offset 4
+                              Decorate 34(CompactBuffer) BufferBlock
+                              Decorate 36(Compact) DescriptorSet 0
+                              Decorate 36(Compact) Binding 2
+               2:             TypeVoid
+               3:             TypeFunction 2
+               6:             TypeInt 32 0
+               7:             TypePointer Function 6(int)
+               8:             TypeVector 6(int) 3
+               9:             TypePointer Input 8(ivec3)
+10(gl_GlobalInvocationID):      9(ptr) Variable Input
+              11:      6(int) Constant 0
+              12:             TypePointer Input 6(int)
+        13(ufoo):             TypeStruct 6(int) 6(int) 6(int)
+              14:             TypePointer PushConstant 13(ufoo)
+      15(u_info):     14(ptr) Variable PushConstant
+              16:             TypeInt 32 1
+              17:     16(int) Constant 1
+              18:             TypePointer PushConstant 6(int)
+              19:             TypeBool
+              20:     16(int) Constant 0
+              21:      6(int) Constant 2
+              22:             TypeRuntimeArray 6(int)
+ 23(TableBuffer):             TypeStruct 22
+              24:             TypePointer Uniform 23(TableBuffer)
+       25(Table):     24(ptr) Variable Uniform
+              26:             TypePointer Uniform 6(int)
+              27:             TypeRuntimeArray 6(int)
+ 28(BlockBuffer):             TypeStruct 27
+              29:             TypePointer Uniform 28(BlockBuffer)
+      30(Blocks):     29(ptr) Variable Uniform
+              31:     16(int) Constant 2
+              32:      6(int) Constant 1
+              33:             TypeRuntimeArray 6(int)
+34(CompactBuffer):             TypeStruct 6(int) 33
+              35:             TypePointer Uniform 34(CompactBuffer)
+     36(Compact):     35(ptr) Variable Uniform
+         4(main):           2 Function None 3
+               5:             Label
+           37(i):      7(ptr) Variable Function
+       38(entry):      7(ptr) Variable Function
+       39(block):      7(ptr) Variable Function
+       40(words):      7(ptr) Variable Function
+     41(out_idx):      7(ptr) Variable Function
+           42(w):      7(ptr) Variable Function
+              43:     12(ptr) AccessChain 10(gl_GlobalInvocationID) 11
+              44:      6(int) Load 43
+                              Store 37(i) 44
+              45:      6(int) Load 37(i)
+              46:     18(ptr) AccessChain 15(u_info) 17
+              47:      6(int) Load 46
+              48:    19(bool) UGreaterThanEqual 45 47
+                              SelectionMerge 50 None
+                              BranchConditional 48 49 50
+              49:             Label
+                              Return
+              50:             Label
+              51:     18(ptr) AccessChain 15(u_info) 20
+              52:      6(int) Load 51
+              53:      6(int) Load 37(i)
+              54:      6(int) IAdd 52 53
+              55:      6(int) IMul 54 21
+                              Store 38(entry) 55
+              56:      6(int) Load 38(entry)
+              57:     26(ptr) AccessChain 25(Table) 20 56
+              58:      6(int) Load 57
+                              Store 39(block) 58
+              59:      6(int) Load 39(block)
+              60:     26(ptr) AccessChain 30(Blocks) 20 59
+              61:      6(int) Load 60
+              62:     18(ptr) AccessChain 15(u_info) 31
+              63:      6(int) Load 62
+              64:      6(int) ISub 63 32
+              65:      6(int) ExtInst 1(GLSL.std.450) 38(UMin) 61 64
+                              Store 40(words) 65
+              66:      6(int) Load 40(words)
+              67:    19(bool) IEqual 66 11
+                              SelectionMerge 69 None
+                              BranchConditional 67 68 69
+              68:             Label
+                              Return
+              69:             Label
+              70:      6(int) Load 40(words)
+              71:      6(int) IAdd 70 21
+              72:     26(ptr) AccessChain 36(Compact) 20
+              73:      6(int) AtomicIAdd 72 32 11 71
+                              Store 41(out_idx) 73
+              74:      6(int) Load 41(out_idx)
+              75:      6(int) Load 40(words)
+              76:      6(int) IAdd 74 75
+              77:      6(int) IAdd 76 21
+              78:      6(int) ArrayLength 36(Compact) 1
+              79:    19(bool) UGreaterThan 77 78
+                              SelectionMerge 81 None
+                              BranchConditional 79 80 81
+              80:             Label
+                              Return
+              81:             Label
+              82:      6(int) Load 41(out_idx)
+              83:      6(int) Load 38(entry)
+              84:      6(int) IAdd 83 32
+              85:     26(ptr) AccessChain 25(Table) 20 84
+              86:      6(int) Load 85
+              87:     26(ptr) AccessChain 36(Compact) 17 82
+                              Store 87 86
+              88:      6(int) Load 41(out_idx)
+              89:      6(int) IAdd 88 32
+              90:      6(int) Load 40(words)
+              91:     26(ptr) AccessChain 36(Compact) 17 89
+                              Store 91 90
+                              Store 42(w) 32
+                              Branch 92
+              92:             Label
+                              LoopMerge 111 108 None
+                              Branch 93
+              93:             Label
+              94:      6(int) Load 42(w)
+              95:      6(int) Load 40(words)
+              96:    19(bool) ULessThanEqual 94 95
+                              BranchConditional 96 97 111
+              97:             Label
+              98:      6(int) Load 41(out_idx)
+              99:      6(int) IAdd 98 32
+             100:      6(int) Load 42(w)
+             101:      6(int) IAdd 99 100
+             102:      6(int) Load 39(block)
+             103:      6(int) Load 42(w)
+             104:      6(int) IAdd 102 103
+             105:     26(ptr) AccessChain 30(Blocks) 20 104
+             106:      6(int) Load 105
+             107:     26(ptr) AccessChain 36(Compact) 17 101
+                              Store 107 106
+                              Branch 108
+             108:             Label
+             109:      6(int) Load 42(w)
+             110:      6(int) IAdd 109 32
+                              Store 42(w) 110
+                              Branch 92
+             111:             Label
+             112:      6(int) Load 39(block)
+             113:     26(ptr) AccessChain 30(Blocks) 20 112
+                              Store 113 11
+                              Return
+                              FunctionEnd
+#endif
+
+static const uint32_t gpu_compact_output_shader_comp[761] = {
+    0x07230203, 0x00010000, 0x0008000a, 0x00000072,
+    0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e,
+    0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d,
+    0x00000000, 0x0000000a, 0x00060010, 0x00000004,
+    0x00000011, 0x00000040, 0x00000001, 0x00000001,
+    0x00030003, 0x00000002, 0x000001c2, 0x00040005,
+    0x00000004, 0x6e69616d, 0x00000000, 0x00030005,
+    0x00000025, 0x00000069, 0x00080005, 0x0000000a,
+    0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f,
+    0x496e6f69, 0x00000044, 0x00040005, 0x0000000d,
+    0x6f6f6675, 0x00000000, 0x00060006, 0x0000000d,
+    0x00000000, 0x73726966, 0x6e655f74, 0x00797274,
+    0x00060006, 0x0000000d, 0x00000001, 0x72746e65,
+    0x6f635f79, 0x00746e75, 0x00060006, 0x0000000d,
+    0x00000002, 0x636f6c62, 0x6f775f6b, 0x00736472,
+    0x00040005, 0x0000000f, 0x6e695f75, 0x00006f66,
+    0x00040005, 0x00000026, 0x72746e65, 0x00000079,
+    0x00040005, 0x00000027, 0x636f6c62, 0x0000006b,
+    0x00050005, 0x00000017, 0x6c626154, 0x66754265,
+    0x00726566, 0x00050006, 0x00000017, 0x00000000,
+    0x61746164, 0x00000000, 0x00040005, 0x00000019,
+    0x6c626154, 0x00000065, 0x00040005, 0x00000028,
+    0x64726f77, 0x00000073, 0x00050005, 0x0000001c,
+    0x636f6c42, 0x6675426b, 0x00726566, 0x00050006,
+    0x0000001c, 0x00000000, 0x61746164, 0x00000000,
+    0x00040005, 0x0000001e, 0x636f6c42, 0x0000736b,
+    0x00040005, 0x00000029, 0x5f74756f, 0x00786469,
+    0x00060005, 0x00000022, 0x706d6f43, 0x42746361,
+    0x65666675, 0x00000072, 0x00050006, 0x00000022,
+    0x00000000, 0x6e756f63, 0x00000074, 0x00050006,
+    0x00000022, 0x00000001, 0x61746164, 0x00000000,
+    0x00040005, 0x00000024, 0x706d6f43, 0x00746361,
+    0x00030005, 0x0000002a, 0x00000077, 0x00040047,
+    0x0000000a, 0x0000000b, 0x0000001c, 0x00050048,
+    0x0000000d, 0x00000000, 0x00000023, 0x00000000,
+    0x00050048, 0x0000000d, 0x00000001, 0x00000023,
+    0x00000004, 0x00050048, 0x0000000d, 0x00000002,
+    0x00000023, 0x00000008, 0x00030047, 0x0000000d,
+    0x00000002, 0x00040047, 0x00000016, 0x00000006,
+    0x00000004, 0x00050048, 0x00000017, 0x00000000,
+    0x00000023, 0x00000000, 0x00030047, 0x00000017,
+    0x00000003, 0x00040047, 0x00000019, 0x00000022,
+    0x00000000, 0x00040047, 0x00000019, 0x00000021,
+    0x00000001, 0x00040047, 0x0000001b, 0x00000006,
+    0x00000004, 0x00050048, 0x0000001c, 0x00000000,
+    0x00000023, 0x00000000, 0x00030047, 0x0000001c,
+    0x00000003, 0x00040047, 0x0000001e, 0x00000022,
+    0x00000000, 0x00040047, 0x0000001e, 0x00000021,
+    0x00000000, 0x00040047, 0x00000021, 0x00000006,
+    0x00000004, 0x00050048, 0x00000022, 0x00000000,
+    0x00000023, 0x00000000, 0x00050048, 0x00000022,
+    0x00000001, 0x00000023, 0x00000004, 0x00030047,
+    0x00000022, 0x00000003, 0x00040047, 0x00000024,
+    0x00000022, 0x00000000, 0x00040047, 0x00000024,
+    0x00000021, 0x00000002, 0x00020013, 0x00000002,
+    0x00030021, 0x00000003, 0x00000002, 0x00040015,
+    0x00000006, 0x00000020, 0x00000000, 0x00040020,
+    0x00000007, 0x00000007, 0x00000006, 0x00040017,
+    0x00000008, 0x00000006, 0x00000003, 0x00040020,
+    0x00000009, 0x00000001, 0x00000008, 0x0004003b,
+    0x00000009, 0x0000000a, 0x00000001, 0x0004002b,
+    0x00000006, 0x0000000b, 0x00000000, 0x00040020,
+    0x0000000c, 0x00000001, 0x00000006, 0x0005001e,
+    0x0000000d, 0x00000006, 0x00000006, 0x00000006,
+    0x00040020, 0x0000000e, 0x00000009, 0x0000000d,
+    0x0004003b, 0x0000000e, 0x0000000f, 0x00000009,
+    0x00040015, 0x00000010, 0x00000020, 0x00000001,
+    0x0004002b, 0x00000010, 0x00000011, 0x00000001,
+    0x00040020, 0x00000012, 0x00000009, 0x00000006,
+    0x00020014, 0x00000013, 0x0004002b, 0x00000010,
+    0x00000014, 0x00000000, 0x0004002b, 0x00000006,
+    0x00000015, 0x00000002, 0x0003001d, 0x00000016,
+    0x00000006, 0x0003001e, 0x00000017, 0x00000016,
+    0x00040020, 0x00000018, 0x00000002, 0x00000017,
+    0x0004003b, 0x00000018, 0x00000019, 0x00000002,
+    0x00040020, 0x0000001a, 0x00000002, 0x00000006,
+    0x0003001d, 0x0000001b, 0x00000006, 0x0003001e,
+    0x0000001c, 0x0000001b, 0x00040020, 0x0000001d,
+    0x00000002, 0x0000001c, 0x0004003b, 0x0000001d,
+    0x0000001e, 0x00000002, 0x0004002b, 0x00000010,
+    0x0000001f, 0x00000002, 0x0004002b, 0x00000006,
+    0x00000020, 0x00000001, 0x0003001d, 0x00000021,
+    0x00000006, 0x0004001e, 0x00000022, 0x00000006,
+    0x00000021, 0x00040020, 0x00000023, 0x00000002,
+    0x00000022, 0x0004003b, 0x00000023, 0x00000024,
+    0x00000002, 0x00050036, 0x00000002, 0x00000004,
+    0x00000000, 0x00000003, 0x000200f8, 0x00000005,
+    0x0004003b, 0x00000007, 0x00000025, 0x00000007,
+    0x0004003b, 0x00000007, 0x00000026, 0x00000007,
+    0x0004003b, 0x00000007, 0x00000027, 0x00000007,
+    0x0004003b, 0x00000007, 0x00000028, 0x00000007,
+    0x0004003b, 0x00000007, 0x00000029, 0x00000007,
+    0x0004003b, 0x00000007, 0x0000002a, 0x00000007,
+    0x00050041, 0x0000000c, 0x0000002b, 0x0000000a,
+    0x0000000b, 0x0004003d, 0x00000006, 0x0000002c,
+    0x0000002b, 0x0003003e, 0x00000025, 0x0000002c,
+    0x0004003d, 0x00000006, 0x0000002d, 0x00000025,
+    0x00050041, 0x00000012, 0x0000002e, 0x0000000f,
+    0x00000011, 0x0004003d, 0x00000006, 0x0000002f,
+    0x0000002e, 0x000500ae, 0x00000013, 0x00000030,
+    0x0000002d, 0x0000002f, 0x000300f7, 0x00000032,
+    0x00000000, 0x000400fa, 0x00000030, 0x00000031,
+    0x00000032, 0x000200f8, 0x00000031, 0x000100fd,
+    0x000200f8, 0x00000032, 0x00050041, 0x00000012,
+    0x00000033, 0x0000000f, 0x00000014, 0x0004003d,
+    0x00000006, 0x00000034, 0x00000033, 0x0004003d,
+    0x00000006, 0x00000035, 0x00000025, 0x00050080,
+    0x00000006, 0x00000036, 0x00000034, 0x00000035,
+    0x00050084, 0x00000006, 0x00000037, 0x00000036,
+    0x00000015, 0x0003003e, 0x00000026, 0x00000037,
+    0x0004003d, 0x00000006, 0x00000038, 0x00000026,
+    0x00060041, 0x0000001a, 0x00000039, 0x00000019,
+    0x00000014, 0x00000038, 0x0004003d, 0x00000006,
+    0x0000003a, 0x00000039, 0x0003003e, 0x00000027,
+    0x0000003a, 0x0004003d, 0x00000006, 0x0000003b,
+    0x00000027, 0x00060041, 0x0000001a, 0x0000003c,
+    0x0000001e, 0x00000014, 0x0000003b, 0x0004003d,
+    0x00000006, 0x0000003d, 0x0000003c, 0x00050041,
+    0x00000012, 0x0000003e, 0x0000000f, 0x0000001f,
+    0x0004003d, 0x00000006, 0x0000003f, 0x0000003e,
+    0x00050082, 0x00000006, 0x00000040, 0x0000003f,
+    0x00000020, 0x0007000c, 0x00000006, 0x00000041,
+    0x00000001, 0x00000026, 0x0000003d, 0x00000040,
+    0x0003003e, 0x00000028, 0x00000041, 0x0004003d,
+    0x00000006, 0x00000042, 0x00000028, 0x000500aa,
+    0x00000013, 0x00000043, 0x00000042, 0x0000000b,
+    0x000300f7, 0x00000045, 0x00000000, 0x000400fa,
+    0x00000043, 0x00000044, 0x00000045, 0x000200f8,
+    0x00000044, 0x000100fd, 0x000200f8, 0x00000045,
+    0x0004003d, 0x00000006, 0x00000046, 0x00000028,
+    0x00050080, 0x00000006, 0x00000047, 0x00000046,
+    0x00000015, 0x00050041, 0x0000001a, 0x00000048,
+    0x00000024, 0x00000014, 0x000700ea, 0x00000006,
+    0x00000049, 0x00000048, 0x00000020, 0x0000000b,
+    0x00000047, 0x0003003e, 0x00000029, 0x00000049,
+    0x0004003d, 0x00000006, 0x0000004a, 0x00000029,
+    0x0004003d, 0x00000006, 0x0000004b, 0x00000028,
+    0x00050080, 0x00000006, 0x0000004c, 0x0000004a,
+    0x0000004b, 0x00050080, 0x00000006, 0x0000004d,
+    0x0000004c, 0x00000015, 0x00050044, 0x00000006,
+    0x0000004e, 0x00000024, 0x00000001, 0x000500ac,
+    0x00000013, 0x0000004f, 0x0000004d, 0x0000004e,
+    0x000300f7, 0x00000051, 0x00000000, 0x000400fa,
+    0x0000004f, 0x00000050, 0x00000051, 0x000200f8,
+    0x00000050, 0x000100fd, 0x000200f8, 0x00000051,
+    0x0004003d, 0x00000006, 0x00000052, 0x00000029,
+    0x0004003d, 0x00000006, 0x00000053, 0x00000026,
+    0x00050080, 0x00000006, 0x00000054, 0x00000053,
+    0x00000020, 0x00060041, 0x0000001a, 0x00000055,
+    0x00000019, 0x00000014, 0x00000054, 0x0004003d,
+    0x00000006, 0x00000056, 0x00000055, 0x00060041,
+    0x0000001a, 0x00000057, 0x00000024, 0x00000011,
+    0x00000052, 0x0003003e, 0x00000057, 0x00000056,
+    0x0004003d, 0x00000006, 0x00000058, 0x00000029,
+    0x00050080, 0x00000006, 0x00000059, 0x00000058,
+    0x00000020, 0x0004003d, 0x00000006, 0x0000005a,
+    0x00000028, 0x00060041, 0x0000001a, 0x0000005b,
+    0x00000024, 0x00000011, 0x00000059, 0x0003003e,
+    0x0000005b, 0x0000005a, 0x0003003e, 0x0000002a,
+    0x00000020, 0x000200f9, 0x0000005c, 0x000200f8,
+    0x0000005c, 0x000400f6, 0x0000006f, 0x0000006c,
+    0x00000000, 0x000200f9, 0x0000005d, 0x000200f8,
+    0x0000005d, 0x0004003d, 0x00000006, 0x0000005e,
+    0x0000002a, 0x0004003d, 0x00000006, 0x0000005f,
+    0x00000028, 0x000500b2, 0x00000013, 0x00000060,
+    0x0000005e, 0x0000005f, 0x000400fa, 0x00000060,
+    0x00000061, 0x0000006f, 0x000200f8, 0x00000061,
+    0x0004003d, 0x00000006, 0x00000062, 0x00000029,
+    0x00050080, 0x00000006, 0x00000063, 0x00000062,
+    0x00000020, 0x0004003d, 0x00000006, 0x00000064,
+    0x0000002a, 0x00050080, 0x00000006, 0x00000065,
+    0x00000063, 0x00000064, 0x0004003d, 0x00000006,
+    0x00000066, 0x00000027, 0x0004003d, 0x00000006,
+    0x00000067, 0x0000002a, 0x00050080, 0x00000006,
+    0x00000068, 0x00000066, 0x00000067, 0x00060041,
+    0x0000001a, 0x00000069, 0x0000001e, 0x00000014,
+    0x00000068, 0x0004003d, 0x00000006, 0x0000006a,
+    0x00000069, 0x00060041, 0x0000001a, 0x0000006b,
+    0x00000024, 0x00000011, 0x00000065, 0x0003003e,
+    0x0000006b, 0x0000006a, 0x000200f9, 0x0000006c,
+    0x000200f8, 0x0000006c, 0x0004003d, 0x00000006,
+    0x0000006d, 0x0000002a, 0x00050080, 0x00000006,
+    0x0000006e, 0x0000006d, 0x00000020, 0x0003003e,
+    0x0000002a, 0x0000006e, 0x000200f9, 0x0000005c,
+    0x000200f8, 0x0000006f, 0x0004003d, 0x00000006,
+    0x00000070, 0x00000027, 0x00060041, 0x0000001a,
+    0x00000071, 0x0000001e, 0x00000014, 0x00000070,
+    0x0003003e, 0x00000071, 0x0000000b, 0x000100fd,
+    0x00010038,
+};
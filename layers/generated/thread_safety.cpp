@@ -541,6 +541,12 @@ void ThreadSafety::PostCallRecordDestroyDevice(
     const VkAllocationCallbacks*                pAllocator) {
     FinishWriteObjectParentInstance(device, "vkDestroyDevice");
     DestroyObjectParentInstance(device);
+    if (thread_safety_sample_period > 1) {
+        LogInfo(device, kVUID_Threading_Info,
+                "vkDestroyDevice(): %" PRIu64 " uses of objects of this device were checked for thread safety, sampling "
+                "1 in every %" PRIu32 " uses per thread.",
+                thread_safety_sampled_uses.load(std::memory_order_relaxed), thread_safety_sample_period);
+    }
     // Host access to device must be externally synchronized
     auto lock = WriteLockGuard(thread_safety_lock);
     for (auto &queue : device_queues_map[device]) {
@@ -23,7 +23,10 @@
 #include "spirv-tools/optimizer.hpp"
 #include "spirv-tools/instrument.hpp"
 #include <spirv/unified1/spirv.hpp>
+#include <generated/spirv_tools_commit_id.h>
+#include "xxhash.h"
 #include <algorithm>
+#include <cstring>
 #include <regex>
 
 #define VMA_IMPLEMENTATION
@@ -58,7 +61,6 @@ VkResult UtilDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescripto
     auto guard = Lock();
     const uint32_t default_pool_size = kItemsPerChunk;
     VkResult result = VK_SUCCESS;
-    VkDescriptorPool pool_to_use = VK_NULL_HANDLE;
 
     assert(count > 0);
     if (0 == count) {
@@ -67,13 +69,14 @@ VkResult UtilDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescripto
     desc_sets->clear();
     desc_sets->resize(count);
 
-    for (auto &pool : desc_pool_map_) {
-        if (pool.second.used + count < pool.second.size) {
-            pool_to_use = pool.first;
-            break;
-        }
+    auto &free_sets = free_desc_sets_[ds_layout];
+    // All of the sets returned have to come from the one pool reported back to the caller
+    bool need_pool = free_sets.size() < count;
+    for (uint32_t i = 1; !need_pool && i < count; i++) {
+        need_pool = free_sets[free_sets.size() - 1 - i].pool != free_sets.back().pool;
     }
-    if (VK_NULL_HANDLE == pool_to_use) {
+    if (need_pool) {
+        VkDescriptorPool new_pool = VK_NULL_HANDLE;
         uint32_t pool_count = default_pool_size;
         if (count > default_pool_size) {
             pool_count = count;
@@ -87,26 +90,34 @@ VkResult UtilDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescripto
         desc_pool_info.maxSets = pool_count;
         desc_pool_info.poolSizeCount = 1;
         desc_pool_info.pPoolSizes = &size_counts;
-        result = DispatchCreateDescriptorPool(device, &desc_pool_info, NULL, &pool_to_use);
+        result = DispatchCreateDescriptorPool(device, &desc_pool_info, NULL, &new_pool);
         assert(result == VK_SUCCESS);
         if (result != VK_SUCCESS) {
             return result;
         }
-        desc_pool_map_[pool_to_use].size = desc_pool_info.maxSets;
-        desc_pool_map_[pool_to_use].used = 0;
+        desc_pool_map_[new_pool].size = desc_pool_info.maxSets;
+        desc_pool_map_[new_pool].layout = ds_layout;
+
+        // Fill the whole pool at once, later requests for this layout just take sets from free_sets
+        std::vector<VkDescriptorSetLayout> desc_layouts(pool_count, ds_layout);
+        std::vector<VkDescriptorSet> new_sets(pool_count);
+        VkDescriptorSetAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, NULL, new_pool, pool_count,
+                                                  desc_layouts.data()};
+        result = DispatchAllocateDescriptorSets(device, &alloc_info, new_sets.data());
+        assert(result == VK_SUCCESS);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        for (auto set = new_sets.rbegin(); set != new_sets.rend(); ++set) {
+            free_sets.push_back({new_pool, *set});
+        }
     }
-    std::vector<VkDescriptorSetLayout> desc_layouts(count, ds_layout);
-
-    VkDescriptorSetAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, NULL, pool_to_use, count,
-                                              desc_layouts.data()};
 
-    result = DispatchAllocateDescriptorSets(device, &alloc_info, desc_sets->data());
-    assert(result == VK_SUCCESS);
-    if (result != VK_SUCCESS) {
-        return result;
+    for (uint32_t i = 0; i < count; i++) {
+        (*desc_sets)[i] = free_sets.back().set;
+        *pool = free_sets.back().pool;
+        free_sets.pop_back();
     }
-    *pool = pool_to_use;
-    desc_pool_map_[pool_to_use].used += count;
     return result;
 }
 
@@ -114,18 +125,237 @@ void UtilDescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool,
     auto guard = Lock();
     auto iter = desc_pool_map_.find(desc_pool);
     if (iter != desc_pool_map_.end()) {
-        VkResult result = DispatchFreeDescriptorSets(device, desc_pool, 1, &desc_set);
-        assert(result == VK_SUCCESS);
-        if (result != VK_SUCCESS) {
-            return;
+        // The set is rewritten by whoever gets it next, it only needs to stay compatible with the pool's layout
+        free_desc_sets_[iter->second.layout].push_back({desc_pool, desc_set});
+    }
+    return;
+}
+
+UtilOutputBufferManager::UtilOutputBufferManager(VmaAllocator allocator, VkDeviceSize block_size, VkDeviceSize alignment,
+                                                 VmaPool pool)
+    : allocator_(allocator),
+      pool_(pool),
+      block_size_(block_size),
+      block_stride_(alignment > 1 ? ((block_size + alignment - 1) / alignment) * alignment : block_size) {}
+
+UtilOutputBufferManager::~UtilOutputBufferManager() {
+    for (auto &chunk : chunks_) {
+        vmaDestroyBuffer(allocator_, chunk.buffer, chunk.allocation);
+    }
+    if (pool_) {
+        vmaDestroyPool(allocator_, pool_);
+    }
+}
+
+VkResult UtilOutputBufferManager::AddChunk() {
+    const VkDeviceSize blocks_per_chunk = block_stride_ < kBytesPerChunk ? kBytesPerChunk / block_stride_ : 1;
+    auto buffer_info = LvlInitStruct<VkBufferCreateInfo>();
+    buffer_info.size = block_stride_ * blocks_per_chunk;
+    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    alloc_info.pool = pool_;
+    Chunk chunk = {};
+    VmaAllocationInfo allocation_info = {};
+    VkResult result = vmaCreateBuffer(allocator_, &buffer_info, &alloc_info, &chunk.buffer, &chunk.allocation, &allocation_info);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    chunks_.push_back(chunk);
+
+    // Pushed back to front so blocks are handed out in address order
+    auto *chunk_data = static_cast<uint8_t *>(allocation_info.pMappedData);
+    for (VkDeviceSize i = blocks_per_chunk; i > 0; i--) {
+        UtilOutputBlock block;
+        block.buffer = chunk.buffer;
+        block.offset = (i - 1) * block_stride_;
+        block.data = reinterpret_cast<uint32_t *>(chunk_data + block.offset);
+        free_blocks_.push_back(block);
+    }
+    return VK_SUCCESS;
+}
+
+VkResult UtilOutputBufferManager::GetBlock(UtilOutputBlock *block) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (free_blocks_.empty()) {
+            VkResult result = AddChunk();
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+        }
+        *block = free_blocks_.back();
+        free_blocks_.pop_back();
+    }
+    memset(block->data, 0, static_cast<size_t>(block_size_));
+    return VK_SUCCESS;
+}
+
+void UtilOutputBufferManager::PutBackBlock(const UtilOutputBlock &block) {
+    if (block.buffer == VK_NULL_HANDLE) return;
+    std::lock_guard<std::mutex> guard(lock_);
+    free_blocks_.push_back(block);
+}
+
+UtilInstrumentedShaderCache &UtilInstrumentedShaderCache::Get() {
+    // Leaked on purpose, like SpirvStaticDataCache
+    static UtilInstrumentedShaderCache *cache = new UtilInstrumentedShaderCache();
+    return *cache;
+}
+
+// static
+UtilInstrumentedShaderCache::Key UtilInstrumentedShaderCache::MakeKey(const uint32_t *code, size_t word_count, spv_target_env env,
+                                                                      uint32_t pass_options, uint32_t validator_options,
+                                                                      uint32_t desc_set_bind_index) {
+    Key key;
+    key.hash[0] = XXH64(code, word_count * sizeof(uint32_t), 0);
+    key.hash[1] = XXH64(code, word_count * sizeof(uint32_t), 0x9e3779b97f4a7c15ull);
+    key.word_count = static_cast<uint32_t>(word_count);
+    key.env = static_cast<uint32_t>(env);
+    key.pass_options = pass_options;
+    key.validator_options = validator_options;
+    key.desc_set_bind_index = desc_set_bind_index;
+    return key;
+}
+
+// static
+bool UtilInstrumentedShaderCache::PickPlaceholderShaderId(const uint32_t *code, size_t word_count, uint32_t *placeholder) {
+    // Far above any real shader id, and unlikely to be a constant in the original code
+    const uint32_t first_candidate = 0x7f1d5a00;
+    uint64_t used_candidates = 0;
+    for (size_t i = 0; i < word_count; i++) {
+        const uint32_t candidate_index = code[i] - first_candidate;
+        if (candidate_index < 64) used_candidates |= 1ull << candidate_index;
+    }
+    for (uint32_t candidate_index = 0; candidate_index < 64; candidate_index++) {
+        if ((used_candidates & (1ull << candidate_index)) == 0) {
+            *placeholder = first_candidate + candidate_index;
+            return true;
         }
-        desc_pool_map_[desc_pool].used--;
-        if (0 == desc_pool_map_[desc_pool].used) {
-            DispatchDestroyDescriptorPool(device, desc_pool, NULL);
-            desc_pool_map_.erase(desc_pool);
+    }
+    return false;
+}
+
+bool UtilInstrumentedShaderCache::Find(const Key &key, uint32_t shader_id, std::vector<uint32_t> &pgm) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    pgm = it->second.pgm;
+    for (const auto offset : it->second.shader_id_offsets) {
+        pgm[offset] = shader_id;
+    }
+    return true;
+}
+
+void UtilInstrumentedShaderCache::Insert(const Key &key, std::vector<uint32_t> &pgm, uint32_t placeholder, uint32_t shader_id) {
+    // The passes only use the shader id as an OpConstant of a 32 bit int, and the placeholder is in no other instruction
+    std::vector<uint32_t> shader_id_offsets;
+    for (size_t i = 5; i < pgm.size();) {
+        const uint32_t length = pgm[i] >> 16;
+        if (length == 0 || length > pgm.size() - i) break;
+        if ((pgm[i] & 0x0000FFFF) == spv::OpConstant && length == 4 && pgm[i + 3] == placeholder) {
+            shader_id_offsets.push_back(static_cast<uint32_t>(i + 3));
         }
+        i += length;
     }
-    return;
+
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (cached_words_ + pgm.size() <= kMaxCachedWords && entries_.find(key) == entries_.end()) {
+            Entry entry;
+            entry.pgm = pgm;
+            entry.shader_id_offsets = shader_id_offsets;
+            entries_.emplace(key, std::move(entry));
+            cached_words_ += pgm.size();
+        }
+    }
+    for (const auto offset : shader_id_offsets) {
+        pgm[offset] = shader_id;
+    }
+}
+
+// The layout of the cache file is a header of kInstrumentedShaderCacheHeaderSize bytes:
+//   [header size, version, low and high words of the SPIRV-Tools commit hash]
+// followed by one record per entry:
+//   [key (9 words), offset count, code size, offsets, code]
+static const uint32_t kInstrumentedShaderCacheHeaderSize = 16;
+static const uint32_t kInstrumentedShaderCacheVersion = 1;
+
+static uint64_t SpirvToolsCommitHash() { return XXH64(SPIRV_TOOLS_COMMIT_ID, strlen(SPIRV_TOOLS_COMMIT_ID), 0); }
+
+bool UtilInstrumentedShaderCache::Load(const std::string &path) {
+    FILE *read_file = fopen(path.c_str(), "rb");
+    if (!read_file) return false;
+    std::vector<uint32_t> file_data;
+    uint32_t buffer[4096];
+    size_t read_count;
+    while ((read_count = fread(buffer, sizeof(uint32_t), 4096, read_file)) > 0) {
+        file_data.insert(file_data.end(), buffer, buffer + read_count);
+    }
+    fclose(read_file);
+
+    const uint64_t commit_hash = SpirvToolsCommitHash();
+    if (file_data.size() < 4 || file_data[0] != kInstrumentedShaderCacheHeaderSize ||
+        file_data[1] != kInstrumentedShaderCacheVersion || file_data[2] != static_cast<uint32_t>(commit_hash) ||
+        file_data[3] != static_cast<uint32_t>(commit_hash >> 32)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(lock_);
+    const uint32_t *data = file_data.data() + 4;
+    const uint32_t *end = file_data.data() + file_data.size();
+    while (end - data >= 11) {
+        Key key;
+        key.hash[0] = data[0] | (static_cast<uint64_t>(data[1]) << 32);
+        key.hash[1] = data[2] | (static_cast<uint64_t>(data[3]) << 32);
+        key.word_count = data[4];
+        key.env = data[5];
+        key.pass_options = data[6];
+        key.validator_options = data[7];
+        key.desc_set_bind_index = data[8];
+        const uint32_t offset_count = data[9];
+        const uint32_t pgm_size = data[10];
+        data += 11;
+        if (static_cast<uint64_t>(offset_count) + pgm_size > static_cast<uint64_t>(end - data)) return false;
+
+        Entry entry;
+        entry.shader_id_offsets.assign(data, data + offset_count);
+        data += offset_count;
+        entry.pgm.assign(data, data + pgm_size);
+        data += pgm_size;
+        for (const auto offset : entry.shader_id_offsets) {
+            if (offset >= pgm_size) return false;
+        }
+        if (cached_words_ + pgm_size <= kMaxCachedWords && entries_.find(key) == entries_.end()) {
+            entries_.emplace(key, std::move(entry));
+            cached_words_ += pgm_size;
+        }
+    }
+    return true;
+}
+
+bool UtilInstrumentedShaderCache::Save(const std::string &path) {
+    const uint64_t commit_hash = SpirvToolsCommitHash();
+    std::vector<uint32_t> file_data = {kInstrumentedShaderCacheHeaderSize, kInstrumentedShaderCacheVersion,
+                                       static_cast<uint32_t>(commit_hash), static_cast<uint32_t>(commit_hash >> 32)};
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        file_data.reserve(file_data.size() + cached_words_ + 11 * entries_.size());
+        for (const auto &entry : entries_) {
+            const auto &key = entry.first;
+            file_data.insert(file_data.end(), {static_cast<uint32_t>(key.hash[0]), static_cast<uint32_t>(key.hash[0] >> 32),
+                                               static_cast<uint32_t>(key.hash[1]), static_cast<uint32_t>(key.hash[1] >> 32),
+                                               key.word_count, key.env, key.pass_options, key.validator_options,
+                                               key.desc_set_bind_index,
+                                               static_cast<uint32_t>(entry.second.shader_id_offsets.size()),
+                                               static_cast<uint32_t>(entry.second.pgm.size())});
+            file_data.insert(file_data.end(), entry.second.shader_id_offsets.begin(), entry.second.shader_id_offsets.end());
+            file_data.insert(file_data.end(), entry.second.pgm.begin(), entry.second.pgm.end());
+        }
+    }
+
+    return ReplaceCacheFile(path, file_data.data(), file_data.size() * sizeof(uint32_t));
 }
 
 // Trampolines to make VMA call Dispatch for Vulkan calls
@@ -225,6 +455,11 @@ gpu_utils_state::CommandBuffer::CommandBuffer(GpuAssistedBase *ga, VkCommandBuff
                                               const VkCommandBufferAllocateInfo *pCreateInfo, const COMMAND_POOL_STATE *pool)
     : CMD_BUFFER_STATE(ga, cb, pCreateInfo, pool) {}
 
+void gpu_utils_state::CommandBuffer::Reset() {
+    static_cast<GpuAssistedBase *>(dev_data)->WaitForReadbacks(this);
+    CMD_BUFFER_STATE::Reset();
+}
+
 ReadLockGuard GpuAssistedBase::ReadLock() {
     if (fine_grained_locking) {
         return ReadLockGuard(validation_object_mutex, std::defer_lock);
@@ -333,9 +568,26 @@ void GpuAssistedBase::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         aborted = true;
         return;
     }
+
+    async_readback = GpuGetOption("khronos_validation.gpuav_async_readback", false);
+
+    if (GpuGetOption("khronos_validation.gpuav_instrumented_shader_cache", false)) {
+        instrumented_shader_cache_path = GetCacheFilePath("instrumented_shader_cache");
+        if (!UtilInstrumentedShaderCache::Get().Load(instrumented_shader_cache_path)) {
+            LogInfo(device, "UNASSIGNED-cache-file-error",
+                    "Cannot load instrumented shader cache at %s (it may not exist yet or be from another version)",
+                    instrumented_shader_cache_path.c_str());
+        }
+    }
 }
 
 void GpuAssistedBase::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    // Deferred output has to be reported while the command buffer state and the output buffers still exist
+    ProcessReadbacks(true);
+    for (auto fence : free_readback_fences_) {
+        DispatchDestroyFence(device, fence, nullptr);
+    }
+    free_readback_fences_.clear();
     if (debug_desc_layout) {
         DispatchDestroyDescriptorSetLayout(device, debug_desc_layout, NULL);
         debug_desc_layout = VK_NULL_HANDLE;
@@ -345,11 +597,17 @@ void GpuAssistedBase::PreCallRecordDestroyDevice(VkDevice device, const VkAlloca
         dummy_desc_layout = VK_NULL_HANDLE;
     }
     ValidationStateTracker::PreCallRecordDestroyDevice(device, pAllocator);
+    // Command buffers put their output blocks back as they are destroyed above
+    output_buffer_manager.reset();
     // State Tracker can end up making vma calls through callbacks - don't destroy allocator until ST is done
     if (vmaAllocator) {
         vmaDestroyAllocator(vmaAllocator);
     }
     desc_set_manager.reset();
+    if (instrumented_shader_cache_path.size() > 0 && !UtilInstrumentedShaderCache::Get().Save(instrumented_shader_cache_path)) {
+        LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot write instrumented shader cache at %s",
+                instrumented_shader_cache_path.c_str());
+    }
 }
 
 gpu_utils_state::Queue::Queue(GpuAssistedBase &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags)
@@ -368,7 +626,7 @@ gpu_utils_state::Queue::~Queue() {
 
 // Submit a memory barrier on graphics queues.
 // Lazy-create and record the needed command buffer.
-void gpu_utils_state::Queue::SubmitBarrier() {
+bool gpu_utils_state::Queue::SubmitBarrier(VkFence fence) {
     if (barrier_command_pool_ == VK_NULL_HANDLE) {
         VkResult result = VK_SUCCESS;
 
@@ -378,7 +636,7 @@ void gpu_utils_state::Queue::SubmitBarrier() {
         if (result != VK_SUCCESS) {
             state_.ReportSetupProblem(state_.device, "Unable to create command pool for barrier CB.");
             barrier_command_pool_ = VK_NULL_HANDLE;
-            return;
+            return false;
         }
 
         auto buffer_alloc_info = LvlInitStruct<VkCommandBufferAllocateInfo>();
@@ -391,7 +649,7 @@ void gpu_utils_state::Queue::SubmitBarrier() {
             DispatchDestroyCommandPool(state_.device, barrier_command_pool_, nullptr);
             barrier_command_pool_ = VK_NULL_HANDLE;
             barrier_command_buffer_ = VK_NULL_HANDLE;
-            return;
+            return false;
         }
 
         // Hook up command buffer dispatch
@@ -399,6 +657,8 @@ void gpu_utils_state::Queue::SubmitBarrier() {
 
         // Record a global memory barrier to force availability of device memory operations to the host domain.
         auto command_buffer_begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+        // With deferred readback it is submitted again before earlier submissions complete
+        command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
         result = DispatchBeginCommandBuffer(barrier_command_buffer_, &command_buffer_begin_info);
         if (result == VK_SUCCESS) {
             auto memory_barrier = LvlInitStruct<VkMemoryBarrier>();
@@ -413,8 +673,9 @@ void gpu_utils_state::Queue::SubmitBarrier() {
         auto submit_info = LvlInitStruct<VkSubmitInfo>();
         submit_info.commandBufferCount = 1;
         submit_info.pCommandBuffers = &barrier_command_buffer_;
-        DispatchQueueSubmit(QUEUE_STATE::Queue(), 1, &submit_info, VK_NULL_HANDLE);
+        return DispatchQueueSubmit(QUEUE_STATE::Queue(), 1, &submit_info, fence) == VK_SUCCESS;
     }
+    return false;
 }
 
 bool GpuAssistedBase::CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) const {
@@ -461,6 +722,16 @@ void GpuAssistedBase::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCo
     }
     if (!buffers_present) return;
 
+    if (async_readback) {
+        std::vector<VkCommandBuffer> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo *submit = &pSubmits[submit_idx];
+            command_buffers.insert(command_buffers.end(), submit->pCommandBuffers,
+                                   submit->pCommandBuffers + submit->commandBufferCount);
+        }
+        if (DeferReadback(queue, command_buffers)) return;
+    }
+
     SubmitBarrier(queue);
 
     DispatchQueueWaitIdle(queue);
@@ -486,6 +757,17 @@ void GpuAssistedBase::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, co
     }
     if (!buffers_present) return;
 
+    if (async_readback) {
+        std::vector<VkCommandBuffer> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+                command_buffers.push_back(submit->pCommandBufferInfos[i].commandBuffer);
+            }
+        }
+        if (DeferReadback(queue, command_buffers)) return;
+    }
+
     SubmitBarrier(queue);
 
     DispatchQueueWaitIdle(queue);
@@ -510,6 +792,161 @@ void GpuAssistedBase::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitC
     RecordQueueSubmit2(queue, submitCount, pSubmits, fence, result);
 }
 
+void GpuAssistedBase::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    ValidationStateTracker::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
+    if (!async_readback) return;
+    ProcessReadbacks(false);
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+            WaitForReadbacks(submit->pCommandBuffers[i]);
+        }
+    }
+}
+
+void GpuAssistedBase::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                                   VkFence fence) {
+    ValidationStateTracker::PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    GpuAssistedBase::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence);
+}
+
+void GpuAssistedBase::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    if (!async_readback) return;
+    ProcessReadbacks(false);
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+            WaitForReadbacks(submit->pCommandBufferInfos[i].commandBuffer);
+        }
+    }
+}
+
+// The application waiting on its own work is a good time to report deferred output, most of which is ready by then
+void GpuAssistedBase::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    if (async_readback) ProcessReadbacks(false);
+}
+
+void GpuAssistedBase::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                                  uint64_t timeout, VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    if (async_readback) ProcessReadbacks(false);
+}
+
+void GpuAssistedBase::PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                                   VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
+    if (async_readback) ProcessReadbacks(false);
+}
+
+void GpuAssistedBase::PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                                      VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
+    if (async_readback) ProcessReadbacks(false);
+}
+
+void GpuAssistedBase::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    if (async_readback) ProcessReadbacks(false);
+}
+
+void GpuAssistedBase::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    if (async_readback) ProcessReadbacks(false);
+}
+
+bool GpuAssistedBase::DeferReadback(VkQueue queue, const std::vector<VkCommandBuffer> &command_buffers) {
+    auto queue_state = Get<gpu_utils_state::Queue>(queue);
+    if (!queue_state) return false;
+
+    std::lock_guard<std::mutex> guard(readback_lock_);
+    VkFence fence = VK_NULL_HANDLE;
+    if (!free_readback_fences_.empty()) {
+        fence = free_readback_fences_.back();
+        free_readback_fences_.pop_back();
+    } else {
+        auto fence_create_info = LvlInitStruct<VkFenceCreateInfo>();
+        if (DispatchCreateFence(device, &fence_create_info, nullptr, &fence) != VK_SUCCESS) {
+            ReportSetupProblem(device, "Unable to create readback fence.  Waiting for the queue to be idle instead.");
+            return false;
+        }
+    }
+    // The barrier makes the output of everything submitted before it available to the host before the fence signals
+    if (!queue_state->SubmitBarrier(fence)) {
+        free_readback_fences_.push_back(fence);
+        return false;
+    }
+
+    PendingReadback readback;
+    readback.queue = queue;
+    readback.fence = fence;
+    for (const auto command_buffer : command_buffers) {
+        auto cb_node = Get<gpu_utils_state::CommandBuffer>(command_buffer);
+        if (!cb_node) continue;
+        readback.command_buffers.emplace_back(cb_node);
+        for (auto *secondary_cb : cb_node->linkedCommandBuffers) {
+            readback.command_buffers.emplace_back(
+                std::static_pointer_cast<gpu_utils_state::CommandBuffer>(secondary_cb->shared_from_this()));
+        }
+    }
+    pending_readbacks_.emplace_back(std::move(readback));
+    return true;
+}
+
+void GpuAssistedBase::FinishReadback(PendingReadback &readback, VkResult fence_result) {
+    if (fence_result == VK_SUCCESS) {
+        for (auto &cb_node : readback.command_buffers) {
+            cb_node->Process(readback.queue);
+        }
+        DispatchResetFences(device, 1, &readback.fence);
+        free_readback_fences_.push_back(readback.fence);
+    } else {
+        // Most likely a lost device, the output can't be trusted
+        DispatchDestroyFence(device, readback.fence, nullptr);
+    }
+}
+
+void GpuAssistedBase::ProcessReadbacks(bool wait) {
+    std::lock_guard<std::mutex> guard(readback_lock_);
+    for (auto it = pending_readbacks_.begin(); it != pending_readbacks_.end();) {
+        const VkResult result = wait ? DispatchWaitForFences(device, 1, &it->fence, VK_TRUE, UINT64_MAX)
+                                     : DispatchGetFenceStatus(device, it->fence);
+        if (result == VK_NOT_READY) {
+            ++it;
+            continue;
+        }
+        FinishReadback(*it, result);
+        it = pending_readbacks_.erase(it);
+    }
+}
+
+void GpuAssistedBase::WaitForReadbacks(const CMD_BUFFER_STATE *cb_state) {
+    if (!async_readback) return;
+    std::lock_guard<std::mutex> guard(readback_lock_);
+    for (auto it = pending_readbacks_.begin(); it != pending_readbacks_.end();) {
+        const auto &command_buffers = it->command_buffers;
+        const bool uses_cb_state = std::any_of(command_buffers.begin(), command_buffers.end(),
+                                               [cb_state](const std::shared_ptr<gpu_utils_state::CommandBuffer> &cb_node) {
+                                                   return cb_node.get() == cb_state;
+                                               });
+        if (!uses_cb_state) {
+            ++it;
+            continue;
+        }
+        FinishReadback(*it, DispatchWaitForFences(device, 1, &it->fence, VK_TRUE, UINT64_MAX));
+        it = pending_readbacks_.erase(it);
+    }
+}
+
+void GpuAssistedBase::WaitForReadbacks(VkCommandBuffer command_buffer) {
+    auto cb_node = Get<gpu_utils_state::CommandBuffer>(command_buffer);
+    if (!cb_node) return;
+    WaitForReadbacks(cb_node.get());
+    for (const auto *secondary_cb : cb_node->linkedCommandBuffers) {
+        WaitForReadbacks(secondary_cb);
+    }
+}
+
 void GpuAssistedBase::PreCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
                                                         const VkAllocationCallbacks *pAllocator, VkPipelineLayout *pPipelineLayout,
                                                         void *cpl_state_data) {
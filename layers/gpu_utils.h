@@ -39,23 +39,130 @@ class UtilDescriptorSetManager {
   private:
     std::unique_lock<std::mutex> Lock() const { return std::unique_lock<std::mutex>(lock_); }
 
+    // Sets are allocated a whole pool at a time, and put back sets are kept for reuse instead of being freed
     static const uint32_t kItemsPerChunk = 512;
     struct PoolTracker {
         uint32_t size;
-        uint32_t used;
+        VkDescriptorSetLayout layout;
+    };
+    struct FreeSet {
+        VkDescriptorPool pool;
+        VkDescriptorSet set;
     };
     VkDevice device;
     uint32_t numBindingsInSet;
     layer_data::unordered_map<VkDescriptorPool, struct PoolTracker> desc_pool_map_;
+    layer_data::unordered_map<VkDescriptorSetLayout, std::vector<FreeSet>> free_desc_sets_;
     mutable std::mutex lock_;
 };
 
+// A fixed size piece of a persistently mapped, host coherent storage buffer
+struct UtilOutputBlock {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    uint32_t *data = nullptr;
+};
+
+// Hands out the output blocks that instrumented shaders write to, carved out of large buffers so that a draw doesn't need
+// to create a buffer or map memory. Blocks are reused once the command buffer that used them is reset.
+class UtilOutputBufferManager {
+  public:
+    // If pool is not VK_NULL_HANDLE the buffers are allocated from it, and it is destroyed with the manager
+    UtilOutputBufferManager(VmaAllocator allocator, VkDeviceSize block_size, VkDeviceSize alignment, VmaPool pool);
+    ~UtilOutputBufferManager();
+
+    // The block is cleared to zeros
+    VkResult GetBlock(UtilOutputBlock *block);
+    void PutBackBlock(const UtilOutputBlock &block);
+
+  private:
+    // Buffers hold this many bytes of blocks, or a single block if that is bigger
+    static const VkDeviceSize kBytesPerChunk = 1024 * 1024;
+    struct Chunk {
+        VkBuffer buffer;
+        VmaAllocation allocation;
+    };
+    VkResult AddChunk();
+
+    VmaAllocator allocator_;
+    VmaPool pool_;
+    const VkDeviceSize block_size_;
+    const VkDeviceSize block_stride_;
+    std::vector<Chunk> chunks_;
+    std::vector<UtilOutputBlock> free_blocks_;
+    std::mutex lock_;
+};
+
+// Pass options that are part of UtilInstrumentedShaderCache keys
+enum UtilInstrumentationOptionBits : uint32_t {
+    kUtilInstBindlessCheck = 0x00000001,
+    kUtilInstDescriptorIndexing = 0x00000002,
+    kUtilInstBufferOob = 0x00000004,
+    kUtilInstBuffAddrCheck = 0x00000008,
+    kUtilInstDebugPrintf = 0x00000010,
+};
+
+// Instrumented SPIR-V shared by every device in the process, and persisted across runs once Load() has been called.
+// The passes embed the shader id in the code, so entries are recorded with a placeholder id that is replaced by the
+// real id whenever an entry is used.
+class UtilInstrumentedShaderCache {
+  public:
+    // The original code plus everything that changes what the passes emit for it
+    struct Key {
+        uint64_t hash[2];
+        uint32_t word_count;
+        uint32_t env;
+        uint32_t pass_options;
+        uint32_t validator_options;
+        uint32_t desc_set_bind_index;
+
+        bool operator==(const Key &other) const {
+            return hash[0] == other.hash[0] && hash[1] == other.hash[1] && word_count == other.word_count && env == other.env &&
+                   pass_options == other.pass_options && validator_options == other.validator_options &&
+                   desc_set_bind_index == other.desc_set_bind_index;
+        }
+    };
+
+    static UtilInstrumentedShaderCache &Get();
+    static Key MakeKey(const uint32_t *code, size_t word_count, spv_target_env env, uint32_t pass_options,
+                       uint32_t validator_options, uint32_t desc_set_bind_index);
+    // Picks a shader id to instrument code with that is not any word of code, so every 32 bit constant of that value in the
+    // result was added by the passes. Returns false if there is none and the result can't be cached.
+    static bool PickPlaceholderShaderId(const uint32_t *code, size_t word_count, uint32_t *placeholder);
+
+    // On a hit, replaces pgm with the cached code for key using shader_id
+    bool Find(const Key &key, uint32_t shader_id, std::vector<uint32_t> &pgm);
+    // Adds pgm, instrumented using placeholder as the shader id, and then switches pgm over to shader_id
+    void Insert(const Key &key, std::vector<uint32_t> &pgm, uint32_t placeholder, uint32_t shader_id);
+
+    // Adds the entries of a file written by Save(). Files from other layer or SPIRV-Tools versions are ignored.
+    bool Load(const std::string &path);
+    bool Save(const std::string &path);
+
+  private:
+    struct KeyHash {
+        size_t operator()(const Key &key) const { return static_cast<size_t>(key.hash[0]); }
+    };
+    struct Entry {
+        std::vector<uint32_t> pgm;
+        // Where the placeholder shader id is in pgm
+        std::vector<uint32_t> shader_id_offsets;
+    };
+    // Once this much code is cached new entries are dropped, 64MB
+    static const size_t kMaxCachedWords = 16 * 1024 * 1024;
+
+    std::mutex lock_;
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+    size_t cached_words_{0};
+};
+
 namespace gpu_utils_state {
 class Queue : public QUEUE_STATE {
   public:
     Queue(GpuAssistedBase &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags);
     virtual ~Queue();
-    void SubmitBarrier();
+    // Returns false if the barrier could not be submitted, in which case fence will not be signaled
+    bool SubmitBarrier(VkFence fence = VK_NULL_HANDLE);
 
   private:
     GpuAssistedBase &state_;
@@ -70,6 +177,8 @@ class CommandBuffer : public CMD_BUFFER_STATE {
 
     virtual bool NeedsProcessing() const = 0;
     virtual void Process(VkQueue queue) = 0;
+    // Derived classes free their output buffers after calling this, so it first reports any output pending readback
+    void Reset() override;
 };
 }  // namespace gpu_utils_state
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkQueue, gpu_utils_state::Queue, QUEUE_STATE);
@@ -107,6 +216,19 @@ class GpuAssistedBase : public ValidationStateTracker {
                                        VkResult result) override;
     void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                                     VkResult result) override;
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) override;
+    void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                      VkFence fence) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) override;
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result) override;
+    void PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                      VkResult result) override;
+    void PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                         VkResult result) override;
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
     void PreCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
                                            const VkAllocationCallbacks *pAllocator, VkPipelineLayout *pPipelineLayout,
                                            void *cpl_state_data) override;
@@ -162,8 +284,13 @@ class GpuAssistedBase : public ValidationStateTracker {
         }
         LogError(object, setup_vuid, "Setup Error. Detail: (%s)", logit.c_str());
     }
+    // Settings given through VkLayerSettingsEXT take precedence over the settings file
+    std::string GpuGetSetting(const char *option) const {
+        const auto setting = gpu_settings.find(option);
+        return setting != gpu_settings.end() ? setting->second : std::string(getLayerOption(option));
+    }
     bool GpuGetOption(const char *option, bool default_value) {
-        std::string option_string = getLayerOption(option);
+        std::string option_string = GpuGetSetting(option);
         transform(option_string.begin(), option_string.end(), option_string.begin(), ::tolower);
         return !option_string.empty() ? !option_string.compare("true") : default_value;
     }
@@ -172,6 +299,17 @@ class GpuAssistedBase : public ValidationStateTracker {
     bool CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) const;
     void ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
 
+    // With async_readback, the output of a submission is read once a fence signaled after it, instead of waiting for the
+    // queue to go idle in every submit. Returns false if the fence can't be set up and the caller has to wait.
+    bool DeferReadback(VkQueue queue, const std::vector<VkCommandBuffer> &command_buffers);
+    // Reports the output of the deferred readbacks whose fence has signaled, or of all of them if wait is set
+    void ProcessReadbacks(bool wait);
+    // Waits for and reports the output of the deferred readbacks that use cb_state
+    void WaitForReadbacks(const CMD_BUFFER_STATE *cb_state);
+    // The same for a command buffer about to be submitted again and the secondaries it executes, so that its output buffers
+    // are not cleared while the GPU writes to them
+    void WaitForReadbacks(VkCommandBuffer command_buffer);
+
     void SubmitBarrier(VkQueue queue) {
         auto queue_state = Get<gpu_utils_state::Queue>(queue);
         if (queue_state) {
@@ -193,8 +331,24 @@ class GpuAssistedBase : public ValidationStateTracker {
                                          const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                          const VkPipelineBindPoint bind_point, const SafeCreateInfo &modified_create_infos);
 
+  private:
+    struct PendingReadback {
+        VkQueue queue;
+        VkFence fence;
+        // Primary command buffers followed by the secondaries they execute
+        std::vector<std::shared_ptr<gpu_utils_state::CommandBuffer>> command_buffers;
+    };
+    void FinishReadback(PendingReadback &readback, VkResult fence_result);
+
+    // Held while deferred output is processed. Command buffers are only reset after taking it, see
+    // gpu_utils_state::CommandBuffer::Reset(), so processing doesn't need the command buffer locks.
+    std::mutex readback_lock_;
+    std::deque<PendingReadback> pending_readbacks_;
+    std::vector<VkFence> free_readback_fences_;
+
   public:
     bool aborted = false;
+    bool async_readback = false;
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     const char *setup_vuid;
     VkPhysicalDeviceFeatures supported_features{};
@@ -205,8 +359,12 @@ class GpuAssistedBase : public ValidationStateTracker {
     VkDescriptorSetLayout debug_desc_layout = VK_NULL_HANDLE;
     VkDescriptorSetLayout dummy_desc_layout = VK_NULL_HANDLE;
     uint32_t desc_set_bind_index = 0;
+    // Where UtilInstrumentedShaderCache is persisted, empty if it is only kept in memory
+    std::string instrumented_shader_cache_path;
     VmaAllocator vmaAllocator = {};
     std::unique_ptr<UtilDescriptorSetManager> desc_set_manager;
+    // Created by the derived class once it knows output_buffer_size
+    std::unique_ptr<UtilOutputBufferManager> output_buffer_manager;
     vl_concurrent_unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     std::vector<VkDescriptorSetLayoutBinding> bindings_;
 };
@@ -248,6 +248,7 @@ void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
 
     bool validate_descriptor_indexing = GpuGetOption("khronos_validation.gpuav_descriptor_indexing", true);
     validate_draw_indirect = GpuGetOption("khronos_validation.validate_draw_indirect", true);
+    compact_output = GpuGetOption("khronos_validation.gpuav_compact_output", false);
 
     if (phys_dev_props.apiVersion < VK_API_VERSION_1_1) {
         ReportSetupProblem(device, "GPU-Assisted validation requires Vulkan 1.1 or later.  GPU-Assisted Validation disabled.");
@@ -275,6 +276,7 @@ void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     if (validate_descriptor_indexing) {
         descriptor_indexing = CheckForDescriptorIndexing(enabled_features);
     }
+    VmaPool output_buffer_pool = VK_NULL_HANDLE;
     bool use_linear_output_pool = GpuGetOption("khronos_validation.vma_linear_output", true);
     if (use_linear_output_pool) {
         auto output_buffer_create_info = LvlInitStruct<VkBufferCreateInfo>();
@@ -294,6 +296,13 @@ void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
             ReportSetupProblem(device, "Unable to create VMA memory pool");
         }
     }
+    // Output blocks are handed out at offsets within shared buffers, so keep them aligned for the descriptor offset
+    output_buffer_manager.reset(new UtilOutputBufferManager(vmaAllocator, output_buffer_size,
+                                                            phys_dev_props.limits.minStorageBufferOffsetAlignment,
+                                                            output_buffer_pool));
+    if (compact_output) {
+        CreateOutputCompactionState();
+    }
 
     CreateAccelerationStructureBuildValidationState();
 }
@@ -312,9 +321,7 @@ void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocation
         }
         pre_draw_validation_state.globals_created = false;
     }
-    if (output_buffer_pool) {
-        vmaDestroyPool(vmaAllocator, output_buffer_pool);
-    }
+    DestroyOutputCompactionState();
     GpuAssistedBase::PreCallRecordDestroyDevice(device, pAllocator);
 }
 
@@ -934,7 +941,7 @@ void GpuAssisted::PostCallRecordBindAccelerationStructureMemoryNV(VkDevice devic
 
 // Free the device memory and descriptor set(s) associated with a command buffer.
 void GpuAssisted::DestroyBuffer(GpuAssistedBufferInfo &buffer_info) {
-    vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
+    output_buffer_manager->PutBackBlock(buffer_info.output_mem_block);
     if (buffer_info.di_input_mem_block.buffer) {
         vmaDestroyBuffer(vmaAllocator, buffer_info.di_input_mem_block.buffer, buffer_info.di_input_mem_block.allocation);
     }
@@ -1074,9 +1081,6 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
 
     // Load original shader SPIR-V
     uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
-    new_pgm.clear();
-    new_pgm.reserve(num_words);
-    new_pgm.insert(new_pgm.end(), &pCreateInfo->pCode[0], &pCreateInfo->pCode[num_words]);
 
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
@@ -1084,26 +1088,44 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     using namespace spvtools;
     spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
     spvtools::ValidatorOptions val_options;
-    AdjustValidatorOptions(device_extensions, enabled_features, val_options);
+    const uint32_t validator_options = AdjustValidatorOptions(device_extensions, enabled_features, val_options);
+    const bool buff_addr_check = (IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+                                  IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
+                                 shaderInt64 && enabled_features.core12.bufferDeviceAddress;
+    const uint32_t pass_options = kUtilInstBindlessCheck | (descriptor_indexing ? kUtilInstDescriptorIndexing : 0) |
+                                  (buffer_oob_enabled ? kUtilInstBufferOob : 0) | (buff_addr_check ? kUtilInstBuffAddrCheck : 0);
+    *unique_shader_id = unique_shader_module_id++;
+
+    auto &instrumented_shader_cache = UtilInstrumentedShaderCache::Get();
+    const auto cache_key = UtilInstrumentedShaderCache::MakeKey(pCreateInfo->pCode, num_words, target_env, pass_options,
+                                                                validator_options, desc_set_bind_index);
+    if (instrumented_shader_cache.Find(cache_key, *unique_shader_id, new_pgm)) return true;
+    uint32_t instrumented_shader_id = *unique_shader_id;
+    const bool cacheable =
+        UtilInstrumentedShaderCache::PickPlaceholderShaderId(pCreateInfo->pCode, num_words, &instrumented_shader_id);
+
+    new_pgm.clear();
+    new_pgm.reserve(num_words);
+    new_pgm.insert(new_pgm.end(), &pCreateInfo->pCode[0], &pCreateInfo->pCode[num_words]);
+
     spvtools::OptimizerOptions opt_options;
     opt_options.set_run_validator(true);
     opt_options.set_validator_options(val_options);
     Optimizer optimizer(target_env);
     optimizer.SetMessageConsumer(gpu_console_message_consumer);
-    optimizer.RegisterPass(CreateInstBindlessCheckPass(desc_set_bind_index, unique_shader_module_id, descriptor_indexing,
+    optimizer.RegisterPass(CreateInstBindlessCheckPass(desc_set_bind_index, instrumented_shader_id, descriptor_indexing,
                                                        descriptor_indexing, buffer_oob_enabled, buffer_oob_enabled));
     // Call CreateAggressiveDCEPass with preserve_interface == true
     optimizer.RegisterPass(CreateAggressiveDCEPass(true));
-    if ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
-         IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
-        shaderInt64 && enabled_features.core12.bufferDeviceAddress) {
-        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, unique_shader_module_id));
+    if (buff_addr_check) {
+        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, instrumented_shader_id));
     }
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, opt_options);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (cacheable) {
+        instrumented_shader_cache.Insert(cache_key, new_pgm, instrumented_shader_id, *unique_shader_id);
     }
-    *unique_shader_id = unique_shader_module_id++;
     return pass;
 }
 // Create the instrumented shader data to provide to the driver.
@@ -1284,15 +1306,16 @@ void GpuAssisted::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
 void gpuav_state::CommandBuffer::Process(VkQueue queue) {
     auto *device_state = static_cast<GpuAssisted *>(dev_data);
-    if (hasDrawCmd || hasTraceRaysCmd || hasDispatchCmd) {
+    // Blocks that were gathered by the compaction dispatch have already had their counts cleared on the GPU, so the
+    // per-block loop is only needed for command buffers without it or when some blocks didn't fit
+    const bool read_blocks = !output_compaction.compact_data || ProcessCompactedOutput(queue);
+    if ((hasDrawCmd || hasTraceRaysCmd || hasDispatchCmd) && read_blocks) {
         auto &gpu_buffer_list = gpuav_buffer_list;
         uint32_t draw_index = 0;
         uint32_t compute_index = 0;
         uint32_t ray_trace_index = 0;
 
         for (auto &buffer_info : gpu_buffer_list) {
-            char *data;
-
             uint32_t operation_index = 0;
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 operation_index = draw_index;
@@ -1304,11 +1327,8 @@ void gpuav_state::CommandBuffer::Process(VkQueue queue) {
                 assert(false);
             }
 
-            VkResult result = vmaMapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&data);
-            if (result == VK_SUCCESS) {
-                device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index, (uint32_t *)data);
-                vmaUnmapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+            device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index,
+                                                     buffer_info.output_mem_block.data);
 
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 draw_index++;
@@ -1324,6 +1344,54 @@ void gpuav_state::CommandBuffer::Process(VkQueue queue) {
     ProcessAccelerationStructure(queue);
 }
 
+// Report the records gathered by the compaction dispatch.  Returns true if some blocks didn't fit, which then still have to
+// be read directly.
+bool gpuav_state::CommandBuffer::ProcessCompactedOutput(VkQueue queue) {
+    auto *device_state = static_cast<GpuAssisted *>(dev_data);
+    uint32_t *const compact_data = output_compaction.compact_data;
+    const uint32_t total_words = compact_data[0];
+    if (0 == total_words) {
+        return false;
+    }
+
+    // Number the operations the same way Process() does
+    std::vector<uint32_t> operation_indices(gpuav_buffer_list.size());
+    uint32_t draw_index = 0;
+    uint32_t compute_index = 0;
+    uint32_t ray_trace_index = 0;
+    for (size_t i = 0; i < gpuav_buffer_list.size(); i++) {
+        const auto bind_point = gpuav_buffer_list[i].pipeline_bind_point;
+        if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            operation_indices[i] = draw_index++;
+        } else if (bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+            operation_indices[i] = compute_index++;
+        } else if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
+            operation_indices[i] = ray_trace_index++;
+        }
+    }
+
+    // Each entry is {index into gpuav_buffer_list, words, words of the block}.  AnalyzeAndGenerateMessages clears as much
+    // as a whole block, so hand it a copy instead of the entry itself.
+    const uint32_t used_words = std::min(total_words, output_compaction.compact_words);
+    const uint32_t *entries = compact_data + 1;
+    std::vector<uint32_t> block(device_state->output_buffer_size / sizeof(uint32_t));
+    uint32_t pos = 0;
+    while (pos + 2 <= used_words) {
+        const uint32_t index = entries[pos];
+        const uint32_t words = entries[pos + 1];
+        if (words == 0 || words >= block.size() || pos + 2 + words > used_words || index >= gpuav_buffer_list.size()) {
+            break;
+        }
+        std::fill(block.begin(), block.end(), 0);
+        std::copy(entries + pos + 1, entries + pos + 2 + words, block.begin());
+        device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, gpuav_buffer_list[index], operation_indices[index],
+                                                 block.data());
+        pos += 2 + words;
+    }
+    memset(compact_data, 0, sizeof(uint32_t) * (1 + used_words));
+    return total_words > output_compaction.compact_words;
+}
+
 void GpuAssisted::SetDescriptorInitialized(uint32_t *pData, uint32_t index, const cvdescriptorset::Descriptor *descriptor) {
     if (descriptor->GetClass() == cvdescriptorset::DescriptorClass::GeneralBuffer) {
         auto buffer = static_cast<const cvdescriptorset::BufferDescriptor *>(descriptor)->GetBuffer();
@@ -1385,7 +1453,7 @@ void GpuAssisted::PreRecordCommandBuffer(VkCommandBuffer command_buffer) {
 }
 
 void GpuAssisted::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
-    ValidationStateTracker::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
+    GpuAssistedBase::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
@@ -1396,7 +1464,7 @@ void GpuAssisted::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
 
 void GpuAssisted::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
                                                VkFence fence) {
-    ValidationStateTracker::PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    GpuAssistedBase::PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo2KHR *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
@@ -1406,6 +1474,7 @@ void GpuAssisted::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCou
 }
 
 void GpuAssisted::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    GpuAssistedBase::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence);
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
@@ -1684,7 +1753,7 @@ VkPipeline GpuAssisted::GetValidationPipeline(VkRenderPass render_pass) {
 // python ./scripts/generate_spirv.py --outfilename ./layers/generated/gpu_pre_draw_shader.h ./layers/gpu_pre_draw_shader.vert
 // ./External/glslang/build/install/bin/glslangValidator.exe
 #include "gpu_pre_draw_shader.h"
-void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBlock output_block,
+void GpuAssisted::AllocatePreDrawValidationResources(const UtilOutputBlock &output_block,
                                                      GpuAssistedPreDrawResources &resources, const LAST_BOUND_STATE &state,
                                                      VkPipeline *pPipeline, const GpuAssistedCmdDrawIndirectState *cdi_state) {
     VkResult result;
@@ -1759,8 +1828,8 @@ void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBloc
     VkDescriptorBufferInfo buffer_infos[3] = {};
     // Error output buffer
     buffer_infos[0].buffer = output_block.buffer;
-    buffer_infos[0].offset = 0;
-    buffer_infos[0].range = VK_WHOLE_SIZE;
+    buffer_infos[0].offset = output_block.offset;
+    buffer_infos[0].range = output_buffer_size;
     if (cdi_state->count_buffer) {
         // Count buffer
         buffer_infos[1].buffer = cdi_state->count_buffer;
@@ -1823,29 +1892,15 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
     VkDescriptorBufferInfo output_desc_buffer_info = {};
     output_desc_buffer_info.range = output_buffer_size;
 
-    // Allocate memory for the output block that the gpu will use to return any error information
-    GpuAssistedDeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    buffer_info.size = output_buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    alloc_info.pool = output_buffer_pool;
-    result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
+    // Get a zeroed output block that the gpu will use to return any error information
+    UtilOutputBlock output_block = {};
+    result = output_buffer_manager->GetBlock(&output_block);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.", true);
         aborted = true;
         return;
     }
 
-    // Clear the output block to zeros so that only error information from the gpu will be present
-    uint32_t *data_ptr;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&data_ptr));
-    if (result == VK_SUCCESS) {
-        memset(data_ptr, 0, output_buffer_size);
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
-    }
-
     GpuAssistedDeviceMemoryBlock di_input_block = {}, bda_input_block = {};
     VkDescriptorBufferInfo di_input_desc_buffer_info = {};
     VkDescriptorBufferInfo bda_input_desc_buffer_info = {};
@@ -1867,7 +1922,10 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         assert(cdi_state != NULL);
         VkPipeline validation_pipeline;
         AllocatePreDrawValidationResources(output_block, pre_draw_resources, state, &validation_pipeline, cdi_state);
-        if (aborted) return;
+        if (aborted) {
+            output_buffer_manager->PutBackBlock(output_block);
+            return;
+        }
 
         // Save current graphics pipeline state
         GPUAV_RESTORABLE_PIPELINE_STATE restorable_state;
@@ -2202,7 +2260,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
     // Write the descriptor
     output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
+    output_desc_buffer_info.offset = output_block.offset;
 
     desc_writes[0] = LvlInitStruct<VkWriteDescriptorSet>();
     desc_writes[0].descriptorCount = 1;
@@ -2232,11 +2290,205 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
     if (aborted) {
         vmaDestroyBuffer(vmaAllocator, di_input_block.buffer, di_input_block.allocation);
         vmaDestroyBuffer(vmaAllocator, bda_input_block.buffer, bda_input_block.allocation);
-        vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
+        output_buffer_manager->PutBackBlock(output_block);
         return;
     }
 }
 
+// To generate the output compaction shader, run the following from the repository base level
+// python ./scripts/generate_spirv.py --outfilename ./layers/generated/gpu_compact_output_shader.h
+// ./layers/gpu_compact_output_shader.comp ./External/glslang/build/install/bin/glslangValidator.exe
+#include "gpu_compact_output_shader.h"
+// How many non-empty blocks a command buffer's compacted output can hold before the rest are left for the host to read
+static const uint32_t kMaxCompactedBlocks = 256;
+
+void GpuAssisted::CreateOutputCompactionState() {
+    auto &state = output_compaction_state;
+    auto shader_module_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+    shader_module_ci.codeSize = sizeof(gpu_compact_output_shader_comp);
+    shader_module_ci.pCode = gpu_compact_output_shader_comp;
+    VkResult result = DispatchCreateShaderModule(device, &shader_module_ci, nullptr, &state.shader_module);
+
+    // 0 - output blocks, 1 - block table, 2 - compacted output
+    VkDescriptorSetLayoutBinding bindings[3] = {};
+    for (uint32_t i = 0; i < 3; i++) {
+        bindings[i] = {i, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, NULL};
+    }
+    auto ds_layout_ci = LvlInitStruct<VkDescriptorSetLayoutCreateInfo>();
+    ds_layout_ci.bindingCount = 3;
+    ds_layout_ci.pBindings = bindings;
+    if (result == VK_SUCCESS) {
+        result = DispatchCreateDescriptorSetLayout(device, &ds_layout_ci, nullptr, &state.ds_layout);
+    }
+
+    VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_COMPUTE_BIT, 0, 3 * sizeof(uint32_t)};
+    auto pipeline_layout_ci = LvlInitStruct<VkPipelineLayoutCreateInfo>();
+    pipeline_layout_ci.setLayoutCount = 1;
+    pipeline_layout_ci.pSetLayouts = &state.ds_layout;
+    pipeline_layout_ci.pushConstantRangeCount = 1;
+    pipeline_layout_ci.pPushConstantRanges = &push_constant_range;
+    if (result == VK_SUCCESS) {
+        result = DispatchCreatePipelineLayout(device, &pipeline_layout_ci, nullptr, &state.pipeline_layout);
+    }
+
+    auto pipeline_ci = LvlInitStruct<VkComputePipelineCreateInfo>();
+    pipeline_ci.stage = LvlInitStruct<VkPipelineShaderStageCreateInfo>();
+    pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_ci.stage.module = state.shader_module;
+    pipeline_ci.stage.pName = "main";
+    pipeline_ci.layout = state.pipeline_layout;
+    if (result == VK_SUCCESS) {
+        result = DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &state.pipeline);
+    }
+
+    state.globals_created = true;
+    if (result != VK_SUCCESS) {
+        ReportSetupProblem(device, "Unable to create the output compaction pipeline.  Output will not be compacted.");
+        DestroyOutputCompactionState();
+        compact_output = false;
+    }
+}
+
+void GpuAssisted::DestroyOutputCompactionState() {
+    auto &state = output_compaction_state;
+    if (!state.globals_created) {
+        return;
+    }
+    DispatchDestroyPipeline(device, state.pipeline, nullptr);
+    DispatchDestroyPipelineLayout(device, state.pipeline_layout, nullptr);
+    DispatchDestroyDescriptorSetLayout(device, state.ds_layout, nullptr);
+    DispatchDestroyShaderModule(device, state.shader_module, nullptr);
+    state = GpuAssistedOutputCompactionState();
+}
+
+void GpuAssisted::PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    if (compact_output) {
+        RecordOutputCompaction(commandBuffer);
+    }
+}
+
+// Record a dispatch at the end of the command buffer that copies every non-empty output block into one buffer, so that
+// processing the command buffer reads that buffer rather than every block.  One dispatch is recorded per buffer the
+// blocks were carved out of, with the blocks listed in a table.
+void GpuAssisted::RecordOutputCompaction(VkCommandBuffer command_buffer) {
+    if (aborted) return;
+    auto cb_node = GetWrite<gpuav_state::CommandBuffer>(command_buffer);
+    if (!cb_node || cb_node->gpuav_buffer_list.empty()) return;
+    // A secondary command buffer may be continuing a render pass, where dispatches aren't allowed
+    if (cb_node->createInfo.level != VK_COMMAND_BUFFER_LEVEL_PRIMARY || !(cb_node->GetQueueFlags() & VK_QUEUE_COMPUTE_BIT)) {
+        return;
+    }
+
+    // Group the table entries by the buffer holding the block
+    const auto &buffer_list = cb_node->gpuav_buffer_list;
+    std::vector<VkBuffer> group_buffers;
+    std::vector<std::vector<uint32_t>> groups;
+    layer_data::unordered_map<VkBuffer, size_t> group_map;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(buffer_list.size()); i++) {
+        const auto &block = buffer_list[i].output_mem_block;
+        auto inserted = group_map.emplace(block.buffer, groups.size());
+        if (inserted.second) {
+            group_buffers.push_back(block.buffer);
+            groups.emplace_back();
+        }
+        groups[inserted.first->second].push_back(i);
+    }
+
+    auto &resources = cb_node->output_compaction;
+    assert(resources.compact_data == nullptr);
+    const uint32_t block_words = output_buffer_size / sizeof(uint32_t);
+    const VkDeviceSize table_size = buffer_list.size() * 2 * sizeof(uint32_t);
+    resources.compact_words = kMaxCompactedBlocks * (block_words + 1);
+    const VkDeviceSize compact_size = (1 + resources.compact_words) * sizeof(uint32_t);
+
+    auto buffer_ci = LvlInitStruct<VkBufferCreateInfo>();
+    buffer_ci.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    VmaAllocationInfo table_alloc_info = {}, compact_alloc_info = {};
+    buffer_ci.size = table_size;
+    VkResult result = vmaCreateBuffer(vmaAllocator, &buffer_ci, &alloc_info, &resources.table_block.buffer,
+                                      &resources.table_block.allocation, &table_alloc_info);
+    if (result == VK_SUCCESS) {
+        buffer_ci.size = compact_size;
+        result = vmaCreateBuffer(vmaAllocator, &buffer_ci, &alloc_info, &resources.compact_block.buffer,
+                                 &resources.compact_block.allocation, &compact_alloc_info);
+    }
+    for (size_t i = 0; result == VK_SUCCESS && i < groups.size(); i++) {
+        VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+        VkDescriptorSet desc_set = VK_NULL_HANDLE;
+        result = desc_set_manager->GetDescriptorSet(&desc_pool, output_compaction_state.ds_layout, &desc_set);
+        if (result == VK_SUCCESS) {
+            resources.desc_sets.emplace_back(desc_pool, desc_set);
+        }
+    }
+    if (result != VK_SUCCESS) {
+        // The blocks are still read one at a time
+        ReportSetupProblem(device, "Unable to allocate output compaction resources.", true);
+        DestroyOutputCompaction(resources);
+        return;
+    }
+
+    resources.compact_data = static_cast<uint32_t *>(compact_alloc_info.pMappedData);
+    memset(resources.compact_data, 0, static_cast<size_t>(compact_size));
+    auto *table = static_cast<uint32_t *>(table_alloc_info.pMappedData);
+    for (const auto &group : groups) {
+        for (uint32_t index : group) {
+            *table++ = static_cast<uint32_t>(buffer_list[index].output_mem_block.offset / sizeof(uint32_t));
+            *table++ = index;
+        }
+    }
+
+    // Make the instrumented shaders' writes visible to the dispatch
+    auto barrier = LvlInitStruct<VkMemoryBarrier>();
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    DispatchCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                               &barrier, 0, nullptr, 0, nullptr);
+    DispatchCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, output_compaction_state.pipeline);
+
+    uint32_t first_entry = 0;
+    for (size_t i = 0; i < groups.size(); i++) {
+        VkDescriptorBufferInfo buffer_infos[3] = {};
+        buffer_infos[0] = {group_buffers[i], 0, VK_WHOLE_SIZE};
+        buffer_infos[1] = {resources.table_block.buffer, 0, VK_WHOLE_SIZE};
+        buffer_infos[2] = {resources.compact_block.buffer, 0, VK_WHOLE_SIZE};
+        VkWriteDescriptorSet desc_writes[3] = {};
+        for (uint32_t j = 0; j < 3; j++) {
+            desc_writes[j] = LvlInitStruct<VkWriteDescriptorSet>();
+            desc_writes[j].dstSet = resources.desc_sets[i].second;
+            desc_writes[j].dstBinding = j;
+            desc_writes[j].descriptorCount = 1;
+            desc_writes[j].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            desc_writes[j].pBufferInfo = &buffer_infos[j];
+        }
+        DispatchUpdateDescriptorSets(device, 3, desc_writes, 0, nullptr);
+
+        const uint32_t entry_count = static_cast<uint32_t>(groups[i].size());
+        const uint32_t push_constants[3] = {first_entry, entry_count, block_words};
+        DispatchCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, output_compaction_state.pipeline_layout, 0, 1,
+                                      &resources.desc_sets[i].second, 0, nullptr);
+        DispatchCmdPushConstants(command_buffer, output_compaction_state.pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                 sizeof(push_constants), push_constants);
+        DispatchCmdDispatch(command_buffer, (entry_count + 63) / 64, 1, 1);
+        first_entry += entry_count;
+    }
+}
+
+void GpuAssisted::DestroyOutputCompaction(GpuAssistedOutputCompactionResources &resources) {
+    if (resources.table_block.buffer) {
+        vmaDestroyBuffer(vmaAllocator, resources.table_block.buffer, resources.table_block.allocation);
+    }
+    if (resources.compact_block.buffer) {
+        vmaDestroyBuffer(vmaAllocator, resources.compact_block.buffer, resources.compact_block.allocation);
+    }
+    for (const auto &desc_set : resources.desc_sets) {
+        desc_set_manager->PutBackDescriptorSet(desc_set.first, desc_set.second);
+    }
+    resources = GpuAssistedOutputCompactionResources();
+}
+
 std::shared_ptr<CMD_BUFFER_STATE> GpuAssisted::CreateCmdBufferState(VkCommandBuffer cb,
                                                                     const VkCommandBufferAllocateInfo *pCreateInfo,
                                                                     const COMMAND_POOL_STATE *pool) {
@@ -2248,7 +2500,7 @@ gpuav_state::CommandBuffer::CommandBuffer(GpuAssisted *ga, VkCommandBuffer cb, c
     : gpu_utils_state::CommandBuffer(ga, cb, pCreateInfo, pool) {}
 
 void gpuav_state::CommandBuffer::Reset() {
-    CMD_BUFFER_STATE::Reset();
+    gpu_utils_state::CommandBuffer::Reset();
     auto gpuav = static_cast<GpuAssisted *>(dev_data);
     // Free the device memory and descriptor set(s) associated with a command buffer.
     if (gpuav->aborted) {
@@ -2263,4 +2515,6 @@ void gpuav_state::CommandBuffer::Reset() {
         gpuav->DestroyBuffer(as_validation_buffer_info);
     }
     as_validation_buffers.clear();
+
+    gpuav->DestroyOutputCompaction(output_compaction);
 }
@@ -40,7 +40,7 @@ struct GpuAssistedPreDrawResources {
 };
 
 struct GpuAssistedBufferInfo {
-    GpuAssistedDeviceMemoryBlock output_mem_block;
+    UtilOutputBlock output_mem_block;
     GpuAssistedDeviceMemoryBlock di_input_mem_block;   // Descriptor Indexing input
     GpuAssistedDeviceMemoryBlock bda_input_mem_block;  // Buffer Device Address input
     GpuAssistedPreDrawResources pre_draw_resources;
@@ -48,7 +48,7 @@ struct GpuAssistedBufferInfo {
     VkDescriptorPool desc_pool;
     VkPipelineBindPoint pipeline_bind_point;
     CMD_TYPE cmd_type;
-    GpuAssistedBufferInfo(GpuAssistedDeviceMemoryBlock output_mem_block, GpuAssistedDeviceMemoryBlock di_input_mem_block,
+    GpuAssistedBufferInfo(UtilOutputBlock output_mem_block, GpuAssistedDeviceMemoryBlock di_input_mem_block,
                           GpuAssistedDeviceMemoryBlock bda_input_mem_block, GpuAssistedPreDrawResources pre_draw_resources,
                           VkDescriptorSet desc_set, VkDescriptorPool desc_pool, VkPipelineBindPoint pipeline_bind_point,
                           CMD_TYPE cmd_type)
@@ -105,6 +105,23 @@ struct GpuAssistedPreDrawValidationState {
     vl_concurrent_unordered_map <VkRenderPass, VkPipeline> renderpass_to_pipeline;
 };
 
+struct GpuAssistedOutputCompactionState {
+    bool globals_created = false;
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    VkDescriptorSetLayout ds_layout = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+};
+
+// Per command buffer resources of the dispatch that gathers non-empty output blocks into a single buffer
+struct GpuAssistedOutputCompactionResources {
+    GpuAssistedDeviceMemoryBlock table_block = {};
+    GpuAssistedDeviceMemoryBlock compact_block = {};
+    uint32_t* compact_data = nullptr;  // Persistently mapped: the count of words used followed by compact_words words
+    uint32_t compact_words = 0;
+    std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>> desc_sets;
+};
+
 struct GpuAssistedCmdDrawIndirectState {
     VkBuffer buffer;
     VkDeviceSize offset;
@@ -119,6 +136,7 @@ class CommandBuffer : public gpu_utils_state::CommandBuffer {
   public:
     std::vector<GpuAssistedBufferInfo> gpuav_buffer_list;
     std::vector<GpuAssistedAccelerationStructureBuildValidationBufferInfo> as_validation_buffers;
+    GpuAssistedOutputCompactionResources output_compaction;
 
     CommandBuffer(GpuAssisted* ga, VkCommandBuffer cb, const VkCommandBufferAllocateInfo* pCreateInfo,
                   const COMMAND_POOL_STATE* pool);
@@ -130,6 +148,7 @@ class CommandBuffer : public gpu_utils_state::CommandBuffer {
 
   private:
     void ProcessAccelerationStructure(VkQueue queue);
+    bool ProcessCompactedOutput(VkQueue queue);
 };
 };  // namespace gpuav_state
 
@@ -184,6 +203,7 @@ class GpuAssisted : public GpuAssistedBase {
     void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits,
                                       VkFence fence) override;
     void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) override;
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) override;
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
                               uint32_t firstInstance) override;
     void PreCallRecordCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo,
@@ -265,7 +285,7 @@ class GpuAssisted : public GpuAssistedBase {
                                                const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable,
                                                VkDeviceAddress indirectDeviceAddress) override;
     void AllocateValidationResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point, CMD_TYPE cmd, const GpuAssistedCmdDrawIndirectState *cdic_state = nullptr);
-    void AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBlock output_block, GpuAssistedPreDrawResources& resources,
+    void AllocatePreDrawValidationResources(const UtilOutputBlock& output_block, GpuAssistedPreDrawResources& resources,
                                             const LAST_BOUND_STATE& state, VkPipeline *pPipeline, const GpuAssistedCmdDrawIndirectState *cdic_state);
     void PostCallRecordGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
                                                    VkPhysicalDeviceProperties* pPhysicalDeviceProperties) override;
@@ -277,15 +297,20 @@ class GpuAssisted : public GpuAssistedBase {
 
     void DestroyBuffer(GpuAssistedBufferInfo& buffer_info);
     void DestroyBuffer(GpuAssistedAccelerationStructureBuildValidationBufferInfo& buffer_info);
+    void DestroyOutputCompaction(GpuAssistedOutputCompactionResources& resources);
 
   private:
     void PreRecordCommandBuffer(VkCommandBuffer command_buffer);
     VkPipeline GetValidationPipeline(VkRenderPass rp);
+    void CreateOutputCompactionState();
+    void DestroyOutputCompactionState();
+    void RecordOutputCompaction(VkCommandBuffer command_buffer);
 
     VkBool32 shaderInt64;
     bool buffer_oob_enabled;
     bool validate_draw_indirect;
-    VmaPool output_buffer_pool = VK_NULL_HANDLE;
+    bool compact_output;
+    GpuAssistedOutputCompactionState output_compaction_state;
     GpuAssistedAccelerationStructureBuildValidationState acceleration_structure_validation_state;
     GpuAssistedPreDrawValidationState pre_draw_validation_state;
 
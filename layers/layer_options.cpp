@@ -325,6 +325,16 @@ static bool SetBool(std::string &config_string, std::string &env_string, bool de
     return result;
 }
 
+static uint32_t SetUint32(std::string &config_string, std::string &env_string, uint32_t default_val) {
+    // ENV var takes precedence over settings file
+    const std::string &setting = !env_string.empty() ? env_string : config_string;
+    if (setting.empty()) {
+        return default_val;
+    }
+    int radix = ((setting.find("0x") == 0) ? 16 : 10);
+    return static_cast<uint32_t>(std::strtoul(setting.c_str(), nullptr, radix));
+}
+
 // Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     const auto layer_settings_ext = FindSettingsInChain(settings_data->pnext_chain);
@@ -343,6 +353,25 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                 CreateFilterMessageIdList(data, ",", settings_data->message_filter_list);
             } else if (name == "duplicate_message_limit") {
                 *settings_data->duplicate_message_limit = cur_setting.data.value32;
+            } else if (name == "thread_safety_sample_period") {
+                *settings_data->thread_safety_sample_period = cur_setting.data.value32;
+            } else if (name == "validation_worker_threads") {
+                *settings_data->validation_worker_threads = cur_setting.data.value32;
+            } else if (name == "slab_handle_wrapping") {
+                *settings_data->slab_handle_wrapping = cur_setting.data.valueBool == VK_TRUE;
+            } else if (name == "deferred_shader_validation") {
+                *settings_data->deferred_shader_validation = cur_setting.data.valueBool == VK_TRUE;
+            } else if (name.compare(0, 6, "gpuav_") == 0 || name.compare(0, 7, "printf_") == 0) {
+                // Read by GpuAssistedBase::GpuGetSetting() when the device is created, ahead of the settings file
+                std::string key(settings_data->layer_description);
+                key.append(".").append(name);
+                if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT) {
+                    (*settings_data->gpu_settings)[key] = cur_setting.data.valueBool == VK_TRUE ? "true" : "false";
+                } else if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT) {
+                    (*settings_data->gpu_settings)[key] = std::to_string(cur_setting.data.value32);
+                } else if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
+                    (*settings_data->gpu_settings)[key] = cur_setting.data.arrayString.pCharArray;
+                }
             } else if (name == "custom_stype_list") {
                 if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
                     std::string data(cur_setting.data.arrayString.pCharArray);
@@ -380,12 +409,20 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     std::string filter_msg_key(settings_data->layer_description);
     std::string message_limit(settings_data->layer_description);
     std::string fine_grained_locking(settings_data->layer_description);
+    std::string slab_handle_wrapping(settings_data->layer_description);
+    std::string sample_period(settings_data->layer_description);
+    std::string worker_threads(settings_data->layer_description);
+    std::string deferred_shader_validation(settings_data->layer_description);
     enable_key.append(".enables");
     disable_key.append(".disables");
     stypes_key.append(".custom_stype_list");
     filter_msg_key.append(".message_id_filter");
     message_limit.append(".duplicate_message_limit");
     fine_grained_locking.append(".fine_grained_locking");
+    slab_handle_wrapping.append(".slab_handle_wrapping");
+    sample_period.append(".thread_safety_sample_period");
+    worker_threads.append(".validation_worker_threads");
+    deferred_shader_validation.append(".deferred_shader_validation");
     std::string list_of_config_enables = getLayerOption(enable_key.c_str());
     std::string list_of_env_enables = GetLayerEnvVar("VK_LAYER_ENABLES");
     std::string list_of_config_disables = getLayerOption(disable_key.c_str());
@@ -398,6 +435,14 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     std::string env_message_limit = GetLayerEnvVar("VK_LAYER_DUPLICATE_MESSAGE_LIMIT");
     std::string config_fine_grained_locking = getLayerOption(fine_grained_locking.c_str());
     std::string env_fine_grained_locking = GetLayerEnvVar("VK_LAYER_FINE_GRAINED_LOCKING");
+    std::string config_slab_handle_wrapping = getLayerOption(slab_handle_wrapping.c_str());
+    std::string env_slab_handle_wrapping = GetLayerEnvVar("VK_LAYER_SLAB_HANDLE_WRAPPING");
+    std::string config_sample_period = getLayerOption(sample_period.c_str());
+    std::string env_sample_period = GetLayerEnvVar("VK_LAYER_THREAD_SAFETY_SAMPLE_PERIOD");
+    std::string config_worker_threads = getLayerOption(worker_threads.c_str());
+    std::string env_worker_threads = GetLayerEnvVar("VK_LAYER_VALIDATION_WORKER_THREADS");
+    std::string config_deferred_shader_validation = getLayerOption(deferred_shader_validation.c_str());
+    std::string env_deferred_shader_validation = GetLayerEnvVar("VK_LAYER_DEFERRED_SHADER_VALIDATION");
 
 #if defined(_WIN32)
     std::string env_delimiter = ";";
@@ -421,4 +466,12 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         *settings_data->duplicate_message_limit = config_limit_setting;
     }
     *settings_data->fine_grained_locking = SetBool(config_fine_grained_locking, env_fine_grained_locking, true);
+    *settings_data->slab_handle_wrapping =
+        SetBool(config_slab_handle_wrapping, env_slab_handle_wrapping, *settings_data->slab_handle_wrapping);
+    *settings_data->thread_safety_sample_period =
+        SetUint32(config_sample_period, env_sample_period, *settings_data->thread_safety_sample_period);
+    *settings_data->validation_worker_threads =
+        SetUint32(config_worker_threads, env_worker_threads, *settings_data->validation_worker_threads);
+    *settings_data->deferred_shader_validation =
+        SetBool(config_deferred_shader_validation, env_deferred_shader_validation, *settings_data->deferred_shader_validation);
 }
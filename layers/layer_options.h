@@ -34,6 +34,11 @@ typedef struct {
     std::vector<uint32_t> &message_filter_list;
     int32_t *duplicate_message_limit;
     bool *fine_grained_locking;
+    bool *slab_handle_wrapping;
+    uint32_t *thread_safety_sample_period;
+    uint32_t *validation_worker_threads;
+    bool *deferred_shader_validation;
+    layer_data::unordered_map<std::string, std::string> *gpu_settings;
 } ConfigAndEnvSettings;
 
 static const layer_data::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
@@ -146,7 +146,7 @@ class ObjectLifetimes : public ValidationObject {
             // If object is an image, also look for it in the swapchain image map
             if ((object_type != kVulkanObjectTypeImage) || (swapchainImageMap.find(object_handle) == swapchainImageMap.end())) {
                 // Object not found, look for it in other device object maps
-                for (const auto &other_device_data : layer_data_map) {
+                for (const auto &other_device_data : layer_data_map.snapshot()) {
                     for (auto *layer_object_data : other_device_data.second->object_dispatch) {
                         if (layer_object_data->container_type == LayerObjectTypeObjectTracker) {
                             auto object_lifetime_data = reinterpret_cast<ObjectLifetimes *>(layer_object_data);
@@ -17,14 +17,18 @@
 
 #include "shader_module.h"
 
+#include <cstdio>
 #include <sstream>
 #include <string>
 
+#include <generated/spirv_tools_commit_id.h>
+#include "vk_layer_config.h"
 #include "vk_layer_data.h"
 #include "vk_layer_utils.h"
 #include "pipeline_state.h"
 #include "descriptor_sets.h"
 #include "spirv_grammar_helper.h"
+#include "xxhash.h"
 
 void decoration_set::merge(decoration_set const &other) {
     if (other.flags & location_bit) location = other.location;
@@ -274,8 +278,8 @@ layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology(const
     auto entrypoint_id = entrypoint.word(2);
     bool is_point_mode = false;
 
-    auto it = static_data_.execution_mode_inst.find(entrypoint_id);
-    if (it != static_data_.execution_mode_inst.end()) {
+    auto it = static_data_->execution_mode_inst.find(entrypoint_id);
+    if (it != static_data_->execution_mode_inst.end()) {
         for (auto insn : it->second) {
             switch (insn.word(2)) {
                 case spv::ExecutionModePointMode:
@@ -311,14 +315,14 @@ layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology(const
 }
 
 layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology() const {
-    if (static_data_.entry_points.size() > 0) {
-        const auto entrypoint = static_data_.entry_points.cbegin()->second;
+    if (static_data_->entry_points.size() > 0) {
+        const auto entrypoint = static_data_->entry_points.cbegin()->second;
         return GetTopology(get_def(entrypoint.offset));
     }
     return {};
 }
 
-SHADER_MODULE_STATE::SpirvStaticData::SpirvStaticData(const SHADER_MODULE_STATE &module_state) {
+void SHADER_MODULE_STATE::SpirvStaticData::Parse(const SHADER_MODULE_STATE &module_state) {
     for (auto insn : module_state) {
         const uint32_t result_word = OpcodeResultWord(insn.opcode());
         if (result_word != 0) {
@@ -467,21 +471,634 @@ std::unordered_multimap<std::string, SHADER_MODULE_STATE::EntryPoint> SHADER_MOD
     return entry_points;
 }
 
-void SHADER_MODULE_STATE::PreprocessShaderBinary(const spv_target_env env) {
-    if (static_data_.has_group_decoration) {
-        spvtools::Optimizer optimizer(env);
-        optimizer.RegisterPass(spvtools::CreateFlattenDecorationPass());
+namespace {
+// SPIRV-Tools objects that are costly to set up but can be reused between modules. They are kept per thread, which lets
+// them be used without locking, and per target environment as they are tied to one.
+class SpirvToolsThreadCache {
+  public:
+    static SpirvToolsThreadCache &Get() {
+        static thread_local SpirvToolsThreadCache cache;
+        return cache;
+    }
+
+    ~SpirvToolsThreadCache() {
+        for (auto &entry : contexts_) {
+            spvContextDestroy(entry.second);
+        }
+    }
+
+    spv_context Context(spv_target_env env) {
+        for (const auto &entry : contexts_) {
+            if (entry.first == env) return entry.second;
+        }
+        contexts_.emplace_back(env, spvContextCreate(env));
+        return contexts_.back().second;
+    }
+
+    // Optimizer running only the decoration flattening pass, as used by PreprocessShaderBinary()
+    spvtools::Optimizer &FlattenDecorationOptimizer(spv_target_env env) {
+        for (const auto &entry : flatten_optimizers_) {
+            if (entry.first == env) return *entry.second;
+        }
+        std::unique_ptr<spvtools::Optimizer> optimizer(new spvtools::Optimizer(env));
+        optimizer->RegisterPass(spvtools::CreateFlattenDecorationPass());
+        flatten_optimizers_.emplace_back(env, std::move(optimizer));
+        return *flatten_optimizers_.back().second;
+    }
+
+  private:
+    SpirvToolsThreadCache() = default;
+
+    std::vector<std::pair<spv_target_env, spv_context>> contexts_;
+    std::vector<std::pair<spv_target_env, std::unique_ptr<spvtools::Optimizer>>> flatten_optimizers_;
+};
+}  // namespace
+
+spv_context GetThreadSpirvContext(spv_target_env env) { return SpirvToolsThreadCache::Get().Context(env); }
+
+// static
+bool SHADER_MODULE_STATE::PreprocessShaderBinary(std::vector<uint32_t> &words, const spv_target_env env) {
+    bool has_group_decoration = false;
+    for (size_t offset = 5; offset < words.size() && !has_group_decoration;) {
+        const uint32_t len = words[offset] >> 16;
+        switch (words[offset] & 0x0ffffu) {
+            case spv::OpDecorationGroup:
+            case spv::OpGroupDecorate:
+            case spv::OpGroupMemberDecorate:
+                has_group_decoration = true;
+                break;
+        }
+        offset += len ? len : words.size();
+    }
+
+    if (has_group_decoration) {
+        auto &optimizer = SpirvToolsThreadCache::Get().FlattenDecorationOptimizer(env);
         std::vector<uint32_t> optimized_binary;
         // Run optimizer to flatten decorations only, set skip_validation so as to not re-run validator
         auto result = optimizer.Run(words.data(), words.size(), &optimized_binary, spvtools::ValidatorOptions(), true);
 
         if (result) {
-            // NOTE: We need to update words with the result from the spirv-tools optimizer.
-            // **THIS ONLY HAPPENS ON INITIALIZATION**. words should remain const for the lifetime
-            // of the SHADER_MODULE_STATE instance.
-            *const_cast<std::vector<uint32_t> *>(&words) = std::move(optimized_binary);
+            // NOTE: This has to happen before SpirvStaticData::Parse(), which keeps iterators into words.
+            words = std::move(optimized_binary);
+            return true;
+        }
+    }
+    return false;
+}
+
+// static
+bool SHADER_MODULE_STATE::HasWellFormedInstructions(const uint32_t *code, std::size_t word_count) {
+    if (word_count < 5 || code[0] != spv::MagicNumber) return false;
+    for (std::size_t offset = 5; offset < word_count;) {
+        const uint32_t length = code[offset] >> 16;
+        if (length == 0 || length > word_count - offset) return false;
+        // Parse() reads these operands without checking the length
+        const uint32_t opcode = code[offset] & 0x0ffffu;
+        uint32_t min_length = OpcodeResultWord(opcode) + 1;
+        switch (opcode) {
+            case spv::OpDecorate:
+                min_length = (length > 2 && (code[offset + 2] == spv::DecorationBuiltIn ||
+                                             code[offset + 2] == spv::DecorationSpecId)) ? 4 : 3;
+                break;
+            case spv::OpMemberDecorate:
+                min_length = (length > 3 && code[offset + 3] == spv::DecorationBuiltIn) ? 5 : 4;
+                break;
+            case spv::OpEntryPoint:
+                min_length = 4;
+                break;
+            case spv::OpExecutionMode:
+            case spv::OpExecutionModeId:
+            case spv::OpGroupDecorate:
+                min_length = 2;
+                break;
+        }
+        if (length < min_length) return false;
+        offset += length;
+    }
+    return true;
+}
+
+// static
+std::shared_ptr<const SHADER_MODULE_STATE::SpirvStaticData> SHADER_MODULE_STATE::BuildStaticData(const uint32_t *code,
+                                                                                                 std::size_t word_count,
+                                                                                                 spv_target_env env) {
+    auto static_data = std::make_shared<SpirvStaticData>(code, word_count);
+    static_data->preprocessed = PreprocessShaderBinary(static_data->words, env);
+    // Parsing walks the module through a temporary state object that already refers to the data being built
+    const SHADER_MODULE_STATE module_state(static_data);
+    static_data->Parse(module_state);
+    static_data->has_group_decoration |= static_data->preprocessed;
+    return static_data;
+}
+
+// static
+std::shared_ptr<const SHADER_MODULE_STATE::SpirvStaticData> SHADER_MODULE_STATE::GetStaticData(
+    const VkShaderModuleCreateInfo &create_info, spv_target_env env) {
+    return SpirvStaticDataCache::Get().Acquire(create_info.pCode, create_info.codeSize / sizeof(uint32_t), env);
+}
+
+static void EncodeArray(std::vector<uint32_t> &out, const std::vector<uint32_t> &values) {
+    out.push_back(static_cast<uint32_t>(values.size()));
+    out.insert(out.end(), values.begin(), values.end());
+}
+
+static void EncodeOffsetMap(std::vector<uint32_t> &out, const std::unordered_multimap<uint32_t, uint32_t> &map) {
+    out.push_back(static_cast<uint32_t>(map.size()));
+    for (const auto &entry : map) {
+        out.push_back(entry.first);
+        out.push_back(entry.second);
+    }
+}
+
+static void EncodeStructMember(std::vector<uint32_t> &out, const shader_struct_member &member) {
+    out.push_back(member.offset);
+    out.push_back(member.size);
+    EncodeArray(out, member.array_length_hierarchy);
+    EncodeArray(out, member.array_block_size);
+    out.push_back(static_cast<uint32_t>(member.struct_members.size()));
+    for (const auto &child : member.struct_members) {
+        EncodeStructMember(out, child);
+    }
+}
+
+void SHADER_MODULE_STATE::SpirvStaticData::Serialize(std::vector<uint32_t> &out) const {
+    out.push_back(preprocessed ? 1 : 0);
+    if (preprocessed) {
+        EncodeArray(out, words);
+    }
+
+    out.push_back(static_cast<uint32_t>(def_index.size()));
+    for (const auto &entry : def_index) {
+        out.push_back(entry.first);
+        out.push_back(entry.second);
+    }
+    out.push_back(static_cast<uint32_t>(decorations.size()));
+    for (const auto &entry : decorations) {
+        const auto &decoration = entry.second;
+        out.insert(out.end(), {entry.first, decoration.flags, decoration.location, decoration.component,
+                               decoration.input_attachment_index, decoration.descriptor_set, decoration.binding,
+                               decoration.builtin, decoration.spec_const_id});
+    }
+    out.push_back(static_cast<uint32_t>(spec_const_map.size()));
+    for (const auto &entry : spec_const_map) {
+        out.push_back(entry.first);
+        out.push_back(entry.second);
+    }
+    out.push_back(static_cast<uint32_t>(decoration_inst.size()));
+    for (const auto &insn : decoration_inst) {
+        out.push_back(insn.offset());
+    }
+    out.push_back(static_cast<uint32_t>(member_decoration_inst.size()));
+    for (const auto &insn : member_decoration_inst) {
+        out.push_back(insn.offset());
+    }
+    out.push_back(static_cast<uint32_t>(execution_mode_inst.size()));
+    for (const auto &entry : execution_mode_inst) {
+        out.push_back(entry.first);
+        out.push_back(static_cast<uint32_t>(entry.second.size()));
+        for (const auto &insn : entry.second) {
+            out.push_back(insn.offset());
+        }
+    }
+    out.push_back(static_cast<uint32_t>(builtin_decoration_list.size()));
+    for (const auto &builtin : builtin_decoration_list) {
+        out.push_back(builtin.offset);
+        out.push_back(static_cast<uint32_t>(builtin.builtin));
+    }
+    out.push_back(static_cast<uint32_t>(atomic_inst.size()));
+    for (const auto &entry : atomic_inst) {
+        out.insert(out.end(), {entry.first, entry.second.storage_class, entry.second.bit_width, entry.second.type});
+    }
+    out.insert(out.end(), {has_group_decoration ? 1u : 0u, has_specialization_constants ? 1u : 0u,
+                           has_invocation_repack_instruction ? 1u : 0u, multiple_entry_points ? 1u : 0u});
+
+    out.push_back(static_cast<uint32_t>(entry_points.size()));
+    for (const auto &entry : entry_points) {
+        const auto &name = entry.first;
+        std::vector<uint32_t> packed_name((name.size() + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0);
+        if (!name.empty()) std::memcpy(packed_name.data(), name.data(), name.size());
+        out.push_back(static_cast<uint32_t>(name.size()));
+        out.insert(out.end(), packed_name.begin(), packed_name.end());
+
+        const auto &entry_point = entry.second;
+        out.push_back(entry_point.offset);
+        out.push_back(static_cast<uint32_t>(entry_point.stage));
+        EncodeOffsetMap(out, entry_point.decorate_list);
+        out.push_back(static_cast<uint32_t>(entry_point.function_set_list.size()));
+        for (const auto &func_set : entry_point.function_set_list) {
+            out.insert(out.end(), {func_set.id, func_set.offset, func_set.length});
+            EncodeOffsetMap(out, func_set.op_lists);
+        }
+
+        // Only the root of the push constant block tracks which bytes are used
+        const auto &push_constants = entry_point.push_constant_used_in_shader;
+        const auto *used_bytes = push_constants.GetUsedbytes();
+        out.push_back(used_bytes ? 1 : 0);
+        EncodeStructMember(out, push_constants);
+        if (used_bytes) {
+            out.push_back(static_cast<uint32_t>(used_bytes->size()));
+            for (const auto used : *used_bytes) {
+                out.push_back(used);
+            }
+        }
+    }
+}
+
+namespace {
+// Bounds checked reads of an encoding produced by SpirvStaticData::Serialize()
+struct SpirvStaticDataDecoder {
+    const uint32_t *data;
+    const uint32_t *end;
+    // Marks the first word of every instruction of the module the offsets index
+    std::vector<bool> instruction_starts;
+    bool valid = true;
+
+    SpirvStaticDataDecoder(const uint32_t *data, std::size_t size) : data(data), end(data + size) {}
+
+    uint32_t Next() {
+        if (data == end) {
+            valid = false;
+            return 0;
+        }
+        return *data++;
+    }
+    // Element counts are checked against the remaining size, so corrupt input can't trigger huge allocations
+    uint32_t Count(uint32_t words_per_element) {
+        const uint32_t count = Next();
+        if (static_cast<uint64_t>(count) * words_per_element > static_cast<uint64_t>(end - data)) {
+            valid = false;
+            return 0;
+        }
+        return count;
+    }
+    // Walks the instructions of words, which must exactly fill it
+    void SetModule(const std::vector<uint32_t> &words) {
+        if (words.size() < 5 || words[0] != spv::MagicNumber) {
+            valid = false;
+            return;
+        }
+        instruction_starts.assign(words.size(), false);
+        for (std::size_t offset = 5; offset < words.size();) {
+            const uint32_t length = words[offset] >> 16;
+            if (length == 0 || length > words.size() - offset) {
+                valid = false;
+                return;
+            }
+            instruction_starts[offset] = true;
+            offset += length;
+        }
+    }
+    // Iterators are rebuilt from offsets, which must therefore be the start of an instruction
+    uint32_t Offset() {
+        const uint32_t offset = Next();
+        if (offset >= instruction_starts.size() || !instruction_starts[offset]) {
+            valid = false;
+            return 0;
+        }
+        return offset;
+    }
+    void Array(std::vector<uint32_t> &values) {
+        const uint32_t count = Count(1);
+        values.assign(data, data + count);
+        data += count;
+    }
+    void OffsetMap(std::unordered_multimap<uint32_t, uint32_t> &map) {
+        const uint32_t count = Count(2);
+        map.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const uint32_t key = Next();
+            map.emplace(key, Offset());
+        }
+    }
+    void StructMember(shader_struct_member &member, shader_struct_member *root, uint32_t depth) {
+        // The deepest real push constant block is far shallower than this; corrupt input could be arbitrarily deep
+        if (depth > 64) {
+            valid = false;
+            return;
+        }
+        member.root = root;
+        member.offset = Next();
+        member.size = Next();
+        Array(member.array_length_hierarchy);
+        Array(member.array_block_size);
+        const uint32_t count = Count(4);
+        member.struct_members.resize(count);
+        for (auto &child : member.struct_members) {
+            if (!valid) break;
+            StructMember(child, root, depth + 1);
+        }
+    }
+};
+}  // namespace
+
+// static
+std::shared_ptr<SHADER_MODULE_STATE::SpirvStaticData> SHADER_MODULE_STATE::SpirvStaticData::Deserialize(const uint32_t *code,
+                                                                                                         std::size_t word_count,
+                                                                                                         const uint32_t *data,
+                                                                                                         std::size_t data_size) {
+    auto static_data = std::make_shared<SpirvStaticData>();
+    SpirvStaticDataDecoder decoder(data, data_size);
+
+    static_data->preprocessed = decoder.Next() != 0;
+    if (static_data->preprocessed) {
+        decoder.Array(static_data->words);
+        // Preprocessing rewrites instructions, but keeps the header of the module it was made from
+        if (static_data->words.size() < 2 || word_count < 2 || static_data->words[0] != code[0] ||
+            static_data->words[1] != code[1]) {
+            return nullptr;
+        }
+    } else {
+        static_data->words.assign(code, code + word_count);
+    }
+    decoder.SetModule(static_data->words);
+    if (!decoder.valid) return nullptr;
+    const auto &words = static_data->words;
+    auto at = [&words](uint32_t offset) { return spirv_inst_iter(words.begin(), words.begin() + offset); };
+
+    uint32_t count = decoder.Count(2);
+    static_data->def_index.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t id = decoder.Next();
+        static_data->def_index[id] = decoder.Offset();
+    }
+    count = decoder.Count(9);
+    static_data->decorations.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        auto &decoration = static_data->decorations[decoder.Next()];
+        decoration.flags = decoder.Next();
+        decoration.location = decoder.Next();
+        decoration.component = decoder.Next();
+        decoration.input_attachment_index = decoder.Next();
+        decoration.descriptor_set = decoder.Next();
+        decoration.binding = decoder.Next();
+        decoration.builtin = decoder.Next();
+        decoration.spec_const_id = decoder.Next();
+    }
+    count = decoder.Count(2);
+    static_data->spec_const_map.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t spec_id = decoder.Next();
+        static_data->spec_const_map[spec_id] = decoder.Next();
+    }
+    count = decoder.Count(1);
+    static_data->decoration_inst.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        static_data->decoration_inst.push_back(at(decoder.Offset()));
+    }
+    count = decoder.Count(1);
+    static_data->member_decoration_inst.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        static_data->member_decoration_inst.push_back(at(decoder.Offset()));
+    }
+    count = decoder.Count(2);
+    for (uint32_t i = 0; i < count && decoder.valid; ++i) {
+        auto &insns = static_data->execution_mode_inst[decoder.Next()];
+        const uint32_t insn_count = decoder.Count(1);
+        for (uint32_t j = 0; j < insn_count; ++j) {
+            insns.push_back(at(decoder.Offset()));
+        }
+    }
+    count = decoder.Count(2);
+    static_data->builtin_decoration_list.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t offset = decoder.Offset();
+        static_data->builtin_decoration_list.emplace_back(offset, static_cast<spv::BuiltIn>(decoder.Next()));
+    }
+    count = decoder.Count(4);
+    for (uint32_t i = 0; i < count; ++i) {
+        auto &atomic = static_data->atomic_inst[decoder.Offset()];
+        atomic.storage_class = decoder.Next();
+        atomic.bit_width = decoder.Next();
+        atomic.type = decoder.Next();
+    }
+    static_data->has_group_decoration = decoder.Next() != 0;
+    static_data->has_specialization_constants = decoder.Next() != 0;
+    static_data->has_invocation_repack_instruction = decoder.Next() != 0;
+    static_data->multiple_entry_points = decoder.Next() != 0;
+
+    count = decoder.Count(8);
+    for (uint32_t i = 0; i < count && decoder.valid; ++i) {
+        const uint32_t name_size = decoder.Next();
+        const uint32_t name_words = static_cast<uint32_t>((static_cast<uint64_t>(name_size) + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+        if (name_words > static_cast<uint64_t>(decoder.end - decoder.data)) {
+            decoder.valid = false;
+            break;
+        }
+        const std::string name(reinterpret_cast<const char *>(decoder.data), name_size);
+        decoder.data += name_words;
+
+        auto &entry_point = static_data->entry_points.emplace(name, EntryPoint{})->second;
+        entry_point.offset = decoder.Offset();
+        entry_point.stage = static_cast<VkShaderStageFlagBits>(decoder.Next());
+        decoder.OffsetMap(entry_point.decorate_list);
+        const uint32_t func_set_count = decoder.Count(4);
+        entry_point.function_set_list.resize(func_set_count);
+        for (auto &func_set : entry_point.function_set_list) {
+            func_set.id = decoder.Next();
+            func_set.offset = decoder.Offset();
+            func_set.length = decoder.Next();
+            if (static_cast<uint64_t>(func_set.offset) + func_set.length > words.size()) decoder.valid = false;
+            decoder.OffsetMap(func_set.op_lists);
+        }
+
+        auto &push_constants = entry_point.push_constant_used_in_shader;
+        const bool is_root = decoder.Next() != 0;
+        decoder.StructMember(push_constants, is_root ? &push_constants : nullptr, 0);
+        if (is_root && decoder.valid) {
+            auto &used_bytes = *push_constants.GetUsedbytes();
+            used_bytes.resize(decoder.Count(1));
+            for (auto &used : used_bytes) {
+                used = static_cast<uint8_t>(decoder.Next());
+            }
+        }
+    }
+
+    if (!decoder.valid || decoder.data != decoder.end) {
+        return nullptr;
+    }
+    return static_data;
+}
+
+SpirvStaticDataCache &SpirvStaticDataCache::Get() {
+    // Leaked on purpose, shader module state can outlive static destruction in applications that never clean up
+    static SpirvStaticDataCache *cache = new SpirvStaticDataCache();
+    return *cache;
+}
+
+// static
+SpirvStaticDataCache::Key SpirvStaticDataCache::MakeKey(const uint32_t *code, std::size_t word_count, spv_target_env env) {
+    Key key;
+    key.hash[0] = XXH64(code, word_count * sizeof(uint32_t), 0);
+    key.hash[1] = XXH64(code, word_count * sizeof(uint32_t), 0x9e3779b97f4a7c15ull);
+    key.word_count = static_cast<uint32_t>(word_count);
+    key.env = static_cast<uint32_t>(env);
+    return key;
+}
+
+std::shared_ptr<const SpirvStaticDataCache::StaticData> SpirvStaticDataCache::Acquire(const uint32_t *code, std::size_t word_count,
+                                                                                      spv_target_env env) {
+    const Key key = MakeKey(code, word_count, env);
+    std::vector<uint32_t> encoded;
+    bool persistent;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            it->second.unused_runs = 0;
+            auto data = it->second.data.lock();
+            if (data) return data;
+            encoded = it->second.encoded;
+        }
+        persistent = persistent_;
+    }
+
+    // Decoding or parsing happens unlocked, so identical modules created concurrently may both do the work once
+    std::shared_ptr<const StaticData> data;
+    if (!encoded.empty()) {
+        data = StaticData::Deserialize(code, word_count, encoded.data(), encoded.size());
+        if (data) encoded.clear();  // already stored
+    }
+    if (!data) {
+        data = SHADER_MODULE_STATE::BuildStaticData(code, word_count, env);
+        encoded.clear();
+        if (persistent) data->Serialize(encoded);
+    }
+
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &entry = entries_[key];
+    entry.unused_runs = 0;
+    auto existing = entry.data.lock();
+    if (existing) return existing;
+    entry.data = data;
+    if (!encoded.empty()) {
+        encoded_words_ -= entry.encoded.size();
+        if (encoded_words_ + encoded.size() <= kMaxEncodedWords) {
+            entry.encoded = std::move(encoded);
+            encoded_words_ += entry.encoded.size();
+        } else {
+            entry.encoded.clear();
+        }
+    }
+
+    // Entries that are neither in use nor persistent only cost the key, drop them once they build up
+    if (entries_.size() >= sweep_size_) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->second.encoded.empty() && it->second.data.expired()) {
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        sweep_size_ = (2 * entries_.size() > kMinSweepSize) ? 2 * entries_.size() : kMinSweepSize;
+    }
+    return data;
+}
+
+// File layout: header size, version, SPIRV-Tools commit hash (2 words), then per entry the key (6 words), the number of
+// runs since it was last used, the checksum of the encoding (2 words), the encoded size and the encoding itself.
+static const uint32_t kSpirvStaticDataCacheHeaderSize = 4 * sizeof(uint32_t);
+static const uint32_t kSpirvStaticDataCacheRecordHeaderWords = 10;
+// Bump whenever SpirvStaticData or its encoding changes
+static const uint32_t kSpirvStaticDataCacheVersion = 2;
+
+static uint64_t SpirvToolsCommitHash() { return XXH64(SPIRV_TOOLS_COMMIT_ID, strlen(SPIRV_TOOLS_COMMIT_ID), 0); }
+
+// Seeded with the key, so that an encoding is only accepted for the module it was made from
+static uint64_t SpirvStaticDataChecksum(const uint32_t *encoded, std::size_t size, uint64_t key_hash) {
+    return XXH64(encoded, size * sizeof(uint32_t), key_hash);
+}
+
+bool SpirvStaticDataCache::Load(const std::string &path) {
+    FILE *read_file = fopen(path.c_str(), "rb");
+    if (!read_file) return false;
+    std::vector<uint32_t> file_data;
+    uint32_t buffer[4096];
+    size_t read_count;
+    while ((read_count = fread(buffer, sizeof(uint32_t), 4096, read_file)) > 0) {
+        file_data.insert(file_data.end(), buffer, buffer + read_count);
+    }
+    fclose(read_file);
+
+    std::lock_guard<std::mutex> guard(lock_);
+    persistent_ = true;
+
+    const uint64_t commit_hash = SpirvToolsCommitHash();
+    if (file_data.size() < 4 || file_data[0] != kSpirvStaticDataCacheHeaderSize || file_data[1] != kSpirvStaticDataCacheVersion ||
+        file_data[2] != static_cast<uint32_t>(commit_hash) || file_data[3] != static_cast<uint32_t>(commit_hash >> 32)) {
+        return false;
+    }
+
+    const uint32_t *data = file_data.data() + 4;
+    const uint32_t *end = file_data.data() + file_data.size();
+    while (end - data >= kSpirvStaticDataCacheRecordHeaderWords) {
+        Key key;
+        key.hash[0] = data[0] | (static_cast<uint64_t>(data[1]) << 32);
+        key.hash[1] = data[2] | (static_cast<uint64_t>(data[3]) << 32);
+        key.word_count = data[4];
+        key.env = data[5];
+        const uint32_t unused_runs = data[6];
+        const uint64_t checksum = data[7] | (static_cast<uint64_t>(data[8]) << 32);
+        const uint32_t size = data[9];
+        data += kSpirvStaticDataCacheRecordHeaderWords;
+        if (size > static_cast<uint64_t>(end - data)) return false;
+
+        // Entries that are damaged, stale or past the size limit are left out, and so are not written again by Save()
+        if (size > 0 && unused_runs < kMaxUnusedRuns && encoded_words_ + size <= kMaxEncodedWords &&
+            SpirvStaticDataChecksum(data, size, key.hash[0]) == checksum) {
+            auto &entry = entries_[key];
+            if (entry.encoded.empty()) {
+                entry.encoded.assign(data, data + size);
+                entry.unused_runs = unused_runs + 1;
+                encoded_words_ += size;
+            }
+        }
+        data += size;
+    }
+    return true;
+}
+
+bool SpirvStaticDataCache::Save(const std::string &path) {
+    const uint64_t commit_hash = SpirvToolsCommitHash();
+    std::vector<uint32_t> file_data = {kSpirvStaticDataCacheHeaderSize, kSpirvStaticDataCacheVersion,
+                                       static_cast<uint32_t>(commit_hash), static_cast<uint32_t>(commit_hash >> 32)};
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        using SavedEntry = std::pair<const Key, Entry>;
+        std::vector<SavedEntry *> saved;
+        saved.reserve(entries_.size());
+        for (auto &entry : entries_) {
+            if (entry.second.unused_runs >= kMaxUnusedRuns) continue;
+            if (entry.second.encoded.empty()) {
+                auto data = entry.second.data.lock();
+                if (!data) continue;
+                std::vector<uint32_t> encoded;
+                data->Serialize(encoded);
+                if (encoded_words_ + encoded.size() > kMaxEncodedWords) continue;
+                entry.second.encoded = std::move(encoded);
+                encoded_words_ += entry.second.encoded.size();
+            }
+            saved.push_back(&entry);
+        }
+        // Most recently used first, so that they are the ones kept by Load() if the limits are lowered
+        std::stable_sort(saved.begin(), saved.end(), [](const SavedEntry *a, const SavedEntry *b) {
+            return a->second.unused_runs < b->second.unused_runs;
+        });
+
+        file_data.reserve(file_data.size() + encoded_words_ + kSpirvStaticDataCacheRecordHeaderWords * saved.size());
+        for (const auto *entry : saved) {
+            const auto &key = entry->first;
+            const auto &encoded = entry->second.encoded;
+            const uint64_t checksum = SpirvStaticDataChecksum(encoded.data(), encoded.size(), key.hash[0]);
+            file_data.insert(file_data.end(), {static_cast<uint32_t>(key.hash[0]), static_cast<uint32_t>(key.hash[0] >> 32),
+                                               static_cast<uint32_t>(key.hash[1]), static_cast<uint32_t>(key.hash[1] >> 32),
+                                               key.word_count, key.env, entry->second.unused_runs,
+                                               static_cast<uint32_t>(checksum), static_cast<uint32_t>(checksum >> 32),
+                                               static_cast<uint32_t>(encoded.size())});
+            file_data.insert(file_data.end(), encoded.begin(), encoded.end());
         }
     }
+
+    return ReplaceCacheFile(path, file_data.data(), file_data.size() * sizeof(uint32_t));
 }
 
 char const *StorageClassName(uint32_t sc) {
@@ -620,7 +1237,7 @@ std::string SHADER_MODULE_STATE::DescribeInstruction(const spirv_inst_iter &insn
 
 const SHADER_MODULE_STATE::EntryPoint *SHADER_MODULE_STATE::FindEntrypointStruct(char const *name,
                                                                                  VkShaderStageFlagBits stageBits) const {
-    auto range = static_data_.entry_points.equal_range(name);
+    auto range = static_data_->entry_points.equal_range(name);
     for (auto it = range.first; it != range.second; ++it) {
         if (it->second.stage == stageBits) {
             return &(it->second);
@@ -630,7 +1247,7 @@ const SHADER_MODULE_STATE::EntryPoint *SHADER_MODULE_STATE::FindEntrypointStruct
 }
 
 spirv_inst_iter SHADER_MODULE_STATE::FindEntrypoint(char const *name, VkShaderStageFlagBits stageBits) const {
-    auto range = static_data_.entry_points.equal_range(name);
+    auto range = static_data_->entry_points.equal_range(name);
     for (auto it = range.first; it != range.second; ++it) {
         if (it->second.stage == stageBits) {
             return at(it->second.offset);
@@ -647,7 +1264,7 @@ bool SHADER_MODULE_STATE::FindLocalSize(const spirv_inst_iter &entrypoint, uint3
                                         uint32_t &local_size_z) const {
     // "If an object is decorated with the WorkgroupSize decoration, this takes precedence over any LocalSize or LocalSizeId
     // execution mode."
-    for (const auto &builtin : static_data_.builtin_decoration_list) {
+    for (const auto &builtin : static_data_->builtin_decoration_list) {
         if (builtin.builtin == spv::BuiltInWorkgroupSize) {
             const uint32_t workgroup_size_id = at(builtin.offset).word(1);
             auto composite_def = get_def(workgroup_size_id);
@@ -662,8 +1279,8 @@ bool SHADER_MODULE_STATE::FindLocalSize(const spirv_inst_iter &entrypoint, uint3
     }
 
     auto entrypoint_id = entrypoint.word(2);
-    auto it = static_data_.execution_mode_inst.find(entrypoint_id);
-    if (it != static_data_.execution_mode_inst.end()) {
+    auto it = static_data_->execution_mode_inst.find(entrypoint_id);
+    if (it != static_data_->execution_mode_inst.end()) {
         for (auto insn : it->second) {
             if (insn.opcode() == spv::OpExecutionMode && insn.word(2) == spv::ExecutionModeLocalSize) {
                 local_size_x = insn.word(3);
@@ -1495,7 +2112,7 @@ void SHADER_MODULE_STATE::IsSpecificDescriptorType(const spirv_inst_iter &id_it,
         case spv::OpTypeStruct: {
             layer_data::unordered_set<uint32_t> nonwritable_members;
             if (get_decorations(type.word(1)).flags & decoration_set::buffer_block_bit) is_storage_buffer = true;
-            for (auto insn : static_data_.member_decoration_inst) {
+            for (auto insn : static_data_->member_decoration_inst) {
                 if (insn.word(1) == type.word(1) && insn.word(3) == spv::DecorationNonWritable) {
                     nonwritable_members.insert(insn.word(2));
                 }
@@ -1627,7 +2244,7 @@ bool SHADER_MODULE_STATE::CollectInterfaceBlockMembers(std::map<location_t, inte
     layer_data::unordered_map<uint32_t, uint32_t> member_patch;
 
     // Walk all the OpMemberDecorate for type's result id -- first pass, collect components.
-    for (auto insn : static_data_.member_decoration_inst) {
+    for (auto insn : static_data_->member_decoration_inst) {
         if (insn.word(1) == type.word(1)) {
             uint32_t member_index = insn.word(2);
 
@@ -1649,7 +2266,7 @@ bool SHADER_MODULE_STATE::CollectInterfaceBlockMembers(std::map<location_t, inte
     // TODO: correctly handle location assignment from outside
 
     // Second pass -- produce the output, from Location decorations
-    for (auto insn : static_data_.member_decoration_inst) {
+    for (auto insn : static_data_->member_decoration_inst) {
         if (insn.word(1) == type.word(1)) {
             uint32_t member_index = insn.word(2);
             uint32_t member_type_id = type.word(2 + member_index);
@@ -1750,7 +2367,7 @@ std::vector<uint32_t> SHADER_MODULE_STATE::CollectBuiltinBlockMembers(spirv_inst
 
         // Now find all members belonging to the struct defining the IO block
         if (def.opcode() == spv::OpTypeStruct) {
-            for (auto set : static_data_.builtin_decoration_list) {
+            for (auto set : static_data_->builtin_decoration_list) {
                 auto insn = at(set.offset);
                 if ((insn.opcode() == spv::OpMemberDecorate) && (def.word(1) == insn.word(1))) {
                     // Start with undefined builtin for each struct member.
@@ -1773,7 +2390,7 @@ std::vector<std::pair<uint32_t, interface_var>> SHADER_MODULE_STATE::CollectInte
     layer_data::unordered_set<uint32_t> const &accessible_ids) const {
     std::vector<std::pair<uint32_t, interface_var>> out;
 
-    for (auto insn : static_data_.decoration_inst) {
+    for (auto insn : static_data_->decoration_inst) {
         if (insn.word(2) == spv::DecorationInputAttachmentIndex) {
             auto attachment_index = insn.word(3);
             auto id = insn.word(1);
@@ -20,8 +20,13 @@
 #define VULKAN_SHADER_MODULE_H
 
 #include <cassert>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -220,6 +225,49 @@ struct shader_struct_member {
 
 struct shader_module_used_operators;
 
+// SPIR-V validation moved off the vkCreateShaderModule path. It is run by a worker or by the first pipeline creation that
+// needs its result, whichever gets to it first.
+class DeferredSpirvValidation {
+  public:
+    // validate reports its own errors and returns the skip result
+    explicit DeferredSpirvValidation(std::function<bool()> &&validate) : validate_(std::move(validate)) {}
+
+    // Does nothing if another thread has already started the validation
+    void Run() {
+        std::function<bool()> validate;
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            if (state_ != kPending) return;
+            state_ = kRunning;
+            validate = std::move(validate_);
+        }
+        const bool skip = validate();
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            skip_ = skip;
+            state_ = kDone;
+        }
+        done_.notify_all();
+    }
+
+    // Returns the skip result, running the validation on this thread if it hasn't started yet
+    bool Wait() {
+        Run();
+        std::unique_lock<std::mutex> lock(lock_);
+        done_.wait(lock, [this] { return state_ == kDone; });
+        return skip_;
+    }
+
+  private:
+    enum State { kPending, kRunning, kDone };
+
+    std::mutex lock_;
+    std::condition_variable done_;
+    State state_ = kPending;
+    std::function<bool()> validate_;
+    bool skip_ = false;
+};
+
 struct SHADER_MODULE_STATE : public BASE_NODE {
     struct EntryPoint {
         uint32_t offset;  // into module to get OpEntryPoint instruction
@@ -230,9 +278,25 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     };
 
     // Static/const data extracted from a SPIRV module.
+    // Immutable once built, and shared by every module created from the same SPIR-V (see SpirvStaticDataCache).
     struct SpirvStaticData {
         SpirvStaticData() = default;
-        SpirvStaticData(const SHADER_MODULE_STATE &module_state);
+        SpirvStaticData(const uint32_t *code, std::size_t word_count) : words(code, code + word_count) {}
+
+        // Fills in everything but words, which module_state must refer to.
+        void Parse(const SHADER_MODULE_STATE &module_state);
+
+        // Flat encoding used by the on-disk cache. Iterators are stored as offsets into words, which are only
+        // part of the encoding if preprocessing changed them from the original SPIR-V.
+        void Serialize(std::vector<uint32_t> &out) const;
+        // Returns nullptr if the encoding is malformed
+        static std::shared_ptr<SpirvStaticData> Deserialize(const uint32_t *code, std::size_t word_count, const uint32_t *data,
+                                                            std::size_t data_size);
+
+        // The spirv image itself
+        // NOTE: this may end up being an _optimized_ version of what was passed in at initialization time.
+        std::vector<uint32_t> words;
+        bool preprocessed{false};
 
         // A mapping of <id> to the first word of its def. this is useful because walking type
         // trees, constant expressions, etc requires jumping all over the instruction stream.
@@ -259,21 +323,21 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         bool multiple_entry_points{false};
     };
 
-    // The spirv image itself
     // NOTE: this _must_ be initialized first.
-    // NOTE: this may end up being an _optimized_ version of what was passed in at initialization time.
-    const std::vector<uint32_t> words;
+    const std::shared_ptr<const SpirvStaticData> static_data_;
 
-    const SpirvStaticData static_data_;
+    // The spirv image itself, owned by static_data_ so that iterators into it stay valid across modules
+    const std::vector<uint32_t> &words;
 
     const bool has_valid_spirv{false};
     const uint32_t gpu_validation_shader_id{std::numeric_limits<uint32_t>::max()};
+    // Set before the module is added to the state map if its SPIR-V validation was deferred
+    std::shared_ptr<DeferredSpirvValidation> deferred_spirv_validation;
 
     SHADER_MODULE_STATE(const uint32_t *code, std::size_t count, spv_target_env env = SPV_ENV_VULKAN_1_0)
         : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
-          words(code, code + (count / sizeof(uint32_t))) {
-        PreprocessShaderBinary(env);
-    }
+          static_data_(std::make_shared<SpirvStaticData>(code, count / sizeof(uint32_t))),
+          words(static_data_->words) {}
 
     template <typename SpirvContainer>
     SHADER_MODULE_STATE(const SpirvContainer &spirv)
@@ -281,49 +345,56 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, spv_target_env env, uint32_t unique_shader_id)
         : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
-          words(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
-          static_data_(*this),
+          static_data_(GetStaticData(create_info, env)),
+          words(static_data_->words),
           has_valid_spirv(true),
-          gpu_validation_shader_id(unique_shader_id) {
-        PreprocessShaderBinary(env);
-    }
+          gpu_validation_shader_id(unique_shader_id) {}
 
     SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, VkShaderModule shaderModule, spv_target_env env,
                         uint32_t unique_shader_id)
         : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
-          words(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
-          static_data_(*this),
+          static_data_(GetStaticData(create_info, env)),
+          words(static_data_->words),
           has_valid_spirv(true),
-          gpu_validation_shader_id(unique_shader_id) {
-        PreprocessShaderBinary(env);
-    }
+          gpu_validation_shader_id(unique_shader_id) {}
 
-    SHADER_MODULE_STATE() : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule) {}
+    SHADER_MODULE_STATE()
+        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
+          static_data_(std::make_shared<SpirvStaticData>()),
+          words(static_data_->words) {}
 
-    const std::vector<spirv_inst_iter> &GetDecorationInstructions() const { return static_data_.decoration_inst; }
+    // True if code starts with a SPIR-V header, its instructions exactly fill it, and each is long enough for the operands
+    // Parse() reads from it unchecked, so that walking them terminates and stays within the module. Says nothing else
+    // about whether the module is valid.
+    static bool HasWellFormedInstructions(const uint32_t *code, std::size_t word_count);
 
-    const std::unordered_map<uint32_t, atomic_instruction> &GetAtomicInstructions() const { return static_data_.atomic_inst; }
+    // Preprocesses and parses code, without going through SpirvStaticDataCache
+    static std::shared_ptr<const SpirvStaticData> BuildStaticData(const uint32_t *code, std::size_t word_count, spv_target_env env);
+
+    const std::vector<spirv_inst_iter> &GetDecorationInstructions() const { return static_data_->decoration_inst; }
+
+    const std::unordered_map<uint32_t, atomic_instruction> &GetAtomicInstructions() const { return static_data_->atomic_inst; }
 
     const layer_data::unordered_map<uint32_t, std::vector<spirv_inst_iter>> &GetExecutionModeInstructions() const {
-        return static_data_.execution_mode_inst;
+        return static_data_->execution_mode_inst;
     }
 
-    const std::vector<builtin_set> &GetBuiltinDecorationList() const { return static_data_.builtin_decoration_list; }
+    const std::vector<builtin_set> &GetBuiltinDecorationList() const { return static_data_->builtin_decoration_list; }
 
-    const layer_data::unordered_map<uint32_t, uint32_t> &GetSpecConstMap() const { return static_data_.spec_const_map; }
+    const layer_data::unordered_map<uint32_t, uint32_t> &GetSpecConstMap() const { return static_data_->spec_const_map; }
 
-    bool HasSpecConstants() const { return static_data_.has_specialization_constants; }
+    bool HasSpecConstants() const { return static_data_->has_specialization_constants; }
 
-    const std::unordered_multimap<std::string, EntryPoint> &GetEntryPoints() const { return static_data_.entry_points; }
+    const std::unordered_multimap<std::string, EntryPoint> &GetEntryPoints() const { return static_data_->entry_points; }
 
-    bool HasMultipleEntryPoints() const { return static_data_.multiple_entry_points; }
+    bool HasMultipleEntryPoints() const { return static_data_->multiple_entry_points; }
 
     VkShaderModule vk_shader_module() const { return handle_.Cast<VkShaderModule>(); }
 
     decoration_set get_decorations(uint32_t id) const {
         // return the actual decorations for this id, or a default set.
-        auto it = static_data_.decorations.find(id);
-        if (it != static_data_.decorations.end()) return it->second;
+        auto it = static_data_->decorations.find(id);
+        if (it != static_data_->decorations.end()) return it->second;
         return decoration_set();
     }
 
@@ -335,8 +406,8 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(uint32_t id) const {
-        auto it = static_data_.def_index.find(id);
-        if (it == static_data_.def_index.end()) {
+        auto it = static_data_->def_index.find(id);
+        if (it == static_data_->def_index.end()) {
             return end();
         }
         return at(it->second);
@@ -409,11 +480,76 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
   private:
     // Functions used for initialization only
     // Used to populate the shader module object
-    void PreprocessShaderBinary(spv_target_env env);
+    explicit SHADER_MODULE_STATE(const std::shared_ptr<const SpirvStaticData> &static_data)
+        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
+          static_data_(static_data),
+          words(static_data_->words) {}
+
+    static std::shared_ptr<const SpirvStaticData> GetStaticData(const VkShaderModuleCreateInfo &create_info, spv_target_env env);
+    static bool PreprocessShaderBinary(std::vector<uint32_t> &words, spv_target_env env);
 
     static std::unordered_multimap<std::string, EntryPoint> ProcessEntryPoints(const SHADER_MODULE_STATE &module_state);
 };
 
+// Process wide cache of SpirvStaticData, addressed by the contents of the SPIR-V it was built from. Identical modules
+// share a single parse, including across devices, and the cache can be saved to disk so later runs skip parsing as well.
+class SpirvStaticDataCache {
+  public:
+    using StaticData = SHADER_MODULE_STATE::SpirvStaticData;
+
+    static SpirvStaticDataCache &Get();
+
+    std::shared_ptr<const StaticData> Acquire(const uint32_t *code, std::size_t word_count, spv_target_env env);
+
+    // Adds the entries of a file written by Save(). Files from other layer or SPIRV-Tools versions are ignored, as are
+    // entries that fail their checksum. If the file exists the cache becomes persistent, see persistent_.
+    bool Load(const std::string &path);
+    // Writes the entries used in the last kMaxUnusedRuns runs, most recently used first, up to kMaxEncodedWords
+    bool Save(const std::string &path);
+
+  private:
+    // Two independent 64 bit hashes of the code, plus its size and the target env
+    struct Key {
+        uint64_t hash[2];
+        uint32_t word_count;
+        uint32_t env;
+
+        bool operator==(const Key &other) const {
+            return hash[0] == other.hash[0] && hash[1] == other.hash[1] && word_count == other.word_count && env == other.env;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const { return static_cast<size_t>(key.hash[0]); }
+    };
+    struct Entry {
+        std::weak_ptr<const StaticData> data;
+        // Serialized form, either loaded from disk or recorded when the data is built for a persistent cache
+        std::vector<uint32_t> encoded;
+        // Number of runs, including this one, since the entry was last acquired
+        uint32_t unused_runs{0};
+    };
+    static constexpr std::size_t kMinSweepSize = 1024;
+    // Encodings are no longer kept in memory or written to the file past this much data, 64MB
+    static constexpr std::size_t kMaxEncodedWords = 16 * 1024 * 1024;
+    // Entries not acquired in this many runs are dropped from the file
+    static constexpr uint32_t kMaxUnusedRuns = 16;
+
+    static Key MakeKey(const uint32_t *code, std::size_t word_count, spv_target_env env);
+
+    std::mutex lock_;
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+    std::size_t sweep_size_{kMinSweepSize};
+    // Total size of the encodings held by entries_
+    std::size_t encoded_words_{0};
+    // Set by Load() if the file exists, from then on new entries are encoded as they are built so that Save() has them even
+    // if the module is destroyed early. Until then Save() only writes the entries still in use.
+    bool persistent_{false};
+};
+
+// Returns a spv_context for env owned by the calling thread. It is created on first use and reused by every later call
+// on the same thread, so it must not be destroyed or handed to other threads.
+spv_context GetThreadSpirvContext(spv_target_env env);
+
 // String helpers functions to give better error messages
 char const *StorageClassName(uint32_t sc);
 
@@ -30,6 +30,16 @@
 #include <string>
 #include <vector>
 
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
 #include <spirv/unified1/spirv.hpp>
 #include "vk_enum_string_helper.h"
 #include "vk_layer_data.h"
@@ -2106,7 +2116,7 @@ bool CoreChecks::ValidateExecutionModes(SHADER_MODULE_STATE const *module_state,
                 case spv::ExecutionModeSubgroupUniformControlFlowKHR: {
                     if (!enabled_features.shader_subgroup_uniform_control_flow_features.shaderSubgroupUniformControlFlow ||
                         (phys_dev_ext_props.subgroup_properties.supportedStages & stage) == 0 ||
-                        module_state->static_data_.has_invocation_repack_instruction) {
+                        module_state->static_data_->has_invocation_repack_instruction) {
                         std::stringstream msg;
                         if (!enabled_features.shader_subgroup_uniform_control_flow_features.shaderSubgroupUniformControlFlow) {
                             msg << "shaderSubgroupUniformControlFlow feature must be enabled";
@@ -2564,6 +2574,10 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
                          report_data->FormatHandle(module_state->vk_shader_module()).c_str(),
                          string_VkShaderStageFlagBits(stage_state.stage_flag));
     }
+    // If the SPIR-V validation of the module was deferred, its errors have been reported by the time Wait() returns
+    if (module_state->deferred_spirv_validation) {
+        skip |= module_state->deferred_spirv_validation->Wait();
+    }
 
     // If specialization-constant instructions are present in the shader, the specializations should be applied.
     if (module_state->HasSpecConstants()) {
@@ -2666,7 +2680,7 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
         auto const optimized =
             optimizer.Run(module_state->words.data(), module_state->words.size(), &specialized_spirv, options, false);
         if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
+            spv_context ctx = GetThreadSpirvContext(spirv_environment);
             spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
             spv_diagnostic diag = nullptr;
             auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
@@ -2734,7 +2748,6 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
             }
 
             spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
         } else {
             // Should never get here, but better then asserting
             skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06719",
@@ -3071,9 +3084,13 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
 
     uint32_t pointlist_stage_mask = DetermineFinalGeomStage(*pipeline);
 
+    const auto &stages = pipeline->stage_state;
+    skip |= ValidateInParallel(static_cast<uint32_t>(stages.size()), [&](uint32_t i) {
+        return ValidatePipelineShaderStage(pipeline, stages[i], (pointlist_stage_mask == stages[i].stage_flag));
+    });
+
     const PipelineStageState *vertex_stage = nullptr, *fragment_stage = nullptr;
-    for (auto &stage : pipeline->stage_state) {
-        skip |= ValidatePipelineShaderStage(pipeline, stage, (pointlist_stage_mask == stage.stage_flag));
+    for (auto &stage : stages) {
         if (stage.stage_flag == VK_SHADER_STAGE_VERTEX_BIT) {
             vertex_stage = &stage;
         }
@@ -3334,7 +3351,165 @@ bool CoreChecks::ValidateRayTracingPipeline(PIPELINE_STATE *pipeline, const safe
     return skip;
 }
 
-uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
+ValidationCache::ShaderHash ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) {
+    ShaderHash result;
+    result.hash[0] = XXH64(smci->pCode, smci->codeSize, 0);
+    result.hash[1] = XXH64(smci->pCode, smci->codeSize, 0x9e3779b97f4a7c15ull);
+    return result;
+}
+
+VkValidationCacheEXT ValidationCache::CreateFromFile(const std::string &path, bool *loaded) {
+    auto cache = new ValidationCache();
+    *loaded = false;
+#if defined(__linux__) || defined(__FreeBSD__)
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            const size_t size = static_cast<size_t>(info.st_size);
+            void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                *loaded = cache->Load(mapping, size, true);
+                if (*loaded) {
+                    cache->mapping_ = mapping;
+                    cache->mapping_size_ = size;
+                } else {
+                    munmap(mapping, size);
+                }
+            }
+        }
+        close(fd);
+    }
+#else
+    std::vector<char> data;
+    std::ifstream read_file(path.c_str(), std::ios::in | std::ios::binary);
+    if (read_file) {
+        std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(data));
+        *loaded = cache->Load(data.data(), data.size(), false);
+    }
+#endif
+    return VkValidationCacheEXT(cache);
+}
+
+ValidationCache::~ValidationCache() { Unmap(); }
+
+void ValidationCache::Unmap() {
+#if defined(__linux__) || defined(__FreeBSD__)
+    if (mapping_) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+}
+
+bool ValidationCache::Load(const void *data, size_t size, bool mapped) {
+    if (!data || size < kHeaderSize) return false;
+
+    const uint32_t *header = static_cast<const uint32_t *>(data);
+    if (header[0] != kHeaderSize) return false;  // also rejects the previous format, which had no hash format field
+    if (header[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return false;
+    uint8_t expected_uuid[VK_UUID_SIZE];
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
+    if (memcmp(&header[2], expected_uuid, VK_UUID_SIZE) != 0) return false;  // different version
+    header = reinterpret_cast<const uint32_t *>(reinterpret_cast<const uint8_t *>(header) + 2 * sizeof(uint32_t) + VK_UUID_SIZE);
+    if (header[0] != kHashFormat) return false;
+    const size_t count = header[1];
+    if (count > (size - kHeaderSize) / sizeof(ShaderHash)) return false;
+
+    const uint8_t *hashes = static_cast<const uint8_t *>(data) + kHeaderSize;
+    auto guard = WriteLock();
+    // No parsing: the hashes are written sorted, so they are used as is. Mapped files are page aligned, which keeps the
+    // array aligned as the header size is a multiple of 8; app provided data is copied as its alignment is unknown.
+    if (mapped) {
+        sorted_hashes_ = reinterpret_cast<const ShaderHash *>(hashes);
+    } else {
+        sorted_hash_storage_.resize(count);
+        if (count) memcpy(sorted_hash_storage_.data(), hashes, count * sizeof(ShaderHash));
+        sorted_hashes_ = sorted_hash_storage_.data();
+    }
+    sorted_hash_count_ = count;
+    return true;
+}
+
+// Merges two sorted hash lists, dropping duplicates
+static void MergeShaderHashes(const ValidationCache::ShaderHash *a, size_t a_count, const ValidationCache::ShaderHash *b,
+                              size_t b_count, std::vector<ValidationCache::ShaderHash> &out) {
+    out.reserve(out.size() + a_count + b_count);
+    size_t i = 0, j = 0;
+    while (i < a_count || j < b_count) {
+        const ValidationCache::ShaderHash *next;
+        if (j == b_count || (i < a_count && a[i] < b[j])) {
+            next = &a[i++];
+        } else {
+            if (i < a_count && a[i] == b[j]) ++i;
+            next = &b[j++];
+        }
+        if (out.empty() || !(out.back() == *next)) out.push_back(*next);
+    }
+}
+
+std::vector<ValidationCache::ShaderHash> ValidationCache::SortedHashes() const {
+    std::vector<ShaderHash> inserted(good_shader_hashes_.begin(), good_shader_hashes_.end());
+    std::sort(inserted.begin(), inserted.end());
+    std::vector<ShaderHash> result;
+    MergeShaderHashes(sorted_hashes_, sorted_hash_count_, inserted.data(), inserted.size(), result);
+    return result;
+}
+
+void ValidationCache::Write(size_t *pDataSize, void *pData) {
+    std::vector<ShaderHash> hashes;
+    {
+        auto guard = ReadLock();
+        hashes = SortedHashes();
+    }
+    if (!pData) {
+        *pDataSize = kHeaderSize + hashes.size() * sizeof(ShaderHash);
+        return;
+    }
+
+    if (*pDataSize < kHeaderSize) {
+        *pDataSize = 0;
+        return;  // Too small for even the header!
+    }
+
+    // A truncated write keeps a prefix of the sorted hashes, which is still sorted
+    const size_t count = std::min(hashes.size(), (*pDataSize - kHeaderSize) / sizeof(ShaderHash));
+
+    // Write the header
+    uint32_t *out = static_cast<uint32_t *>(pData);
+    *out++ = kHeaderSize;
+    *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
+    out = reinterpret_cast<uint32_t *>(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
+    *out++ = kHashFormat;
+    *out++ = static_cast<uint32_t>(count);
+
+    if (count) memcpy(out, hashes.data(), count * sizeof(ShaderHash));
+    *pDataSize = kHeaderSize + count * sizeof(ShaderHash);
+}
+
+void ValidationCache::Merge(ValidationCache const *other) {
+    // self-merging is invalid, but avoid deadlock below just in case.
+    if (other == this) {
+        return;
+    }
+    std::vector<ShaderHash> other_hashes;
+    {
+        auto other_guard = other->ReadLock();
+        other_hashes = other->SortedHashes();
+    }
+
+    auto guard = WriteLock();
+    const auto hashes = SortedHashes();
+    std::vector<ShaderHash> merged;
+    MergeShaderHashes(hashes.data(), hashes.size(), other_hashes.data(), other_hashes.size(), merged);
+    sorted_hash_storage_ = std::move(merged);
+    sorted_hashes_ = sorted_hash_storage_.data();
+    sorted_hash_count_ = sorted_hash_storage_.size();
+    good_shader_hashes_.clear();
+    Unmap();
+}
 
 static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     const auto validation_cache_ci = LvlFindInChain<VkShaderModuleValidationCacheCreateInfoEXT>(pCreateInfo->pNext);
@@ -3345,9 +3520,9 @@ static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *p
 }
 
 bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
-                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule) const {
+                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
+                                                   void *csm_state_data) const {
     bool skip = false;
-    spv_result_t spv_valid = SPV_SUCCESS;
 
     if (disabled[shader_validation]) {
         return false;
@@ -3361,7 +3536,8 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
                          pCreateInfo->codeSize);
     } else {
         auto cache = GetValidationCacheInfo(pCreateInfo);
-        uint32_t hash = 0;
+        const bool app_cache = (cache != nullptr);
+        ValidationCache::ShaderHash hash = {};
         // If app isn't using a shader validation cache, use the default one from CoreChecks
         if (!cache) cache = CastFromHandle<ValidationCache *>(core_validation_cache);
         if (cache) {
@@ -3369,35 +3545,63 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
             if (cache->Contains(hash)) return false;
         }
 
-        // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
-        // the default values will be used during validation.
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-        spv_context ctx = spvContextCreate(spirv_environment);
-        spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
-        spv_diagnostic diag = nullptr;
-        spvtools::ValidatorOptions options;
-        AdjustValidatorOptions(device_extensions, enabled_features, options);
-        spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
-        if (spv_valid != SPV_SUCCESS) {
-            if (!have_glsl_shader || (pCreateInfo->pCode[0] == spv::MagicNumber)) {
-                if (spv_valid == SPV_WARNING) {
-                    skip |= LogWarning(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
-                                       diag && diag->error ? diag->error : "(no error text)");
-                } else {
-                    skip |= LogError(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
-                                     diag && diag->error ? diag->error : "(no error text)");
-                }
-            }
-        } else {
-            if (cache) {
-                cache->Insert(hash);
-            }
+        // The application may destroy its own cache at any time, so only modules using ours can be deferred. The state
+        // tracker parses the module as soon as it is created, so malformed instruction streams are validated right away
+        // and their errors reported before that happens, as without deferral.
+        const std::size_t word_count = pCreateInfo->codeSize / sizeof(uint32_t);
+        if (deferred_shader_validation && validation_thread_pool && !app_cache &&
+            SHADER_MODULE_STATE::HasWellFormedInstructions(pCreateInfo->pCode, word_count)) {
+            // Copy the code, the application is free to release it once this call returns
+            auto code = std::make_shared<std::vector<uint32_t>>(pCreateInfo->pCode, pCreateInfo->pCode + word_count);
+            // Whichever thread ends up running it, the validation reports its own messages exactly once, so it must not log
+            // into the capture of a ValidateInParallel() pass that happens to call Wait() first
+            auto deferred = std::make_shared<DeferredSpirvValidation>([this, code, cache, hash]() {
+                LogCaptureScope uncaptured(nullptr);
+                return ValidateSpirv(code->data(), code->size(), cache, hash);
+            });
+            validation_thread_pool->Post([deferred]() { deferred->Run(); });
+            auto csm_state = static_cast<create_shader_module_api_state *>(csm_state_data);
+            csm_state->deferred_spirv_validation = std::move(deferred);
+            return skip;
         }
 
-        spvDiagnosticDestroy(diag);
-        spvContextDestroy(ctx);
+        skip |= ValidateSpirv(pCreateInfo->pCode, word_count, cache, hash);
+    }
+
+    return skip;
+}
+
+bool CoreChecks::ValidateSpirv(const uint32_t *code, size_t word_count, ValidationCache *cache,
+                               const ValidationCache::ShaderHash &hash) const {
+    bool skip = false;
+    auto have_glsl_shader = IsExtEnabled(device_extensions.vk_nv_glsl_shader);
+
+    // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
+    // the default values will be used during validation.
+    spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    spv_context ctx = GetThreadSpirvContext(spirv_environment);
+    spv_const_binary_t binary{code, word_count};
+    spv_diagnostic diag = nullptr;
+    spvtools::ValidatorOptions options;
+    AdjustValidatorOptions(device_extensions, enabled_features, options);
+    spv_result_t spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
+    if (spv_valid != SPV_SUCCESS) {
+        if (!have_glsl_shader || (word_count > 0 && code[0] == spv::MagicNumber)) {
+            if (spv_valid == SPV_WARNING) {
+                skip |= LogWarning(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
+                                   diag && diag->error ? diag->error : "(no error text)");
+            } else {
+                skip |= LogError(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
+                                 diag && diag->error ? diag->error : "(no error text)");
+            }
+        }
+    } else {
+        if (cache) {
+            cache->Insert(hash);
+        }
     }
 
+    spvDiagnosticDestroy(diag);
     return skip;
 }
 
@@ -3532,13 +3736,15 @@ spv_target_env PickSpirvEnv(uint32_t api_version, bool spirv_1_4) {
 }
 
 // Some Vulkan extensions/features are just all done in spirv-val behind optional settings
-void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
-                            spvtools::ValidatorOptions &options) {
+uint32_t AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                                spvtools::ValidatorOptions &options) {
+    uint32_t options_set = 0;
     // VK_KHR_relaxed_block_layout never had a feature bit so just enabling the extension allows relaxed layout
     // Was promotoed in Vulkan 1.1 so anyone using Vulkan 1.1 also gets this for free
     if (IsExtEnabled(device_extensions.vk_khr_relaxed_block_layout)) {
         // --relax-block-layout
         options.SetRelaxBlockLayout(true);
+        options_set |= 1u << 0;
     }
 
     // The rest of the settings are controlled from a feature bit, which are set correctly in the state tracking. Regardless of
@@ -3547,17 +3753,22 @@ void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const Dev
     if (enabled_features.core12.uniformBufferStandardLayout == VK_TRUE) {
         // --uniform-buffer-standard-layout
         options.SetUniformBufferStandardLayout(true);
+        options_set |= 1u << 1;
     }
     if (enabled_features.core12.scalarBlockLayout == VK_TRUE) {
         // --scalar-block-layout
         options.SetScalarBlockLayout(true);
+        options_set |= 1u << 2;
     }
     if (enabled_features.workgroup_memory_explicit_layout_features.workgroupMemoryExplicitLayoutScalarBlockLayout) {
         // --workgroup-scalar-block-layout
         options.SetWorkgroupScalarBlockLayout(true);
+        options_set |= 1u << 3;
     }
     if (enabled_features.core13.maintenance4) {
         // --allow-localsizeid
         options.SetAllowLocalSizeId(true);
+        options_set |= 1u << 4;
     }
+    return options_set;
 }
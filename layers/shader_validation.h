@@ -22,7 +22,10 @@
 #ifndef VULKAN_SHADER_VALIDATION_H
 #define VULKAN_SHADER_VALIDATION_H
 
+#include <algorithm>
 #include <cstdlib>
+#include <string>
+#include <vector>
 
 #include "vulkan/vulkan.h"
 #include <generated/spirv_tools_commit_id.h>
@@ -41,92 +44,68 @@ struct shader_stage_attributes {
 
 class ValidationCache {
   public:
+    // Two independent 64 bit hashes of the module code, ordered so that the cache data can be kept sorted
+    struct ShaderHash {
+        uint64_t hash[2];
+
+        bool operator==(const ShaderHash &other) const { return hash[0] == other.hash[0] && hash[1] == other.hash[1]; }
+        bool operator<(const ShaderHash &other) const {
+            return hash[0] < other.hash[0] || (hash[0] == other.hash[0] && hash[1] < other.hash[1]);
+        }
+    };
+    struct ShaderHashHasher {
+        size_t operator()(const ShaderHash &value) const { return static_cast<size_t>(value.hash[0]); }
+    };
+
     static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
         auto cache = new ValidationCache();
-        cache->Load(pCreateInfo);
+        cache->Load(pCreateInfo->pInitialData, pCreateInfo->initialDataSize, false);
         return VkValidationCacheEXT(cache);
     }
 
-    void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-        auto size = headerSize;
-        if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
+    // Like Create(), but uses the data written to path in place where the platform can map files, instead of copying it.
+    // The file must only be replaced by renaming over it while the cache is alive.
+    static VkValidationCacheEXT CreateFromFile(const std::string &path, bool *loaded);
 
-        uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-        if (data[0] != size) return;
-        if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
-        uint8_t expected_uuid[VK_UUID_SIZE];
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
-        if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+    ~ValidationCache();
 
-        data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+    void Write(size_t *pDataSize, void *pData);
 
-        auto guard = WriteLock();
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-            good_shader_hashes_.insert(*data);
-        }
-    }
+    // Linear merge of both sorted hash lists
+    void Merge(ValidationCache const *other);
 
-    void Write(size_t *pDataSize, void *pData) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
-        if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint32_t);
-            return;
-        }
-
-        if (*pDataSize < headerSize) {
-            *pDataSize = 0;
-            return;  // Too small for even the header!
-        }
-
-        uint32_t *out = (uint32_t *)pData;
-        size_t actualSize = headerSize;
-
-        // Write the header
-        *out++ = headerSize;
-        *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
-        out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
-
-        {
-            auto guard = ReadLock();
-            for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actualSize < *pDataSize;
-                 it++, out++, actualSize += sizeof(uint32_t)) {
-                *out = *it;
-            }
-        }
+    static ShaderHash MakeShaderHash(VkShaderModuleCreateInfo const *smci);
 
-        *pDataSize = actualSize;
-    }
-
-    void Merge(ValidationCache const *other) {
-        // self-merging is invalid, but avoid deadlock below just in case.
-        if (other == this) {
-            return;
-        }
-        auto other_guard = other->ReadLock();
-        auto guard = WriteLock();
-        good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
-        for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
-    }
-
-    static uint32_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
-
-    bool Contains(uint32_t hash) {
+    bool Contains(const ShaderHash &hash) const {
         auto guard = ReadLock();
-        return good_shader_hashes_.count(hash) != 0;
+        return std::binary_search(sorted_hashes_, sorted_hashes_ + sorted_hash_count_, hash) ||
+               good_shader_hashes_.count(hash) != 0;
     }
 
-    void Insert(uint32_t hash) {
+    void Insert(const ShaderHash &hash) {
         auto guard = WriteLock();
-        good_shader_hashes_.insert(hash);
+        if (!std::binary_search(sorted_hashes_, sorted_hashes_ + sorted_hash_count_, hash)) {
+            good_shader_hashes_.insert(hash);
+        }
     }
 
   private:
+    // Data layout: header size, VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT, UUID, then kHashFormat and the number of hashes,
+    // which follow the header as a sorted ShaderHash array. Caches using the original 32 bit hashes have a smaller header
+    // and are discarded.
+    static const uint32_t kHeaderSize = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+    static const uint32_t kHashFormat = 2;
+
     ValidationCache() {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    // Returns false if data isn't a cache of the current format. Mapped data is referenced instead of copied.
+    bool Load(const void *data, size_t size, bool mapped);
+    // All hashes in sorted order
+    std::vector<ShaderHash> SortedHashes() const;
+    void Unmap();
+
     void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) {
         // Convert sha1_str from a hex string to binary. We only need VK_UUID_SIZE bytes of
         // output, so pad with zeroes if the input string is shorter than that, and truncate
@@ -150,13 +129,21 @@ class ValidationCache {
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    layer_data::unordered_set<uint32_t> good_shader_hashes_;
+    // Hashes loaded or merged in are kept sorted, either in sorted_hash_storage_ or in the mapped cache file. Hashes
+    // inserted afterwards go in good_shader_hashes_ until the next merge.
+    const ShaderHash *sorted_hashes_ = nullptr;
+    size_t sorted_hash_count_ = 0;
+    std::vector<ShaderHash> sorted_hash_storage_;
+    void *mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    layer_data::unordered_set<ShaderHash, ShaderHashHasher> good_shader_hashes_;
     mutable ReadWriteLock lock_;
 };
 
 spv_target_env PickSpirvEnv(uint32_t api_version, bool spirv_1_4);
 
-void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
-                            spvtools::ValidatorOptions &options);
+// Returns a bit per option that was turned on, so callers can tell validator configurations apart
+uint32_t AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                                spvtools::ValidatorOptions &options);
 
 #endif  // VULKAN_SHADER_VALIDATION_H
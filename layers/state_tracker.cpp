@@ -4342,7 +4342,9 @@ void ValidationStateTracker::PostCallRecordCreateShaderModule(VkDevice device, c
     if (VK_SUCCESS != result) return;
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
 
-    Add(CreateShaderModuleState(*pCreateInfo, csm_state->unique_shader_id, *pShaderModule));
+    auto module_state = CreateShaderModuleState(*pCreateInfo, csm_state->unique_shader_id, *pShaderModule);
+    module_state->deferred_spirv_validation = csm_state->deferred_spirv_validation;
+    Add(std::move(module_state));
 }
 
 void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain,
@@ -70,6 +70,7 @@ class EVENT_STATE;
 class SWAPCHAIN_NODE;
 class SURFACE_STATE;
 class UPDATE_TEMPLATE_STATE;
+class DeferredSpirvValidation;
 
 // These versions allow functions that are the same to share the same logic but can use different VUs
 // The common case are functions that were missing the pNext in Vulkan 1.0 and added via extension
@@ -84,6 +85,7 @@ struct create_shader_module_api_state {
     uint32_t unique_shader_id;
     VkShaderModuleCreateInfo instrumented_create_info;
     std::vector<uint32_t> instrumented_pgm;
+    std::shared_ptr<DeferredSpirvValidation> deferred_spirv_validation;
 };
 
 // This structure is used to save data across the CreateGraphicsPipelines down-chain API call
@@ -127,7 +129,7 @@ struct create_buffer_api_state {
 };
 
 #define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope) \
-    vl_concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member; \
+    vl_concurrent_read_mostly_map<handle_type, std::shared_ptr<state_type>> map_member; \
     template <typename Dummy> \
     struct MapTraits<state_type, Dummy> { \
         static constexpr bool kInstanceScope = instance_scope; \
@@ -159,6 +161,7 @@ struct TraitsBase {
     using ConstSharedType = std::shared_ptr<const StateType>;
     using ReadLockedType = LockedSharedPtr<const StateType, ReadLockGuard>;
     using WriteLockedType = LockedSharedPtr<StateType, WriteLockGuard>;
+    using ReadLockedBorrowType = LockedBorrowedPtr<const StateType, ReadLockGuard>;
 };
 }  // namespace state_object
 
@@ -368,7 +371,7 @@ class ValidationStateTracker : public ValidationObject {
         if (found_it == map.end()) {
             return nullptr;
         }
-        // NOTE: vl_concurrent_unordered_map::find() makes a copy of the value, so it is safe to move out.
+        // NOTE: vl_concurrent_read_mostly_map::find() makes a copy of the value, so it is safe to move out.
         // But this will break everything, when switching to a different map type.
         return std::static_pointer_cast<State>(std::move(found_it->second));
     };
@@ -412,6 +415,33 @@ class ValidationStateTracker : public ValidationObject {
         }
     };
 
+    // Borrow() is a non-owning Get(): it returns a raw pointer without touching the state object's reference count, which
+    // avoids contended atomics on hot objects in per-command validation. The pointer is only valid for the lifetime of the
+    // EpochGuard passed in, which must therefore be scoped to the API call. Use Get() when the state must be retained.
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    State* Borrow(const EpochGuard& epoch, typename Traits::HandleType handle) {
+        const auto* found = GetStateMap<State>().find_borrowed(epoch, handle);
+        return found ? static_cast<State*>(found->get()) : nullptr;
+    };
+
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    const State* Borrow(const EpochGuard& epoch, typename Traits::HandleType handle) const {
+        const auto* found = GetStateMap<State>().find_borrowed(epoch, handle);
+        return found ? static_cast<const State*>(found->get()) : nullptr;
+    };
+
+    // Borrowing counterpart of GetRead()
+    template <typename State, typename Traits = typename state_object::Traits<State>,
+              typename ReadLockedBorrowType = typename Traits::ReadLockedBorrowType>
+    ReadLockedBorrowType BorrowRead(const EpochGuard& epoch, typename Traits::HandleType handle) const {
+        const auto* ptr = Borrow<State>(epoch, handle);
+        if (ptr) {
+            return ReadLockedBorrowType(ptr, ptr->ReadLock());
+        } else {
+            return ReadLockedBorrowType();
+        }
+    };
+
     // When needing to share ownership, control over constness of access with another object (i.e. adding references while
     // not modifying the contents of the ValidationStateTracker)
     template <typename State, typename Traits = state_object::Traits<State>>
@@ -276,7 +276,7 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
     cb_state_ = from.cb_state_;
     queue_flags_ = from.queue_flags_;
     destroyed_ = from.destroyed_;
-    access_log_ = from.access_log_;  // potentially large, but no choice given tagging lookup.
+    access_log_ = std::make_shared<AccessLog>(*from.access_log_);  // potentially large, but no choice given tagging lookup.
     command_number_ = from.command_number_;
     subcommand_number_ = from.subcommand_number_;
     reset_count_ = from.reset_count_;
@@ -299,11 +299,11 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
 }
 
 std::string CommandBufferAccessContext::FormatUsage(const ResourceUsageTag tag) const {
-    if (tag >= access_log_.size()) return std::string();
+    if (tag >= access_log_->size()) return std::string();
 
     std::stringstream out;
-    assert(tag < access_log_.size());
-    const auto &record = access_log_[tag];
+    assert(tag < access_log_->size());
+    const auto &record = (*access_log_)[tag];
     out << record;
     if (cb_state_.get() != record.cb_state) {
         out << SyncNodeFormatter(*sync_state_, record.cb_state);
@@ -344,12 +344,17 @@ static const SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
 static constexpr VkPipelineStageFlags2KHR kRasterAttachmentExecScope = kDepthStencilAttachmentExecScope | kColorAttachmentExecScope;
 static const SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
 
-ResourceAccessState::OrderingBarriers ResourceAccessState::kOrderingRules = {
+ResourceAccessStateData::OrderingBarriers ResourceAccessStateData::kOrderingRules = {
     {{VK_PIPELINE_STAGE_2_NONE_KHR, SyncStageAccessFlags()},
      {kColorAttachmentExecScope, kColorAttachmentAccessScope},
      {kDepthStencilAttachmentExecScope, kDepthStencilAttachmentAccessScope},
      {kRasterAttachmentExecScope, kRasterAttachmentAccessScope}}};
 
+const std::shared_ptr<ResourceAccessStateData> &ResourceAccessState::DefaultData() {
+    static const std::shared_ptr<ResourceAccessStateData> default_data = std::make_shared<ResourceAccessStateData>();
+    return default_data;
+}
+
 // Sometimes we have an internal access conflict, and we using the kInvalidTag to set and detect in temporary/proxy contexts
 static const ResourceUsageTag kInvalidTag(ResourceUsageRecord::kMaxIndex);
 
@@ -774,7 +779,7 @@ class UpdateStateResolveAction {
     const ResourceUsageTag tag_;
 };
 
-void HazardResult::Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
+void HazardResult::Set(const ResourceAccessStateData *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
                        const SyncStageAccessFlags &prior_, const ResourceUsageTag tag_) {
     access_state = layer_data::make_unique<const ResourceAccessState>(*access_state_);
     usage_index = usage_index_;
@@ -824,8 +829,11 @@ HazardResult AccessContext::DetectPreviousHazard(AccessAddressType type, const D
     ResolvePreviousAccess(type, range, &descent_map, nullptr);
 
     HazardResult hazard;
+    SharedStateSkip<Detector> shared_state;
     for (auto prev = descent_map.begin(); prev != descent_map.end() && !hazard.hazard; ++prev) {
+        if (shared_state.Skip(prev->second)) continue;
         hazard = detector.Detect(prev);
+        shared_state.Checked(prev->second);
     }
     return hazard;
 }
@@ -862,6 +870,7 @@ HazardResult AccessContext::DetectHazard(AccessAddressType type, const Detector
     const auto the_end = accesses.cend();  // End is not invalidated
     auto pos = accesses.lower_bound(range);
     ResourceAccessRange gap = {range.begin, range.begin};
+    SharedStateSkip<Detector> shared_state;
 
     while (pos != the_end && pos->first.begin < range.end) {
         // Cover any leading gap, or gap between entries
@@ -878,8 +887,11 @@ HazardResult AccessContext::DetectHazard(AccessAddressType type, const Detector
             gap.begin = pos->first.end;
         }
 
-        hazard = detector.Detect(pos);
-        if (hazard.hazard) return hazard;
+        if (!shared_state.Skip(pos->second)) {
+            hazard = detector.Detect(pos);
+            if (hazard.hazard) return hazard;
+            shared_state.Checked(pos->second);
+        }
         ++pos;
     }
 
@@ -903,9 +915,13 @@ HazardResult AccessContext::DetectAsyncHazard(AccessAddressType type, const Dete
     const auto the_end = accesses.end();
 
     HazardResult hazard;
+    SharedStateSkip<Detector> shared_state;
     while (pos != the_end && pos->first.begin < range.end) {
-        hazard = detector.DetectAsync(pos, start_tag_);
-        if (hazard.hazard) break;
+        if (!shared_state.Skip(pos->second)) {
+            hazard = detector.DetectAsync(pos, start_tag_);
+            if (hazard.hazard) break;
+            shared_state.Checked(pos->second);
+        }
         ++pos;
     }
 
@@ -978,12 +994,13 @@ void AccessContext::ResolveAccessRange(AccessAddressType type, const ResourceAcc
     if (!range.non_empty()) return;
 
     ResourceRangeMergeIterator current(*resolve_map, GetAccessStateMap(type), range.begin);
+    ResourceAccessState::UpdateCache barrier_cache;
     while (current->range.non_empty() && range.includes(current->range.begin)) {
         const auto current_range = current->range & range;
         if (current->pos_B->valid) {
             const auto &src_pos = current->pos_B->lower_bound;
             auto access = src_pos->second;  // intentional copy
-            barrier_action(&access);
+            barrier_cache.Apply(&access, barrier_action);
 
             if (current->pos_A->valid) {
                 const auto trimmed = sparse_container::split(current->pos_A->lower_bound, *resolve_map, current_range);
@@ -1479,6 +1496,10 @@ class EventBarrierHazardDetector {
     const ResourceUsageTag scope_tag_;
 };
 
+// Entries outside the event scope aren't checked, so a hazard free entry doesn't clear those sharing its data
+template <>
+struct DetectsStateOnly<EventBarrierHazardDetector> : std::false_type {};
+
 HazardResult AccessContext::DetectImageBarrierHazard(const IMAGE_STATE &image, VkPipelineStageFlags2KHR src_exec_scope,
                                                      const SyncStageAccessFlags &src_access_scope,
                                                      const VkImageSubresourceRange &subresource_range,
@@ -1621,8 +1642,8 @@ struct UpdateMemoryAccessStateFunctor {
     }
 
     Iterator operator()(ResourceAccessRangeMap *accesses, Iterator pos) const {
-        auto &access_state = pos->second;
-        access_state.Update(usage, ordering_rule, tag);
+        update_cache.Apply(&pos->second,
+                           [this](ResourceAccessState *access_state) { access_state->Update(usage, ordering_rule, tag); });
         return pos;
     }
 
@@ -1634,6 +1655,7 @@ struct UpdateMemoryAccessStateFunctor {
     const SyncStageAccessIndex usage;
     const SyncOrdering ordering_rule;
     const ResourceUsageTag tag;
+    mutable ResourceAccessState::UpdateCache update_cache;
 };
 
 // The barrier operation for pipeline and subpass dependencies`
@@ -1675,16 +1697,17 @@ class ApplyBarrierOpsFunctor {
     }
 
     Iterator operator()(ResourceAccessRangeMap *accesses, const Iterator &pos) const {
-        auto &access_state = pos->second;
-        for (const auto &op : barrier_ops_) {
-            op(&access_state);
-        }
+        update_cache_.Apply(&pos->second, [this](ResourceAccessState *access_state) {
+            for (const auto &op : barrier_ops_) {
+                op(access_state);
+            }
 
-        if (resolve_) {
-            // If this is the last (or only) batch, we can do the pending resolve as the last step in this operation to avoid
-            // another walk
-            access_state.ApplyPendingBarriers(tag_);
-        }
+            if (resolve_) {
+                // If this is the last (or only) batch, we can do the pending resolve as the last step in this operation to avoid
+                // another walk
+                access_state->ApplyPendingBarriers(tag_);
+            }
+        });
         return pos;
     }
 
@@ -1697,12 +1720,15 @@ class ApplyBarrierOpsFunctor {
         barrier_ops_.emplace_back(op);
         infill_default_ |= op.layout_transition;
     }
+    // Called before moving on to the map of another address type, s.t. that map's states never share the results of this one's
+    void ResetUpdateCache() const { update_cache_.Clear(); }
 
   private:
     bool resolve_;
     bool infill_default_;
     OpVector barrier_ops_;
     const ResourceUsageTag tag_;
+    mutable ResourceAccessState::UpdateCache update_cache_;
 };
 
 // This functor applies a single barrier, updating the "pending state" in each touched memory range, but does not
@@ -1832,16 +1858,39 @@ template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
     for (const auto address_type : kAddressTypes) {
+        barrier_action.ResetUpdateCache();
         UpdateMemoryAccessState(&GetAccessStateMap(address_type), kFullRange, barrier_action);
     }
 }
 
-void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &contexts) {
-    for (uint32_t subpass_index = 0; subpass_index < contexts.size(); subpass_index++) {
-        auto &context = contexts[subpass_index];
-        ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
-        for (const auto address_type : kAddressTypes) {
-            context.ResolveAccessRange(address_type, kFullRange, barrier_action, &GetAccessStateMap(address_type), nullptr, false);
+void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &contexts, ValidationThreadPool *thread_pool) {
+    // Not worth waking the pool for, unless every address type has a fair number of accesses to resolve
+    static constexpr size_t kMinParallelResolveEntries = 256;
+    size_t min_entries = std::numeric_limits<size_t>::max();
+    for (const auto address_type : kAddressTypes) {
+        size_t entries = 0;
+        for (const auto &context : contexts) {
+            entries += context.GetAccessStateMap(address_type).size();
+        }
+        min_entries = std::min(min_entries, entries);
+    }
+
+    // Each map is resolved from the children's maps of its own address type only. Barrier functors applied across address types
+    // reset their update cache per type, so apart from the default state (whose data is never updated in place, as the default
+    // itself holds a reference) the maps of different address types share no state data, and can be resolved independently.
+    auto resolve_address_type = [this, &contexts](size_t type_index) {
+        const auto address_type = kAddressTypes[type_index];
+        auto *resolve_map = &GetAccessStateMap(address_type);
+        for (const auto &context : contexts) {
+            ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
+            context.ResolveAccessRange(address_type, kFullRange, barrier_action, resolve_map, nullptr, false);
+        }
+    };
+    if (thread_pool && (min_entries >= kMinParallelResolveEntries)) {
+        thread_pool->ParallelFor(kAddressTypes.size(), resolve_address_type);
+    } else {
+        for (size_t type_index = 0; type_index < kAddressTypes.size(); ++type_index) {
+            resolve_address_type(type_index);
         }
     }
 }
@@ -2273,7 +2322,8 @@ ResourceUsageTag CommandBufferAccessContext::RecordEndRenderPass(const CMD_TYPE
     auto store_tag = NextCommandTag(cmd, ResourceUsageRecord::SubcommandType::kStoreOp);
     auto barrier_tag = NextSubcommandTag(cmd, ResourceUsageRecord::SubcommandType::kSubpassTransition);
 
-    current_renderpass_context_->RecordEndRenderPass(&cb_access_context_, store_tag, barrier_tag);
+    current_renderpass_context_->RecordEndRenderPass(&cb_access_context_, store_tag, barrier_tag,
+                                                     sync_state_->resolve_thread_pool.get());
     current_context_ = &cb_access_context_;
     current_renderpass_context_ = nullptr;
     return barrier_tag;
@@ -2378,21 +2428,21 @@ ResourceUsageRange CommandExecutionContext::ImportRecordedAccessLog(const Comman
 }
 
 void CommandBufferAccessContext::InsertRecordedAccessLogEntries(const CommandBufferAccessContext &recorded_context) {
-    cbs_referenced_.emplace(recorded_context.GetCBStateShared());
-    access_log_.insert(access_log_.end(), recorded_context.access_log_.cbegin(), recorded_context.access_log_.end());
+    cbs_referenced_->emplace(recorded_context.GetCBStateShared());
+    access_log_->insert(access_log_->end(), recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
 }
 
 ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(CMD_TYPE command, ResourceUsageRecord::SubcommandType subcommand) {
-    ResourceUsageTag next = access_log_.size();
-    access_log_.emplace_back(command, command_number_, subcommand, ++subcommand_number_, cb_state_.get(), reset_count_);
+    ResourceUsageTag next = access_log_->size();
+    access_log_->emplace_back(command, command_number_, subcommand, ++subcommand_number_, cb_state_.get(), reset_count_);
     return next;
 }
 
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(CMD_TYPE command, ResourceUsageRecord::SubcommandType subcommand) {
     command_number_++;
     subcommand_number_ = 0;
-    ResourceUsageTag next = access_log_.size();
-    access_log_.emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_.get(), reset_count_);
+    ResourceUsageTag next = access_log_->size();
+    access_log_->emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_.get(), reset_count_);
     return next;
 }
 
@@ -2457,6 +2507,43 @@ HazardResult AccessContext::DetectFirstUseHazard(const ResourceUsageRange &tag_r
     return hazard;
 }
 
+// Also called with the *recorded* context, detecting hazards of its first accesses with the accesses of async_context that
+// the predicate reports as not ordered with the recorded ones (e.g. work submitted to other queues).
+template <typename AsyncTagPredicate>
+HazardResult AccessContext::DetectFirstUseAsyncHazard(const AccessContext &async_context, const AsyncTagPredicate &is_async) const {
+    HazardResult hazard;
+    const ResourceUsageRange all_tags(0, ResourceUsageRecord::kMaxIndex);
+    for (const auto address_type : kAddressTypes) {
+        const auto &async_map = async_context.GetAccessStateMap(address_type);
+        if (async_map.empty()) continue;
+        for (const auto &recorded_access : GetAccessStateMap(address_type)) {
+            if (!recorded_access.second.FirstAccessInTagRange(all_tags)) continue;
+            const ResourceAccessRange &range = recorded_access.first;
+            for (auto pos = async_map.lower_bound(range); pos != async_map.cend() && pos->first.begin < range.end; ++pos) {
+                hazard = pos->second.DetectAsyncHazard(recorded_access.second, all_tags, is_async);
+                if (hazard.hazard) return hazard;
+            }
+        }
+    }
+    return hazard;
+}
+
+// Host waits: drop the completed accesses, and the map entries with no accesses left
+template <typename WaitTagPredicate>
+void AccessContext::ApplyPredicatedWait(const WaitTagPredicate &is_complete) {
+    for (const auto address_type : kAddressTypes) {
+        auto &accesses = GetAccessStateMap(address_type);
+        auto pos = accesses.begin();
+        while (pos != accesses.end()) {
+            if (pos->second.ApplyPredicatedWait(is_complete)) {
+                pos = accesses.erase(pos);
+            } else {
+                ++pos;
+            }
+        }
+    }
+}
+
 bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecutionContext &exec_context,
                                                             const CMD_BUFFER_STATE &cmd, const char *func_name) const {
     bool skip = false;
@@ -2808,13 +2895,13 @@ void RenderPassAccessContext::RecordNextSubpass(const ResourceUsageTag store_tag
 }
 
 void RenderPassAccessContext::RecordEndRenderPass(AccessContext *external_context, const ResourceUsageTag store_tag,
-                                                  const ResourceUsageTag barrier_tag) {
+                                                  const ResourceUsageTag barrier_tag, ValidationThreadPool *thread_pool) {
     // Add the resolve and store accesses
     CurrentContext().UpdateAttachmentResolveAccess(*rp_state_, attachment_views_, current_subpass_, store_tag);
     CurrentContext().UpdateAttachmentStoreAccess(*rp_state_, attachment_views_, current_subpass_, store_tag);
 
     // Export the accesses from the renderpass...
-    external_context->ResolveChildContexts(subpass_contexts_);
+    external_context->ResolveChildContexts(subpass_contexts_, thread_pool);
 
     // Add the "finalLayout" transitions to external
     // Get them from where there we're hidding in the extra entry.
@@ -2901,7 +2988,7 @@ SyncBarrier::SyncBarrier(VkQueueFlags queue_flags, const Barrier &barrier) {
 }
 
 // Apply a list of barriers, without resolving pending state, useful for subpass layout transitions
-void ResourceAccessState::ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition) {
+void ResourceAccessStateData::ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition) {
     for (const auto &barrier : barriers) {
         ApplyBarrier(barrier, layout_transition);
     }
@@ -2910,7 +2997,7 @@ void ResourceAccessState::ApplyBarriers(const std::vector<SyncBarrier> &barriers
 // ApplyBarriers is design for *fully* inclusive barrier lists without layout tranistions.  Designed use was for
 // inter-subpass barriers for lazy-evaluation of parent context memory ranges.  Subpass layout transistions are *not* done
 // lazily, s.t. no previous access reports should need layout transitions.
-void ResourceAccessState::ApplyBarriersImmediate(const std::vector<SyncBarrier> &barriers) {
+void ResourceAccessStateData::ApplyBarriersImmediate(const std::vector<SyncBarrier> &barriers) {
     assert(!pending_layout_transition);  // This should never be call in the middle of another barrier application
     assert(pending_write_barriers.none());
     assert(!pending_write_dep_chain);
@@ -2919,7 +3006,7 @@ void ResourceAccessState::ApplyBarriersImmediate(const std::vector<SyncBarrier>
     }
     ApplyPendingBarriers(kInvalidTag);  // There can't be any need for this tag
 }
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index) const {
+HazardResult ResourceAccessStateData::DetectHazard(SyncStageAccessIndex usage_index) const {
     HazardResult hazard;
     auto usage = FlagBit(usage_index);
     const auto usage_stage = PipelineStageBit(usage_index);
@@ -2952,12 +3039,12 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index, const SyncOrdering ordering_rule) const {
+HazardResult ResourceAccessStateData::DetectHazard(SyncStageAccessIndex usage_index, const SyncOrdering ordering_rule) const {
     const auto &ordering = GetOrderingRules(ordering_rule);
     return DetectHazard(usage_index, ordering);
 }
 
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const {
+HazardResult ResourceAccessStateData::DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const {
     // The ordering guarantees act as barriers to the last accesses, independent of synchronization operations
     HazardResult hazard;
     const auto usage_bit = FlagBit(usage_index);
@@ -3021,7 +3108,8 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range) const {
+HazardResult ResourceAccessStateData::DetectHazard(const ResourceAccessStateData &recorded_use,
+                                                  const ResourceUsageRange &tag_range) const {
     HazardResult hazard;
     using Size = FirstAccesses::size_type;
     const auto &recorded_accesses = recorded_use.first_accesses_;
@@ -3076,24 +3164,22 @@ HazardResult ResourceAccessState::DetectHazard(const ResourceAccessState &record
     return hazard;
 }
 
-// Asynchronous Hazards occur between subpasses with no connection through the DAG
-HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_index, const ResourceUsageTag start_tag) const {
+// Asynchronous Hazards occur between subpasses with no connection through the DAG, and between queues
+template <typename AsyncTagPredicate>
+HazardResult ResourceAccessStateData::DetectAsyncHazard(SyncStageAccessIndex usage_index, const AsyncTagPredicate &is_async) const {
     HazardResult hazard;
     auto usage = FlagBit(usage_index);
-    // Async checks need to not go back further than the start of the subpass, as we only want to find hazards between the async
-    // subpasses.  Anything older than that should have been checked at the start of each subpass, taking into account all of
-    // the raster ordering rules.
     if (IsRead(usage)) {
-        if (last_write.any() && (write_tag >= start_tag)) {
+        if (last_write.any() && is_async(write_tag)) {
             hazard.Set(this, usage_index, READ_RACING_WRITE, last_write, write_tag);
         }
     } else {
-        if (last_write.any() && (write_tag >= start_tag)) {
+        if (last_write.any() && is_async(write_tag)) {
             hazard.Set(this, usage_index, WRITE_RACING_WRITE, last_write, write_tag);
         } else if (last_reads.size() > 0) {
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
             for (const auto &read_access : last_reads) {
-                if (read_access.tag >= start_tag) {
+                if (is_async(read_access.tag)) {
                     hazard.Set(this, usage_index, WRITE_RACING_READ, read_access.access, read_access.tag);
                     break;
                 }
@@ -3103,15 +3189,17 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
-                                                    ResourceUsageTag start_tag) const {
+template <typename AsyncTagPredicate>
+HazardResult ResourceAccessStateData::DetectAsyncHazard(const ResourceAccessStateData &recorded_use,
+                                                       const ResourceUsageRange &tag_range,
+                                                       const AsyncTagPredicate &is_async) const {
     HazardResult hazard;
     for (const auto &first : recorded_use.first_accesses_) {
         // Skip and quit logic
         if (first.tag < tag_range.begin) continue;
         if (first.tag >= tag_range.end) break;
 
-        hazard = DetectAsyncHazard(first.usage_index, start_tag);
+        hazard = DetectAsyncHazard(first.usage_index, is_async);
         if (hazard.hazard) {
             hazard.AddRecordedAccess(first);
             break;
@@ -3120,7 +3208,19 @@ HazardResult ResourceAccessState::DetectAsyncHazard(const ResourceAccessState &r
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
+HazardResult ResourceAccessStateData::DetectAsyncHazard(SyncStageAccessIndex usage_index, const ResourceUsageTag start_tag) const {
+    // Async checks need to not go back further than the start of the subpass, as we only want to find hazards between the async
+    // subpasses.  Anything older than that should have been checked at the start of each subpass, taking into account all of
+    // the raster ordering rules.
+    return DetectAsyncHazard(usage_index, [start_tag](ResourceUsageTag tag) { return tag >= start_tag; });
+}
+
+HazardResult ResourceAccessStateData::DetectAsyncHazard(const ResourceAccessStateData &recorded_use,
+                                                       const ResourceUsageRange &tag_range, ResourceUsageTag start_tag) const {
+    return DetectAsyncHazard(recorded_use, tag_range, [start_tag](ResourceUsageTag tag) { return tag >= start_tag; });
+}
+
+HazardResult ResourceAccessStateData::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
                                                       const SyncStageAccessFlags &src_access_scope) const {
     // Only supporting image layout transitions for now
     assert(usage_index == SyncStageAccessIndex::SYNC_IMAGE_LAYOUT_TRANSITION);
@@ -3142,7 +3242,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
+HazardResult ResourceAccessStateData::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
                                                       const SyncStageAccessFlags &src_access_scope,
                                                       const ResourceUsageTag event_tag) const {
     // Only supporting image layout transitions for now
@@ -3189,7 +3289,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
 // The logic behind resolves is the same as update, we assume that earlier hazards have be reported, and that no
 // tranistive hazard can exists with a hazard between the earlier operations.  Yes, an early hazard can mask that another
 // exists, but if you fix *that* hazard it either fixes or unmasks the subsequent ones.
-void ResourceAccessState::Resolve(const ResourceAccessState &other) {
+void ResourceAccessStateData::Resolve(const ResourceAccessStateData &other) {
     if (write_tag < other.write_tag) {
         // If this is a later write, we've reported any exsiting hazard, and we can just overwrite as the more recent
         // operation
@@ -3274,7 +3374,7 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
     }
 }
 
-void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, const ResourceUsageTag tag) {
+void ResourceAccessStateData::Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, const ResourceUsageTag tag) {
     // Move this logic in the ResourceStateTracker as methods, thereof (or we'll repeat it for every flavor of resource...
     const auto usage_bit = FlagBit(usage_index);
     if (IsRead(usage_index)) {
@@ -3311,7 +3411,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
 // We can overwrite them as *this* write is now after them.
 //
 // Note: intentionally ignore pending barriers and chains (i.e. don't apply or clear them), let ApplyPendingBarriers handle them.
-void ResourceAccessState::SetWrite(const SyncStageAccessFlags &usage_bit, const ResourceUsageTag tag) {
+void ResourceAccessStateData::SetWrite(const SyncStageAccessFlags &usage_bit, const ResourceUsageTag tag) {
     last_reads.clear();
     last_read_stages = 0;
     read_execution_barriers = 0;
@@ -3327,7 +3427,7 @@ void ResourceAccessState::SetWrite(const SyncStageAccessFlags &usage_bit, const
 // changes the "chaining" state, but to keep barriers independent, we defer this until all barriers
 // of the batch have been processed. Also, depending on whether layout transition happens, we'll either
 // replace the current write barriers or add to them, so accumulate to pending as well.
-void ResourceAccessState::ApplyBarrier(const SyncBarrier &barrier, bool layout_transition) {
+void ResourceAccessStateData::ApplyBarrier(const SyncBarrier &barrier, bool layout_transition) {
     // For independent barriers we need to track what the new barriers and dependency chain *will* be when we're done
     // applying the memory barriers
     // NOTE: We update the write barrier if the write is in the first access scope or if there is a layout
@@ -3358,7 +3458,7 @@ void ResourceAccessState::ApplyBarrier(const SyncBarrier &barrier, bool layout_t
 
 // Apply the tag scoped memory barrier without updating the existing barriers.  The execution barrier
 // changes the "chaining" state, but to keep barriers independent. See discussion above.
-void ResourceAccessState::ApplyBarrier(const ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition) {
+void ResourceAccessStateData::ApplyBarrier(const ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition) {
     // The scope logic for events is, if we're here, the resource usage was flagged as "in the first execution scope" at
     // the time of the SetEvent, thus all we need check is whether the access is the same one (i.e. before the scope tag
     // in order to know if it's in the excecution scope
@@ -3392,7 +3492,7 @@ void ResourceAccessState::ApplyBarrier(const ResourceUsageTag scope_tag, const S
         }
     }
 }
-void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
+void ResourceAccessStateData::ApplyPendingBarriers(const ResourceUsageTag tag) {
     if (pending_layout_transition) {
         // SetWrite clobbers the last_reads array, and thus we don't have to clear the read_state out.
         SetWrite(SYNC_IMAGE_LAYOUT_TRANSITION_BIT, tag);  // Side effect notes below
@@ -3417,14 +3517,42 @@ void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
     pending_write_barriers = 0;
 }
 
-bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
+bool ResourceAccessStateData::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
     if (!first_accesses_.size()) return false;
     const ResourceUsageRange first_access_range = {first_accesses_.front().tag, first_accesses_.back().tag + 1};
     return tag_range.intersects(first_access_range);
 }
 
+template <typename WaitTagPredicate>
+bool ResourceAccessStateData::ApplyPredicatedWait(const WaitTagPredicate &is_complete) {
+    // Completed accesses can't race with anything submitted later, so rebuild the read state from the remaining reads
+    decltype(last_reads) remaining_reads;
+    VkPipelineStageFlags2KHR remaining_read_stages = 0;
+    VkPipelineStageFlags2KHR remaining_read_barriers = 0;
+    bool remaining_input_attachment_read = false;
+    for (const auto &read_access : last_reads) {
+        if (is_complete(read_access.tag)) continue;
+        remaining_reads.emplace_back(read_access);
+        remaining_read_stages |= read_access.stage;
+        remaining_read_barriers |= read_access.barriers;
+        remaining_input_attachment_read |= (read_access.access & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT).any();
+    }
+    last_reads = std::move(remaining_reads);
+    last_read_stages = remaining_read_stages;
+    read_execution_barriers = remaining_read_barriers;
+    input_attachment_read = input_attachment_read && remaining_input_attachment_read;
+
+    if (last_write.any() && is_complete(write_tag)) {
+        last_write.reset();
+        write_barriers = ~SyncStageAccessFlags(0);
+        write_dependency_chain = 0;
+        write_tag = ResourceUsageTag();
+    }
+    return last_reads.empty() && last_write.none();
+}
+
 // This should be just Bits or Index, but we don't have an invalid state for Index
-VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
+VkPipelineStageFlags2KHR ResourceAccessStateData::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = 0U;
 
     for (const auto &read_access : last_reads) {
@@ -3437,7 +3565,7 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAcc
     return barriers;
 }
 
-inline bool ResourceAccessState::IsRAWHazard(VkPipelineStageFlags2KHR usage_stage, const SyncStageAccessFlags &usage) const {
+inline bool ResourceAccessStateData::IsRAWHazard(VkPipelineStageFlags2KHR usage_stage, const SyncStageAccessFlags &usage) const {
     assert(IsRead(usage));
     // Only RAW vs. last_write if it doesn't happen-after any other read because either:
     //    * the previous reads are not hazards, and thus last_write must be visible and available to
@@ -3447,7 +3575,7 @@ inline bool ResourceAccessState::IsRAWHazard(VkPipelineStageFlags2KHR usage_stag
     return last_write.any() && (0 == (read_execution_barriers & usage_stage)) && IsWriteHazard(usage);
 }
 
-VkPipelineStageFlags2KHR ResourceAccessState::GetOrderedStages(const OrderingBarrier &ordering) const {
+VkPipelineStageFlags2KHR ResourceAccessStateData::GetOrderedStages(const OrderingBarrier &ordering) const {
     // Whether the stage are in the ordering scope only matters if the current write is ordered
     VkPipelineStageFlags2KHR ordered_stages = last_read_stages & ordering.exec_scope;
     // Special input attachment handling as always (not encoded in exec_scop)
@@ -3460,7 +3588,8 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetOrderedStages(const OrderingBar
     return ordered_stages;
 }
 
-void ResourceAccessState::UpdateFirst(const ResourceUsageTag tag, SyncStageAccessIndex usage_index, SyncOrdering ordering_rule) {
+void ResourceAccessStateData::UpdateFirst(const ResourceUsageTag tag, SyncStageAccessIndex usage_index,
+                                          SyncOrdering ordering_rule) {
     // Only record until we record a write.
     if (first_accesses_.empty() || IsRead(first_accesses_.back().usage_index)) {
         const VkPipelineStageFlags2KHR usage_stage = IsRead(usage_index) ? PipelineStageBit(usage_index) : 0U;
@@ -3476,7 +3605,7 @@ void ResourceAccessState::UpdateFirst(const ResourceUsageTag tag, SyncStageAcces
     }
 }
 
-void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag, const OrderingBarrier &layout_ordering) {
+void ResourceAccessStateData::TouchupFirstForLayoutTransition(ResourceUsageTag tag, const OrderingBarrier &layout_ordering) {
     // Only call this after recording an image layout transition
     assert(first_accesses_.size());
     if (first_accesses_.back().tag == tag) {
@@ -3486,7 +3615,7 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     }
 }
 
-void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
+void ResourceAccessStateData::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
                                          VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_) {
     stage = stage_;
     access = access_;
@@ -3500,6 +3629,13 @@ std::shared_ptr<CommandBufferAccessContext> SyncValidator::AccessContextFactory(
     auto cb_state = Get<CMD_BUFFER_STATE>(command_buffer);
     assert(cb_state.get());
     auto queue_flags = cb_state->GetQueueFlags();
+    auto retired = retired_cb_access_state.find(cb_state->command_pool->commandPool());
+    if ((retired != retired_cb_access_state.end()) && !retired->second.empty()) {
+        auto cb_access_context = std::move(retired->second.back());
+        retired->second.pop_back();
+        cb_access_context->Reuse(cb_state, queue_flags);
+        return cb_access_context;
+    }
     return std::make_shared<CommandBufferAccessContext>(*this, cb_state, queue_flags);
 }
 
@@ -3534,8 +3670,18 @@ void SyncValidator::ResetCommandBufferCallback(VkCommandBuffer command_buffer) {
 void SyncValidator::FreeCommandBufferCallback(VkCommandBuffer command_buffer) {
     auto access_found = cb_access_state.find(command_buffer);
     if (access_found != cb_access_state.end()) {
-        access_found->second->Reset();
-        access_found->second->MarkDestroyed();
+        auto &cb_access_context = access_found->second;
+        cb_access_context->Reset();
+        cb_access_context->MarkDestroyed();
+        const CMD_BUFFER_STATE *cb_state = cb_access_context->GetCommandBufferState();
+        if (cb_state && cb_state->command_pool && (cb_access_context.use_count() == 1)) {
+            auto &retired = retired_cb_access_state[cb_state->command_pool->commandPool()];
+            // Beyond the limit, the contexts of a pool that frees many command buffers at once are released
+            if (retired.size() < kMaxRetiredContextsPerPool) {
+                cb_access_context->Retire();
+                retired.emplace_back(std::move(cb_access_context));
+            }
+        }
         cb_access_state.erase(access_found);
     }
 }
@@ -3607,6 +3753,13 @@ void SyncValidator::PreCallRecordDestroyEvent(VkDevice device, VkEvent event, co
     for (auto &cb_context : cb_access_state) {
         cb_context.second->RecordDestroyEvent(event);
     }
+    // ... and from the queue contexts
+    auto event_state = Get<EVENT_STATE>(event);
+    if (event_state) {
+        for (auto &queue_state : queue_sync_states) {
+            queue_state.second->GetCurrentEventsContext()->Destroy(event_state.get());
+        }
+    }
 }
 
 bool SyncValidator::ValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfos,
@@ -3929,6 +4082,10 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // TODO: Find a good way to do this hooklessly.
     SetCommandBufferResetCallback([this](VkCommandBuffer command_buffer) -> void { ResetCommandBufferCallback(command_buffer); });
     SetCommandBufferFreeCallback([this](VkCommandBuffer command_buffer) -> void { FreeCommandBufferCallback(command_buffer); });
+
+    if (validation_worker_threads > 0 && !resolve_thread_pool) {
+        resolve_thread_pool.reset(new ValidationThreadPool(validation_worker_threads));
+    }
 }
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
@@ -3977,6 +4134,13 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     cb_access_context->Reset();
 }
 
+void SyncValidator::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                    const VkAllocationCallbacks *pAllocator) {
+    // Freeing the pool's command buffers retires their contexts to the pool, so drop them after
+    StateTracker::PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
+    retired_cb_access_state.erase(commandPool);
+}
+
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, CMD_TYPE cmd) {
     auto cb_context = GetAccessContext(commandBuffer);
@@ -5793,6 +5957,7 @@ void SyncOpBarriers::ApplyGlobalBarriers(const Barriers &barriers, const Functor
         barriers_functor.EmplaceBack(factory.MakeGlobalBarrierOpFunctor(barrier));
     }
     for (const auto address_type : kAddressTypes) {
+        barriers_functor.ResetUpdateCache();
         auto range_gen = factory.MakeGlobalRangeGen(address_type);
         UpdateMemoryAccessState(&(access_context->GetAccessStateMap(address_type)), barriers_functor, &range_gen);
     }
@@ -6685,6 +6850,420 @@ void SyncValidator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
     }
 }
 
+SyncSubmitBatch::SyncSubmitBatch(const VkSubmitInfo &submit) {
+    for (uint32_t i = 0; i < submit.waitSemaphoreCount; ++i) {
+        const VkPipelineStageFlags2KHR stage_mask =
+            submit.pWaitDstStageMask ? submit.pWaitDstStageMask[i] : VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+        wait_semaphores.emplace_back(submit.pWaitSemaphores[i], stage_mask);
+    }
+    command_buffers.assign(submit.pCommandBuffers, submit.pCommandBuffers + submit.commandBufferCount);
+    for (uint32_t i = 0; i < submit.signalSemaphoreCount; ++i) {
+        // Semaphore signal operations of vkQueueSubmit have all commands as their first synchronization scope
+        signal_semaphores.emplace_back(submit.pSignalSemaphores[i], VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR);
+    }
+}
+
+SyncSubmitBatch::SyncSubmitBatch(const VkSubmitInfo2KHR &submit) {
+    for (uint32_t i = 0; i < submit.waitSemaphoreInfoCount; ++i) {
+        const auto &info = submit.pWaitSemaphoreInfos[i];
+        wait_semaphores.emplace_back(info.semaphore, info.stageMask);
+    }
+    for (uint32_t i = 0; i < submit.commandBufferInfoCount; ++i) {
+        command_buffers.emplace_back(submit.pCommandBufferInfos[i].commandBuffer);
+    }
+    for (uint32_t i = 0; i < submit.signalSemaphoreInfoCount; ++i) {
+        const auto &info = submit.pSignalSemaphoreInfos[i];
+        signal_semaphores.emplace_back(info.semaphore, info.stageMask);
+    }
+}
+
+template <typename SubmitInfo>
+static std::vector<SyncSubmitBatch> MakeSubmitBatches(uint32_t submit_count, const SubmitInfo *submits) {
+    std::vector<SyncSubmitBatch> batches;
+    batches.reserve(submit_count);
+    for (uint32_t i = 0; i < submit_count; ++i) {
+        batches.emplace_back(submits[i]);
+    }
+    return batches;
+}
+
+QueueSyncState::QueueSyncState(const QueueSyncState &real_context, AsProxyContext dummy)
+    : CommandExecutionContext(&real_context.GetSyncState()),
+      queue_(real_context.queue_),
+      queue_flags_(real_context.queue_flags_),
+      tag_limit_(real_context.tag_limit_),
+      submit_index_(real_context.submit_index_),
+      batch_index_(0),
+      access_context_(),
+      events_context_(real_context.events_context_.DeepCopy()),
+      sync_points_(real_context.sync_points_),
+      access_log_() {}
+
+std::string QueueSyncState::FormatUsage(ResourceUsageTag tag) const {
+    ResourceUsageTag base_tag = 0;
+    const SubmittedAccessLog *submitted = GetSubmittedAccessLog(tag, &base_tag);
+    // Accesses imported from other queues by semaphore waits have tags from those queues' logs
+    if (!submitted) return sync_state_->FormatSubmittedUsage(tag);
+
+    std::stringstream out;
+    const auto &record = (*submitted->log)[tag - base_tag];
+    auto queue_state = sync_state_->Get<QUEUE_STATE>(queue_);
+    out << "submit: " << submitted->submit_index << ", batch: " << submitted->batch_index;
+    out << SyncNodeFormatter(*sync_state_, queue_state.get()) << ", " << record;
+    out << SyncNodeFormatter(*sync_state_, record.cb_state);
+    out << ", reset_no: " << std::to_string(record.reset_count);
+    return out.str();
+}
+
+void QueueSyncState::InsertRecordedAccessLogEntries(const CommandBufferAccessContext &cb_context) {
+    const ResourceUsageTag tag_count = cb_context.GetTagLimit();
+    if (!tag_count) return;
+    access_log_.emplace(tag_limit_, SubmittedAccessLog(submit_index_, batch_index_, cb_context));
+    tag_limit_ += tag_count;
+}
+
+ResourceUsageTag QueueSyncState::GetSyncPoint(VkQueue queue) const {
+    auto found = sync_points_.find(queue);
+    return (found != sync_points_.cend()) ? found->second : ResourceUsageTag(0);
+}
+
+const SubmittedAccessLog *QueueSyncState::GetSubmittedAccessLog(ResourceUsageTag tag, ResourceUsageTag *base_tag) const {
+    auto found = access_log_.upper_bound(tag);
+    if (found == access_log_.cbegin()) return nullptr;
+    --found;
+    if ((tag - found->first) >= found->second.log->size()) return nullptr;
+    if (base_tag) *base_tag = found->first;
+    return &found->second;
+}
+
+void QueueSyncState::BeginSubmit(ResourceUsageTag tag_base) {
+    // Other queues may have submitted since, and tags are unique across queues
+    tag_limit_ = std::max(tag_limit_, tag_base);
+    ++submit_index_;
+    batch_index_ = 0;
+}
+
+void QueueSyncState::ImportAccessRanges(const AccessContext &from, const AccessContext &ranges_of) {
+    const NoopBarrierAction noop_barrier;
+    for (const auto address_type : kAddressTypes) {
+        auto *access_map = &access_context_.GetAccessStateMap(address_type);
+        for (const auto &access : ranges_of.GetAccessStateMap(address_type)) {
+            from.ResolveAccessRange(address_type, access.first, noop_barrier, access_map, nullptr, false);
+        }
+    }
+}
+
+void QueueSyncState::ImportSignaledSemaphore(const SignaledSemaphore &signal, VkPipelineStageFlags2KHR wait_mask,
+                                             const AccessContext *ranges_of) {
+    // The semaphore signal/wait pair is a memory dependency covering all accesses in the stages of the two scopes
+    SyncBarrier barrier(signal.exec_scope, SyncExecScope::MakeDst(queue_flags_, wait_mask));
+    barrier.src_access_scope = barrier.src_exec_scope.valid_accesses;
+    barrier.dst_access_scope = barrier.dst_exec_scope.valid_accesses;
+    const std::vector<SyncBarrier> barriers(1, barrier);
+    const ApplyTrackbackStackAction barrier_action(barriers);
+
+    const AccessContext &from = *signal.access_context;
+    for (const auto address_type : kAddressTypes) {
+        auto *access_map = &access_context_.GetAccessStateMap(address_type);
+        if (ranges_of) {
+            for (const auto &access : ranges_of->GetAccessStateMap(address_type)) {
+                from.ResolveAccessRange(address_type, access.first, barrier_action, access_map, nullptr, false);
+            }
+        } else {
+            from.ResolveAccessRange(address_type, kFullRange, barrier_action, access_map, nullptr, false);
+        }
+    }
+
+    // Everything that happened-before the signal happens-before the work after the wait
+    auto merge_sync_point = [this](VkQueue queue, ResourceUsageTag tag) {
+        if (queue == queue_) return;
+        auto &sync_point = sync_points_[queue];
+        sync_point = std::max(sync_point, tag);
+    };
+    merge_sync_point(signal.queue, signal.tag);
+    for (const auto &sync_point : signal.sync_points) {
+        merge_sync_point(sync_point.first, sync_point.second);
+    }
+}
+
+void QueueSyncState::RecordSubmittedCommandBuffer(const CommandBufferAccessContext &recorded_context) {
+    // As for vkCmdExecuteCommands, only the barriers are replayed as Resolve will overwrite outdated state
+    const ResourceUsageTag base_tag = GetTagLimit();
+    for (const auto &sync_op : recorded_context.GetSyncOps()) {
+        sync_op.sync_op->ReplayRecord(base_tag + sync_op.tag, &access_context_, &events_context_);
+    }
+
+    ResourceUsageRange tag_range = ImportRecordedAccessLog(recorded_context);
+    assert(base_tag == tag_range.begin);
+    ResolveRecordedContext(*recorded_context.GetCurrentAccessContext(), tag_range.begin);
+}
+
+SignaledSemaphore QueueSyncState::Signal(VkPipelineStageFlags2KHR signal_mask) const {
+    SignaledSemaphore signal;
+    signal.queue = queue_;
+    signal.exec_scope = SyncExecScope::MakeSrc(queue_flags_, signal_mask);
+    signal.tag = tag_limit_;
+    signal.access_context = std::make_shared<AccessContext>(access_context_);
+    signal.sync_points = sync_points_;
+    return signal;
+}
+
+void QueueSyncState::TrimAccessLog(ResourceUsageTag tag) {
+    auto pos = access_log_.begin();
+    while ((pos != access_log_.end()) && ((pos->first + pos->second.log->size()) <= tag)) {
+        pos = access_log_.erase(pos);
+    }
+}
+
+QueueSyncState *SyncValidator::GetQueueSyncState(VkQueue queue) {
+    return GetMappedInsert(queue_sync_states, queue,
+                           [this, queue]() { return std::make_shared<QueueSyncState>(*this, queue, GetQueueFlags(queue)); })
+        .get();
+}
+
+const QueueSyncState *SyncValidator::GetQueueSyncState(VkQueue queue) const {
+    return GetMappedPlainFromShared(queue_sync_states, queue);
+}
+
+VkQueueFlags SyncValidator::GetQueueFlags(VkQueue queue) const {
+    auto queue_state = Get<QUEUE_STATE>(queue);
+    if (!queue_state) return 0;
+    return physical_device_state->queue_family_properties[queue_state->queueFamilyIndex].queueFlags;
+}
+
+std::string SyncValidator::FormatSubmittedUsage(ResourceUsageTag tag) const {
+    for (const auto &queue_state : queue_sync_states) {
+        if (queue_state.second->IsSubmittedTag(tag)) return queue_state.second->FormatUsage(tag);
+    }
+    return std::string();
+}
+
+void SyncValidator::ApplyQueueWait(VkQueue queue, ResourceUsageTag tag) {
+    auto found = queue_sync_states.find(queue);
+    if (found == queue_sync_states.end()) return;
+
+    // The completed accesses of the waited queue no longer need tracking, wherever they have been imported
+    const QueueSyncState &waited_state = *found->second;
+    auto is_complete = [&waited_state, tag](ResourceUsageTag access_tag) {
+        return (access_tag < tag) && waited_state.IsSubmittedTag(access_tag);
+    };
+    for (auto &queue_state : queue_sync_states) {
+        queue_state.second->GetCurrentAccessContext()->ApplyPredicatedWait(is_complete);
+    }
+    for (auto &signal : signaled_semaphores) {
+        signal.second.access_context->ApplyPredicatedWait(is_complete);
+    }
+    found->second->TrimAccessLog(tag);
+}
+
+void SyncValidator::ApplyFenceWait(VkFence fence) {
+    auto found = waitable_fences.find(fence);
+    if (found == waitable_fences.end()) return;
+    ApplyQueueWait(found->second.first, found->second.second);
+    waitable_fences.erase(found);
+}
+
+bool SyncValidator::ValidateQueueSubmit(VkQueue queue, const std::vector<SyncSubmitBatch> &batches, const char *func_name) const {
+    bool skip = false;
+
+    // Gather the recorded contexts, skipping command buffers with no sync validation state (e.g. never recorded)
+    std::vector<std::vector<const CommandBufferAccessContext *>> batch_cb_contexts(batches.size());
+    for (size_t batch_index = 0; batch_index < batches.size(); ++batch_index) {
+        for (const VkCommandBuffer cb : batches[batch_index].command_buffers) {
+            const auto *cb_context = GetAccessContext(cb);
+            if (cb_context) batch_cb_contexts[batch_index].emplace_back(cb_context);
+        }
+    }
+
+    // The proxy only holds the address ranges the submitted command buffers access, as no others can be hazards
+    const QueueSyncState *queue_state = GetQueueSyncState(queue);
+    QueueSyncState proxy = queue_state ? QueueSyncState(*queue_state, QueueSyncState::AsProxyContext())
+                                       : QueueSyncState(*this, queue, GetQueueFlags(queue));
+    if (queue_state) {
+        for (const auto &cb_contexts : batch_cb_contexts) {
+            for (const auto *cb_context : cb_contexts) {
+                proxy.ImportAccessRanges(*queue_state->GetCurrentAccessContext(), *cb_context->GetCurrentAccessContext());
+            }
+        }
+    }
+    proxy.BeginSubmit(queue_tag_limit);
+
+    // Semaphores signaled by earlier batches of this submission
+    layer_data::unordered_map<VkSemaphore, SignaledSemaphore> batch_signals;
+    for (uint32_t batch_index = 0; batch_index < static_cast<uint32_t>(batches.size()); ++batch_index) {
+        const SyncSubmitBatch &batch = batches[batch_index];
+        proxy.BeginBatch(batch_index);
+
+        for (const auto &wait : batch.wait_semaphores) {
+            const SignaledSemaphore *signal = nullptr;
+            auto batch_signal = batch_signals.find(wait.semaphore);
+            if (batch_signal != batch_signals.cend()) {
+                signal = &batch_signal->second;
+            } else {
+                auto queue_signal = signaled_semaphores.find(wait.semaphore);
+                if (queue_signal != signaled_semaphores.cend()) signal = &queue_signal->second;
+            }
+            if (!signal) continue;
+            for (const auto &cb_contexts : batch_cb_contexts) {
+                for (const auto *cb_context : cb_contexts) {
+                    proxy.ImportSignaledSemaphore(*signal, wait.stage_mask, cb_context->GetCurrentAccessContext());
+                }
+            }
+        }
+
+        uint32_t cb_index = 0;
+        for (const auto *cb_context : batch_cb_contexts[batch_index]) {
+            skip |= cb_context->ValidateFirstUse(&proxy, func_name, cb_index);
+
+            // Work submitted to other queues and not ordered by a semaphore wait can run concurrently with this batch
+            for (const auto &other : queue_sync_states) {
+                if (other.first == queue) continue;
+                const QueueSyncState &other_state = *other.second;
+                const ResourceUsageTag sync_point = proxy.GetSyncPoint(other.first);
+                auto is_async = [&other_state, sync_point](ResourceUsageTag tag) {
+                    return (tag >= sync_point) && other_state.IsSubmittedTag(tag);
+                };
+                const AccessContext *recorded_context = cb_context->GetCurrentAccessContext();
+                HazardResult hazard = recorded_context->DetectFirstUseAsyncHazard(*other_state.GetCurrentAccessContext(), is_async);
+                if (hazard.hazard) {
+                    skip |= LogError(queue, string_SyncHazardVUID(hazard.hazard),
+                                     "%s: Hazard %s for entry %" PRIu32 ", %s, Recorded access info %s. Access info %s.", func_name,
+                                     string_SyncHazard(hazard.hazard), cb_index,
+                                     report_data->FormatHandle(cb_context->GetCBState().commandBuffer()).c_str(),
+                                     cb_context->FormatUsage(*hazard.recorded_access).c_str(),
+                                     other_state.FormatHazard(hazard).c_str());
+                }
+            }
+
+            ResourceUsageRange tag_range = proxy.ImportRecordedAccessLog(*cb_context);
+            proxy.ResolveRecordedContext(*cb_context->GetCurrentAccessContext(), tag_range.begin);
+            ++cb_index;
+        }
+
+        for (const auto &signal : batch.signal_semaphores) {
+            batch_signals[signal.semaphore] = proxy.Signal(signal.stage_mask);
+        }
+    }
+    return skip;
+}
+
+void SyncValidator::RecordQueueSubmit(VkQueue queue, const std::vector<SyncSubmitBatch> &batches, VkFence fence) {
+    auto *queue_state = GetQueueSyncState(queue);
+    queue_state->BeginSubmit(queue_tag_limit);
+    for (uint32_t batch_index = 0; batch_index < static_cast<uint32_t>(batches.size()); ++batch_index) {
+        const SyncSubmitBatch &batch = batches[batch_index];
+        queue_state->BeginBatch(batch_index);
+
+        for (const auto &wait : batch.wait_semaphores) {
+            auto signal = signaled_semaphores.find(wait.semaphore);
+            if (signal == signaled_semaphores.end()) continue;
+            queue_state->ImportSignaledSemaphore(signal->second, wait.stage_mask, nullptr);
+            // A binary semaphore wait unsignals the semaphore, timeline semaphores keep the latest signal
+            auto semaphore_state = Get<SEMAPHORE_STATE>(wait.semaphore);
+            if (!semaphore_state || (semaphore_state->type == VK_SEMAPHORE_TYPE_BINARY)) {
+                signaled_semaphores.erase(signal);
+            }
+        }
+
+        for (const VkCommandBuffer cb : batch.command_buffers) {
+            const auto *cb_context = GetAccessContextNoInsert(cb);
+            if (cb_context) queue_state->RecordSubmittedCommandBuffer(*cb_context);
+        }
+
+        for (const auto &signal : batch.signal_semaphores) {
+            signaled_semaphores[signal.semaphore] = queue_state->Signal(signal.stage_mask);
+        }
+    }
+
+    queue_tag_limit = queue_state->GetTagLimit();
+    if (fence != VK_NULL_HANDLE) {
+        waitable_fences[fence] = std::make_pair(queue, queue_tag_limit);
+    }
+}
+
+bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                               VkFence fence) const {
+    bool skip = StateTracker::PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
+    skip |= ValidateQueueSubmit(queue, MakeSubmitBatches(submitCount, pSubmits), "vkQueueSubmit");
+    return skip;
+}
+
+void SyncValidator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                              VkResult result) {
+    StateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
+    if (result != VK_SUCCESS) return;
+    RecordQueueSubmit(queue, MakeSubmitBatches(submitCount, pSubmits), fence);
+}
+
+bool SyncValidator::PreCallValidateQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                                   VkFence fence) const {
+    bool skip = StateTracker::PreCallValidateQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    skip |= ValidateQueueSubmit(queue, MakeSubmitBatches(submitCount, pSubmits), "vkQueueSubmit2KHR");
+    return skip;
+}
+
+void SyncValidator::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                                  VkFence fence, VkResult result) {
+    StateTracker::PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, result);
+    if (result != VK_SUCCESS) return;
+    RecordQueueSubmit(queue, MakeSubmitBatches(submitCount, pSubmits), fence);
+}
+
+bool SyncValidator::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                                VkFence fence) const {
+    bool skip = StateTracker::PreCallValidateQueueSubmit2(queue, submitCount, pSubmits, fence);
+    skip |= ValidateQueueSubmit(queue, MakeSubmitBatches(submitCount, pSubmits), "vkQueueSubmit2");
+    return skip;
+}
+
+void SyncValidator::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
+                                               VkResult result) {
+    StateTracker::PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, result);
+    if (result != VK_SUCCESS) return;
+    RecordQueueSubmit(queue, MakeSubmitBatches(submitCount, pSubmits), fence);
+}
+
+void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    StateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    if (result != VK_SUCCESS) return;
+    ApplyQueueWait(queue, ResourceUsageRecord::kMaxIndex);
+}
+
+void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    StateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    if (result != VK_SUCCESS) return;
+    for (const auto &queue_state : queue_sync_states) {
+        ApplyQueueWait(queue_state.first, ResourceUsageRecord::kMaxIndex);
+    }
+    waitable_fences.clear();
+}
+
+void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                                uint64_t timeout, VkResult result) {
+    StateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    // With waitAny, which of several fences completed isn't known
+    if ((result != VK_SUCCESS) || (!waitAll && (fenceCount != 1))) return;
+    for (uint32_t i = 0; i < fenceCount; ++i) {
+        ApplyFenceWait(pFences[i]);
+    }
+}
+
+void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    StateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    if (result != VK_SUCCESS) return;
+    ApplyFenceWait(fence);
+}
+
+void SyncValidator::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
+    StateTracker::PreCallRecordDestroyFence(device, fence, pAllocator);
+    waitable_fences.erase(fence);
+}
+
+void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
+    StateTracker::PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
+    signaled_semaphores.erase(semaphore);
+}
+
 AttachmentViewGen::AttachmentViewGen(const IMAGE_VIEW_STATE *view, const VkOffset3D &offset, const VkExtent3D &extent)
     : view_(view), view_mask_(), gen_store_() {
     if (!view_ || !view_->image_state || !SimpleBinding(*view_->image_state)) return;
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <vulkan/vulkan.h>
 
@@ -34,6 +35,7 @@ class AccessContext;
 class CommandBufferAccessContext;
 class CommandExecutionContext;
 class ResourceAccessState;
+class ResourceAccessStateData;
 struct ResourceFirstAccess;
 class SyncValidator;
 
@@ -127,7 +129,7 @@ struct HazardResult {
     SyncHazard hazard = NONE;
     SyncStageAccessFlags prior_access = 0U;  // TODO -- change to a NONE enum in ...Bits
     ResourceUsageTag tag = ResourceUsageTag();
-    void Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
+    void Set(const ResourceAccessStateData *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
              const SyncStageAccessFlags &prior_, ResourceUsageTag tag_);
     void AddRecordedAccess(const ResourceFirstAccess &first_access);
 };
@@ -252,6 +254,14 @@ class SyncEventsContext {
         }
     }
     void Clear() { map_.clear(); }
+    // The default copy shares the event states, this copies them so that the copy can be replayed into independently
+    SyncEventsContext DeepCopy() const {
+        SyncEventsContext copy;
+        for (const auto &event : map_) {
+            copy.map_.emplace(event.first, std::make_shared<SyncEventState>(*event.second));
+        }
+        return copy;
+    }
 
   private:
     Map map_;
@@ -272,7 +282,10 @@ struct ResourceFirstAccess {
     }
 };
 
-class ResourceAccessState : public SyncStageAccess {
+// The state data behind a ResourceAccessState, see below.
+class ResourceAccessStateData : public SyncStageAccess {
+    friend class ResourceAccessState;
+
   protected:
     struct OrderingBarrier {
         VkPipelineStageFlags2KHR exec_scope;
@@ -326,11 +339,17 @@ class ResourceAccessState : public SyncStageAccess {
     HazardResult DetectHazard(SyncStageAccessIndex usage_index) const;
     HazardResult DetectHazard(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule) const;
     HazardResult DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const;
-    HazardResult DetectHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range) const;
+    HazardResult DetectHazard(const ResourceAccessStateData &recorded_use, const ResourceUsageRange &tag_range) const;
 
     HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, ResourceUsageTag start_tag) const;
-    HazardResult DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
+    HazardResult DetectAsyncHazard(const ResourceAccessStateData &recorded_use, const ResourceUsageRange &tag_range,
                                    ResourceUsageTag start_tag) const;
+    // As above, but with the accesses that are asynchronous selected by a tag predicate instead of a start tag
+    template <typename AsyncTagPredicate>
+    HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, const AsyncTagPredicate &is_async) const;
+    template <typename AsyncTagPredicate>
+    HazardResult DetectAsyncHazard(const ResourceAccessStateData &recorded_use, const ResourceUsageRange &tag_range,
+                                   const AsyncTagPredicate &is_async) const;
 
     HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR source_exec_scope,
                                      const SyncStageAccessFlags &source_access_scope) const;
@@ -339,13 +358,16 @@ class ResourceAccessState : public SyncStageAccess {
 
     void Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, ResourceUsageTag tag);
     void SetWrite(const SyncStageAccessFlags &usage_bit, ResourceUsageTag tag);
-    void Resolve(const ResourceAccessState &other);
+    void Resolve(const ResourceAccessStateData &other);
     void ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition);
     void ApplyBarriersImmediate(const std::vector<SyncBarrier> &barriers);
     void ApplyBarrier(const SyncBarrier &barrier, bool layout_transition);
     void ApplyBarrier(ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition);
     void ApplyPendingBarriers(ResourceUsageTag tag);
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
+    // Drop the accesses whose tags the predicate reports as complete (host waits), returns true if no accesses remain
+    template <typename WaitTagPredicate>
+    bool ApplyPredicatedWait(const WaitTagPredicate &is_complete);
 
     void OffsetTag(ResourceUsageTag offset) {
         if (last_write.any()) write_tag += offset;
@@ -356,7 +378,7 @@ class ResourceAccessState : public SyncStageAccess {
             first.tag += offset;
         }
     }
-    ResourceAccessState()
+    ResourceAccessStateData()
         : write_barriers(~SyncStageAccessFlags(0)),
           write_dependency_chain(0),
           write_tag(),
@@ -376,14 +398,14 @@ class ResourceAccessState : public SyncStageAccess {
         return (0 != pending_layout_transition) || pending_write_barriers.any() || (0 != pending_write_dep_chain);
     }
     bool HasWriteOp() const { return last_write != 0; }
-    bool operator==(const ResourceAccessState &rhs) const {
+    bool operator==(const ResourceAccessStateData &rhs) const {
         bool same = (write_barriers == rhs.write_barriers) && (write_dependency_chain == rhs.write_dependency_chain) &&
                     (last_reads == rhs.last_reads) && (last_read_stages == rhs.last_read_stages) && (write_tag == rhs.write_tag) &&
                     (input_attachment_read == rhs.input_attachment_read) &&
                     (read_execution_barriers == rhs.read_execution_barriers) && (first_accesses_ == rhs.first_accesses_);
         return same;
     }
-    bool operator!=(const ResourceAccessState &rhs) const { return !(*this == rhs); }
+    bool operator!=(const ResourceAccessStateData &rhs) const { return !(*this == rhs); }
     VkPipelineStageFlags2KHR GetReadBarriers(const SyncStageAccessFlags &usage) const;
     SyncStageAccessFlags GetWriteBarriers() const { return write_barriers; }
     bool InSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const {
@@ -455,6 +477,144 @@ class ResourceAccessState : public SyncStageAccess {
 
     static OrderingBarriers kOrderingRules;
 };
+
+// The access state of a range of memory, as stored in the access maps of the contexts.
+//
+// The state data is shared between copies, and copied when one of the sharing states changes (copy on write). The range maps
+// copy their entries on every split, resolve, and import, and most of those copies are never changed, or are all changed in the
+// same way. Default constructed states all share a single data instance.
+class ResourceAccessState {
+  public:
+    using OrderingBarrier = ResourceAccessStateData::OrderingBarrier;
+
+    // Applies an operation to a series of states (typically those of a range map walk) s.t. states that shared their data before
+    // the operation also share the result, instead of each making its own copy of the data. The operation must depend only on
+    // the state data it's applied to.
+    class UpdateCache {
+      public:
+        template <typename Operation>
+        void Apply(ResourceAccessState *state, const Operation &operation) {
+            if (state->data_.use_count() == 1) {
+                // Nothing else shares this data (including the cache) so it's updated in place
+                operation(state);
+                return;
+            }
+            for (const auto &entry : entries_) {
+                if (entry.first == state->data_) {
+                    state->data_ = entry.second;
+                    return;
+                }
+            }
+            // The cache entry keeps the input alive, s.t. its address isn't reused for a different state
+            auto &entry = entries_[next_entry_];
+            next_entry_ = (next_entry_ + 1) % kSize;
+            entry.first = state->data_;
+            operation(state);
+            entry.second = state->data_;
+        }
+        void Clear() {
+            entries_ = {};
+            next_entry_ = 0;
+        }
+
+      private:
+        static constexpr size_t kSize = 4;
+        using DataPtr = std::shared_ptr<ResourceAccessStateData>;
+        std::array<std::pair<DataPtr, DataPtr>, kSize> entries_;
+        size_t next_entry_ = 0;
+    };
+
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index) const { return data_->DetectHazard(usage_index); }
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule) const {
+        return data_->DetectHazard(usage_index, ordering_rule);
+    }
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const {
+        return data_->DetectHazard(usage_index, ordering);
+    }
+    HazardResult DetectHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range) const {
+        return data_->DetectHazard(*recorded_use.data_, tag_range);
+    }
+
+    HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, ResourceUsageTag start_tag) const {
+        return data_->DetectAsyncHazard(usage_index, start_tag);
+    }
+    HazardResult DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
+                                   ResourceUsageTag start_tag) const {
+        return data_->DetectAsyncHazard(*recorded_use.data_, tag_range, start_tag);
+    }
+    template <typename AsyncTagPredicate>
+    HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, const AsyncTagPredicate &is_async) const {
+        return data_->DetectAsyncHazard(usage_index, is_async);
+    }
+    template <typename AsyncTagPredicate>
+    HazardResult DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
+                                   const AsyncTagPredicate &is_async) const {
+        return data_->DetectAsyncHazard(*recorded_use.data_, tag_range, is_async);
+    }
+
+    HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR source_exec_scope,
+                                     const SyncStageAccessFlags &source_access_scope) const {
+        return data_->DetectBarrierHazard(usage_index, source_exec_scope, source_access_scope);
+    }
+    HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR source_exec_scope,
+                                     const SyncStageAccessFlags &source_access_scope, ResourceUsageTag event_tag) const {
+        return data_->DetectBarrierHazard(usage_index, source_exec_scope, source_access_scope, event_tag);
+    }
+
+    void Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, ResourceUsageTag tag) {
+        Mutable().Update(usage_index, ordering_rule, tag);
+    }
+    void SetWrite(const SyncStageAccessFlags &usage_bit, ResourceUsageTag tag) { Mutable().SetWrite(usage_bit, tag); }
+    void Resolve(const ResourceAccessState &other) {
+        if (data_ == other.data_) return;  // Resolving identical states is a noop
+        if (data_->write_tag < other.data_->write_tag) {
+            // The more recent write replaces this state entirely, see ResourceAccessStateData::Resolve
+            data_ = other.data_;
+            return;
+        }
+        Mutable().Resolve(*other.data_);
+    }
+    void ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition) {
+        Mutable().ApplyBarriers(barriers, layout_transition);
+    }
+    void ApplyBarriersImmediate(const std::vector<SyncBarrier> &barriers) { Mutable().ApplyBarriersImmediate(barriers); }
+    void ApplyBarrier(const SyncBarrier &barrier, bool layout_transition) { Mutable().ApplyBarrier(barrier, layout_transition); }
+    void ApplyBarrier(ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition) {
+        Mutable().ApplyBarrier(scope_tag, barrier, layout_transition);
+    }
+    void ApplyPendingBarriers(ResourceUsageTag tag) { Mutable().ApplyPendingBarriers(tag); }
+    bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const { return data_->FirstAccessInTagRange(tag_range); }
+    template <typename WaitTagPredicate>
+    bool ApplyPredicatedWait(const WaitTagPredicate &is_complete) {
+        return Mutable().ApplyPredicatedWait(is_complete);
+    }
+    void OffsetTag(ResourceUsageTag offset) { Mutable().OffsetTag(offset); }
+
+    ResourceAccessState() : data_(DefaultData()) {}
+    explicit ResourceAccessState(const ResourceAccessStateData &data) : data_(std::make_shared<ResourceAccessStateData>(data)) {}
+
+    bool HasPendingState() const { return data_->HasPendingState(); }
+    bool HasWriteOp() const { return data_->HasWriteOp(); }
+    bool operator==(const ResourceAccessState &rhs) const { return (data_ == rhs.data_) || (*data_ == *rhs.data_); }
+    bool operator!=(const ResourceAccessState &rhs) const { return !(*this == rhs); }
+    bool SharesData(const ResourceAccessState &other) const { return data_ == other.data_; }
+    VkPipelineStageFlags2KHR GetReadBarriers(const SyncStageAccessFlags &usage) const { return data_->GetReadBarriers(usage); }
+    SyncStageAccessFlags GetWriteBarriers() const { return data_->GetWriteBarriers(); }
+    bool InSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const {
+        return data_->InSourceScopeOrChain(src_exec_scope, src_access_scope);
+    }
+
+  private:
+    ResourceAccessStateData &Mutable() {
+        if (data_.use_count() != 1) {
+            data_ = std::make_shared<ResourceAccessStateData>(*data_);
+        }
+        return *data_;
+    }
+    static const std::shared_ptr<ResourceAccessStateData> &DefaultData();
+
+    std::shared_ptr<ResourceAccessStateData> data_;
+};
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
 using ResourceAccessStateConstFunction = std::function<void(const ResourceAccessState &)>;
 
@@ -463,6 +623,23 @@ using ResourceAccessRange = typename ResourceAccessRangeMap::key_type;
 using ResourceAccessRangeIndex = typename ResourceAccessRange::index_type;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
+// Barriers and resolves applied across a range leave runs of entries sharing their copy-on-write state data. As the detectors
+// (unless specialized) check only the state, the range walkers skip the entries sharing data with the last one checked.
+template <typename Detector>
+struct DetectsStateOnly : std::true_type {};
+
+template <typename Detector>
+class SharedStateSkip {
+  public:
+    bool Skip(const ResourceAccessState &access) const {
+        return DetectsStateOnly<Detector>::value && last_checked_ && access.SharesData(*last_checked_);
+    }
+    void Checked(const ResourceAccessState &access) { last_checked_ = &access; }
+
+  private:
+    const ResourceAccessState *last_checked_ = nullptr;
+};
+
 class AttachmentViewGen {
   public:
     enum Gen { kViewSubresource = 0, kRenderArea = 1, kDepthOnlyRenderArea = 2, kStencilOnlyRenderArea = 3, kGenSize = 4 };
@@ -830,6 +1007,10 @@ class AccessContext {
 
     HazardResult DetectFirstUseHazard(const ResourceUsageRange &tag_range, const AccessContext &access_context,
                                       const ReplayTrackbackBarriersAction *replay_barrier) const;
+    template <typename AsyncTagPredicate>
+    HazardResult DetectFirstUseAsyncHazard(const AccessContext &async_context, const AsyncTagPredicate &is_async) const;
+    template <typename WaitTagPredicate>
+    void ApplyPredicatedWait(const WaitTagPredicate &is_complete);
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -880,7 +1061,9 @@ class AccessContext {
     void UpdateAttachmentStoreAccess(const RENDER_PASS_STATE &rp_state, const AttachmentViewGenVector &attachment_views,
                                      uint32_t subpass, ResourceUsageTag tag);
 
-    void ResolveChildContexts(const std::vector<AccessContext> &contexts);
+    // With a thread pool, the maps of the address types are resolved concurrently. Each map still resolves the contexts in
+    // order, so the result doesn't depend on the pool.
+    void ResolveChildContexts(const std::vector<AccessContext> &contexts, ValidationThreadPool *thread_pool = nullptr);
 
     void ImportAsyncContexts(const AccessContext &from);
     template <typename Action, typename RangeGen>
@@ -973,7 +1156,8 @@ class RenderPassAccessContext {
     void RecordLoadOperations(ResourceUsageTag tag);
     void RecordBeginRenderPass(ResourceUsageTag tag, ResourceUsageTag load_tag);
     void RecordNextSubpass(ResourceUsageTag store_tag, ResourceUsageTag barrier_tag, ResourceUsageTag load_tag);
-    void RecordEndRenderPass(AccessContext *external_context, ResourceUsageTag store_tag, ResourceUsageTag barrier_tag);
+    void RecordEndRenderPass(AccessContext *external_context, ResourceUsageTag store_tag, ResourceUsageTag barrier_tag,
+                             ValidationThreadPool *thread_pool = nullptr);
 
     AccessContext &CurrentContext() { return subpass_contexts_[current_subpass_]; }
     const AccessContext &CurrentContext() const { return subpass_contexts_[current_subpass_]; }
@@ -1028,6 +1212,7 @@ class CommandExecutionContext {
 
 class CommandBufferAccessContext : public CommandExecutionContext {
   public:
+    using CommandBufferSet = layer_data::unordered_set<std::shared_ptr<const CMD_BUFFER_STATE>>;
     using SyncOpPointer = std::shared_ptr<SyncOpBase>;
     struct SyncOpEntry {
         ResourceUsageTag tag;
@@ -1042,8 +1227,8 @@ class CommandBufferAccessContext : public CommandExecutionContext {
           cb_state_(),
           queue_flags_(),
           destroyed_(false),
-          access_log_(),
-          cbs_referenced_(),
+          access_log_(std::make_shared<AccessLog>()),
+          cbs_referenced_(std::make_shared<CommandBufferSet>()),
           command_number_(0),
           subcommand_number_(0),
           reset_count_(0),
@@ -1067,8 +1252,9 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     const CommandExecutionContext &GetExecutionContext() const { return *this; }
 
     void Reset() {
-        access_log_.clear();
-        cbs_referenced_.clear();
+        // Queue submissions may still reference the log of the previous recording, otherwise it's cleared and its storage reused
+        ResetShared(&access_log_);
+        ResetShared(&cbs_referenced_);
         sync_ops_.clear();
         command_number_ = 0;
         subcommand_number_ = 0;
@@ -1081,6 +1267,15 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     }
     void MarkDestroyed() { destroyed_ = true; }
     bool IsDestroyed() const { return destroyed_; }
+    // A reset context of a freed command buffer is parked in its command pool, and handed to the pool's next allocation
+    void Retire() { cb_state_.reset(); }
+    void Reuse(const std::shared_ptr<CMD_BUFFER_STATE> &cb_state, VkQueueFlags queue_flags) {
+        assert(!cb_state_);
+        cb_state_ = cb_state;
+        queue_flags_ = queue_flags;
+        destroyed_ = false;
+        reset_count_ = 0;
+    }
 
     std::string FormatUsage(ResourceUsageTag tag) const override;
     std::string FormatUsage(const ResourceFirstAccess &access) const;
@@ -1114,7 +1309,7 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     VkQueueFlags GetQueueFlags() const { return queue_flags_; }
 
     ResourceUsageTag NextSubcommandTag(CMD_TYPE command, ResourceUsageRecord::SubcommandType subcommand);
-    ResourceUsageTag GetTagLimit() const override { return access_log_.size(); }
+    ResourceUsageTag GetTagLimit() const override { return access_log_->size(); }
     VulkanTypedHandle Handle() const override {
         if (cb_state_) {
             return cb_state_->Handle();
@@ -1143,18 +1338,29 @@ class CommandBufferAccessContext : public CommandExecutionContext {
         SyncOpPointer sync_op(std::make_shared<T>(std::forward<Args>(args)...));
         RecordSyncOp(std::move(sync_op));  // Call the non-template version
     }
-    const AccessLog &GetAccessLog() const { return access_log_; }
+    const AccessLog &GetAccessLog() const { return *access_log_; }
+    std::shared_ptr<const AccessLog> GetAccessLogShared() const { return access_log_; }
+    std::shared_ptr<const CommandBufferSet> GetCBReferencesShared() const { return cbs_referenced_; }
+    const std::vector<SyncOpEntry> &GetSyncOps() const { return sync_ops_; }
     void InsertRecordedAccessLogEntries(const CommandBufferAccessContext &cb_context) override;
 
   private:
+    template <typename T>
+    static void ResetShared(std::shared_ptr<T> *shared) {
+        if (shared->use_count() == 1) {
+            (*shared)->clear();
+        } else {
+            *shared = std::make_shared<T>();
+        }
+    }
     // As this is passing around a shared pointer to record, move to avoid needless atomics.
     void RecordSyncOp(SyncOpPointer &&sync_op);
     std::shared_ptr<CMD_BUFFER_STATE> cb_state_;
     VkQueueFlags queue_flags_;
     bool destroyed_;
 
-    AccessLog access_log_;
-    layer_data::unordered_set<std::shared_ptr<const CMD_BUFFER_STATE>> cbs_referenced_;
+    std::shared_ptr<AccessLog> access_log_;
+    std::shared_ptr<CommandBufferSet> cbs_referenced_;
     uint32_t command_number_;
     uint32_t subcommand_number_;
     uint32_t reset_count_;
@@ -1169,12 +1375,139 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     std::vector<SyncOpEntry> sync_ops_;
 };
 
+// The access log of a command buffer as submitted to a queue. The log is shared with the command buffer context (which replaces
+// rather than clears it on reset while shared), so submission doesn't copy it.
+struct SubmittedAccessLog {
+    uint64_t submit_index;
+    uint32_t batch_index;
+    std::shared_ptr<const CMD_BUFFER_STATE> cb_state;
+    std::shared_ptr<const CommandExecutionContext::AccessLog> log;
+    std::shared_ptr<const CommandBufferAccessContext::CommandBufferSet> cbs_referenced;  // Keeps the secondaries in log alive
+    SubmittedAccessLog(uint64_t submit_index_, uint32_t batch_index_, const CommandBufferAccessContext &cb_context)
+        : submit_index(submit_index_),
+          batch_index(batch_index_),
+          cb_state(cb_context.GetCBStateShared()),
+          log(cb_context.GetAccessLogShared()),
+          cbs_referenced(cb_context.GetCBReferencesShared()) {}
+};
+
+// The queue operations of one batch (VkSubmitInfo or VkSubmitInfo2) of a queue submission
+struct SyncSubmitBatch {
+    struct SemaphoreInfo {
+        VkSemaphore semaphore;
+        VkPipelineStageFlags2KHR stage_mask;
+        SemaphoreInfo(VkSemaphore semaphore_, VkPipelineStageFlags2KHR stage_mask_)
+            : semaphore(semaphore_), stage_mask(stage_mask_) {}
+    };
+    std::vector<SemaphoreInfo> wait_semaphores;
+    std::vector<VkCommandBuffer> command_buffers;
+    std::vector<SemaphoreInfo> signal_semaphores;
+
+    SyncSubmitBatch(const VkSubmitInfo &submit);
+    SyncSubmitBatch(const VkSubmitInfo2KHR &submit);
+};
+
+// Access state of a queue captured by a semaphore signal, imported with the semaphore's memory dependency on wait
+struct SignaledSemaphore {
+    VkQueue queue;
+    SyncExecScope exec_scope;  // The first synchronization scope
+    ResourceUsageTag tag;      // The tag limit of the queue at signal, accesses before it are in the first scope
+    std::shared_ptr<AccessContext> access_context;
+    layer_data::unordered_map<VkQueue, ResourceUsageTag> sync_points;
+};
+
+// Queue execution context holding the accumulated access state of the work submitted to a queue.  Submitted command buffers are
+// validated by detecting hazards for their first accesses (ResourceFirstAccess) against this state and recorded by resolving
+// their access contexts into it, so the cost of a submission scales with the address ranges it touches, not with the commands
+// recorded. Tags are allocated from a device wide counter, keeping accesses imported from other queues ordered.
+class QueueSyncState : public CommandExecutionContext {
+  public:
+    using SyncPoints = layer_data::unordered_map<VkQueue, ResourceUsageTag>;
+    using SubmittedAccessLogMap = std::map<ResourceUsageTag, SubmittedAccessLog>;  // By the first tag of each log
+
+    QueueSyncState(const SyncValidator &sync_state, VkQueue queue, VkQueueFlags queue_flags)
+        : CommandExecutionContext(&sync_state),
+          queue_(queue),
+          queue_flags_(queue_flags),
+          tag_limit_(0),
+          submit_index_(0),
+          batch_index_(0),
+          access_context_(),
+          events_context_(),
+          sync_points_(),
+          access_log_() {}
+
+    // The proxy has only the submitted log entries and the address ranges imported with ImportAccessRanges
+    struct AsProxyContext {};
+    QueueSyncState(const QueueSyncState &real_context, AsProxyContext dummy);
+
+    AccessContext *GetCurrentAccessContext() override { return &access_context_; }
+    SyncEventsContext *GetCurrentEventsContext() override { return &events_context_; }
+    const AccessContext *GetCurrentAccessContext() const override { return &access_context_; }
+    const SyncEventsContext *GetCurrentEventsContext() const override { return &events_context_; }
+    ResourceUsageTag GetTagLimit() const override { return tag_limit_; }
+    VulkanTypedHandle Handle() const override { return VulkanTypedHandle(queue_, kVulkanObjectTypeQueue); }
+    std::string FormatUsage(ResourceUsageTag tag) const override;
+    void InsertRecordedAccessLogEntries(const CommandBufferAccessContext &cb_context) override;
+
+    VkQueue GetQueue() const { return queue_; }
+    VkQueueFlags GetQueueFlags() const { return queue_flags_; }
+    const SyncPoints &GetSyncPoints() const { return sync_points_; }
+    ResourceUsageTag GetSyncPoint(VkQueue queue) const;
+    const SubmittedAccessLog *GetSubmittedAccessLog(ResourceUsageTag tag, ResourceUsageTag *base_tag) const;
+    bool IsSubmittedTag(ResourceUsageTag tag) const { return GetSubmittedAccessLog(tag, nullptr) != nullptr; }
+
+    void BeginSubmit(ResourceUsageTag tag_base);
+    void BeginBatch(uint32_t batch_index) { batch_index_ = batch_index; }
+    void ImportAccessRanges(const AccessContext &from, const AccessContext &ranges_of);
+    void ImportSignaledSemaphore(const SignaledSemaphore &signal, VkPipelineStageFlags2KHR wait_mask,
+                                 const AccessContext *ranges_of);
+    void RecordSubmittedCommandBuffer(const CommandBufferAccessContext &recorded_context);
+    SignaledSemaphore Signal(VkPipelineStageFlags2KHR signal_mask) const;
+    void TrimAccessLog(ResourceUsageTag tag);
+
+  private:
+    VkQueue queue_;
+    VkQueueFlags queue_flags_;
+    ResourceUsageTag tag_limit_;
+    uint64_t submit_index_;
+    uint32_t batch_index_;
+    AccessContext access_context_;
+    SyncEventsContext events_context_;
+    // For each other queue, the tag limit of that queue known to happen-before work submitted to this one
+    SyncPoints sync_points_;
+    // Logs of the command buffers submitted to this queue, other queues' tags are looked up through the SyncValidator
+    SubmittedAccessLogMap access_log_;
+};
+
 class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
   public:
     using StateTracker = ValidationStateTracker;
     SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
 
     layer_data::unordered_map<VkCommandBuffer, std::shared_ptr<CommandBufferAccessContext>> cb_access_state;
+    // Contexts of freed command buffers by command pool, at most kMaxRetiredContextsPerPool each. Their log and sync op storage
+    // survives Reset, so reusing them for the pool's later allocations keeps command buffer churn off the heap.
+    static constexpr size_t kMaxRetiredContextsPerPool = 8;
+    layer_data::unordered_map<VkCommandPool, std::vector<std::shared_ptr<CommandBufferAccessContext>>> retired_cb_access_state;
+    // Only created if validation_worker_threads is set, see AccessContext::ResolveChildContexts()
+    std::unique_ptr<ValidationThreadPool> resolve_thread_pool;
+
+    // Queue submission state: per queue access state, the queue state captured by pending semaphore signals, and the tag
+    // limit each fence's submission will complete. Tags come from queue_tag_limit, which all queues share.
+    layer_data::unordered_map<VkQueue, std::shared_ptr<QueueSyncState>> queue_sync_states;
+    layer_data::unordered_map<VkSemaphore, SignaledSemaphore> signaled_semaphores;
+    layer_data::unordered_map<VkFence, std::pair<VkQueue, ResourceUsageTag>> waitable_fences;
+    ResourceUsageTag queue_tag_limit = 0;
+
+    QueueSyncState *GetQueueSyncState(VkQueue queue);
+    const QueueSyncState *GetQueueSyncState(VkQueue queue) const;
+    VkQueueFlags GetQueueFlags(VkQueue queue) const;
+    std::string FormatSubmittedUsage(ResourceUsageTag tag) const;
+    void ApplyQueueWait(VkQueue queue, ResourceUsageTag tag);
+    void ApplyFenceWait(VkFence fence);
+    bool ValidateQueueSubmit(VkQueue queue, const std::vector<SyncSubmitBatch> &batches, const char *func_name) const;
+    void RecordQueueSubmit(VkQueue queue, const std::vector<SyncSubmitBatch> &batches, VkFence fence);
 
     std::shared_ptr<CommandBufferAccessContext> AccessContextFactory(VkCommandBuffer command_buffer);
 
@@ -1258,6 +1591,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
                                           VkResult result) override;
+    void PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                         const VkAllocationCallbacks *pAllocator) override;
 
     void PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                           VkSubpassContents contents) override;
@@ -1539,4 +1874,24 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                            const VkCommandBuffer *pCommandBuffers) const override;
     void PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                          const VkCommandBuffer *pCommandBuffers) override;
+
+    bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                    VkFence fence) const override;
+    void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                   VkResult result) override;
+    bool PreCallValidateQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                        VkFence fence) const override;
+    void PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
+                                       VkResult result) override;
+    bool PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                     VkFence fence) const override;
+    void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
+                                    VkResult result) override;
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result) override;
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
+    void PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) override;
+    void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) override;
 };
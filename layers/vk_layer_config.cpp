@@ -25,6 +25,7 @@
 #include "vk_layer_config.h"
 
 #include <string.h>
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -106,6 +107,51 @@ string GetEnvironment(const char *variable) {
 #endif
 }
 
+string GetCacheFilePath(const char *name) {
+    auto cache_dir = GetEnvironment("XDG_CACHE_HOME");
+    if (!cache_dir.size()) {
+        auto home_cache_dir = GetEnvironment("HOME") + "/.cache";
+        struct stat info;
+        if (stat(home_cache_dir.c_str(), &info) == 0) {
+            if ((info.st_mode & S_IFMT) == S_IFDIR) {
+                cache_dir = home_cache_dir;
+            }
+        }
+    }
+    if (!cache_dir.size()) cache_dir = GetEnvironment("TMPDIR");
+    if (!cache_dir.size()) cache_dir = GetEnvironment("TMP");
+    if (!cache_dir.size()) cache_dir = GetEnvironment("TEMP");
+    if (!cache_dir.size()) cache_dir = "/tmp";
+    string path = cache_dir + "/" + name;
+#if defined(__linux__) || defined(__FreeBSD__)
+    path += "-" + std::to_string(getuid());
+#endif
+    return path + ".bin";
+}
+
+bool ReplaceCacheFile(const string &path, const void *data, size_t size) {
+    static std::atomic<uint32_t> temp_file_count{0};
+#if defined(_WIN32)
+    const auto process_id = static_cast<uint64_t>(GetCurrentProcessId());
+#else
+    const auto process_id = static_cast<uint64_t>(getpid());
+#endif
+    const string temp_path = path + "." + std::to_string(process_id) + "-" + std::to_string(temp_file_count++) + ".tmp";
+    FILE *write_file = fopen(temp_path.c_str(), "wb");
+    if (!write_file) return false;
+    bool written = (size == 0) || (fwrite(data, 1, size, write_file) == size);
+    written = (fclose(write_file) == 0) && written;
+#if !defined(__linux__) && !defined(__FreeBSD__)
+    // rename() does not replace an existing file everywhere
+    if (written) remove(path.c_str());
+#endif
+    if (!written || rename(temp_path.c_str(), path.c_str()) != 0) {
+        remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
 VK_LAYER_EXPORT const char *getLayerOption(const char *option) { return layer_config.GetOption(option); }
 VK_LAYER_EXPORT const char *GetLayerEnvVar(const char *option) {
     layer_config.vk_layer_disables_env_var = GetEnvironment(option);
@@ -34,6 +34,11 @@
 #endif
 
 std::string GetEnvironment(const char *variable);
+// Returns the path of the per-user cache file called name, in the user's cache directory or a temporary directory
+std::string GetCacheFilePath(const char *name);
+// Writes size bytes of data to a temporary file unique to this process and call, then renames it over path, so that
+// readers (including mappings of the old file) and other processes saving the same cache never see a partial file.
+bool ReplaceCacheFile(const std::string &path, const void *data, size_t size);
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,15 +23,20 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <map>
 #include <unordered_map>
 #include <set>
+#include <thread>
 #include <algorithm>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #ifdef USE_ROBIN_HOOD_HASHING
 #include "robin_hood.h"
@@ -676,23 +681,222 @@ class small_unordered_map
 template <typename Key, int N = 1>
 class small_unordered_set : public small_container<Key, Key, layer_data::unordered_set<Key>, value_type_helper_set<Key>, N> {};
 
-// For the given data key, look up the layer_data instance from given layer_data_map
+// Thread-safe map from dispatch key to the per-instance or per-device layer data, which is looked up on every API call.
+//
+// Lookups are lock-free: the table is an open-addressed array published with a release store, and slots are filled
+// value-first, key-last, so a reader that sees a key also sees its value. Insertion and removal (instance and device
+// creation and destruction) are serialized by a mutex. Removed slots become tombstones. Once half the slots are used,
+// tombstones are cleared by rebuilding the table in place, under a sequence count that makes concurrent readers retry,
+// so repeatedly creating and destroying devices needs no new memory. A new table is only allocated when the live entries
+// outgrow the current one. Readers may still be probing a superseded table, so those are kept until the map is
+// destroyed; since tables grow geometrically, that costs at most the size of the live table.
 template <typename DATA_T>
-DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
-    /* TODO: We probably should lock here, or have caller lock */
-    DATA_T *&got = layer_data_map[data_key];
+class dispatch_key_map {
+  public:
+    dispatch_key_map() { table_.store(NewTable(kMinCapacity), std::memory_order_relaxed); }
+    dispatch_key_map(const dispatch_key_map &) = delete;
+    dispatch_key_map &operator=(const dispatch_key_map &) = delete;
+
+    DATA_T *find(void *key) const {
+        for (;;) {
+            const Table *table = table_.load(std::memory_order_acquire);
+            const uint32_t sequence = table->sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) == 0) {
+                DATA_T *data = Probe(table, key);
+                // The slots must be read before the sequence is checked again
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (table->sequence.load(std::memory_order_relaxed) == sequence) {
+                    return data;
+                }
+            }
+            std::this_thread::yield();  // The table is being rebuilt
+        }
+    }
+
+    // Returns the data for key, default constructing it if key isn't present yet
+    DATA_T *get_or_create(void *key) {
+        DATA_T *data = find(key);
+        if (data) {
+            return data;
+        }
+        std::lock_guard<std::mutex> lock(write_lock_);
+        data = find(key);
+        if (!data) {
+            data = new DATA_T;
+            Insert(key, data);
+        }
+        return data;
+    }
+
+    // Removes key and deletes its data
+    void erase_and_delete(void *key) {
+        DATA_T *data = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(write_lock_);
+            Table *table = table_.load(std::memory_order_relaxed);
+            for (size_t i = Hash(key) & table->mask;; i = (i + 1) & table->mask) {
+                Slot &slot = table->slots[i];
+                const void *slot_key = slot.key.load(std::memory_order_relaxed);
+                if (slot_key == key) {
+                    data = slot.value.load(std::memory_order_relaxed);
+                    slot.value.store(nullptr, std::memory_order_relaxed);
+                    slot.key.store(Tombstone(), std::memory_order_release);
+                    --live_count_;
+                    break;
+                }
+                if (slot_key == nullptr) {
+                    break;
+                }
+            }
+        }
+        assert(data);
+        delete data;
+    }
+
+    // Returns the (key, data) pairs present at the time of the call
+    std::vector<std::pair<void *, DATA_T *>> snapshot() const {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        std::vector<std::pair<void *, DATA_T *>> ret;
+        const Table *table = table_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i <= table->mask; ++i) {
+            void *slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            DATA_T *data = table->slots[i].value.load(std::memory_order_relaxed);
+            if (slot_key != nullptr && slot_key != Tombstone() && data != nullptr) {
+                ret.emplace_back(slot_key, data);
+            }
+        }
+        return ret;
+    }
+
+  private:
+    static const size_t kMinCapacity = 16;
+
+    struct Slot {
+        std::atomic<void *> key{nullptr};
+        std::atomic<DATA_T *> value{nullptr};
+    };
+    struct Table {
+        size_t mask;
+        size_t used_count;  // live entries plus tombstones, only accessed with write_lock_ held
+        std::atomic<uint32_t> sequence{0};  // odd while the table is being rebuilt in place
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    static void *Tombstone() { return reinterpret_cast<void *>(static_cast<uintptr_t>(1)); }
+
+    static size_t Hash(const void *key) {
+        // Dispatch keys are heap pointers, so the low bits carry little information
+        uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    // Returns the data for key in table. The probe is bounded, since a table being rebuilt may have no empty slot
+    // for a moment; the caller discards the result in that case.
+    static DATA_T *Probe(const Table *table, const void *key) {
+        size_t i = Hash(key) & table->mask;
+        for (size_t probes = 0; probes <= table->mask; ++probes, i = (i + 1) & table->mask) {
+            const void *slot_key = table->slots[i].key.load(std::memory_order_acquire);
+            if (slot_key == key) {
+                return table->slots[i].value.load(std::memory_order_acquire);
+            }
+            if (slot_key == nullptr) {
+                break;
+            }
+        }
+        return nullptr;
+    }
 
-    if (got == nullptr) {
-        got = new DATA_T;
+    // Called with write_lock_ held
+    Table *NewTable(size_t capacity) {
+        Table *table = new Table;
+        table->mask = capacity - 1;
+        table->used_count = 0;
+        table->slots.reset(new Slot[capacity]);
+        tables_.emplace_back(table);
+        return table;
     }
 
-    return got;
+    static void Place(Table *table, void *key, DATA_T *data) {
+        for (size_t i = Hash(key) & table->mask;; i = (i + 1) & table->mask) {
+            Slot &slot = table->slots[i];
+            if (slot.key.load(std::memory_order_relaxed) == nullptr) {
+                slot.value.store(data, std::memory_order_relaxed);
+                slot.key.store(key, std::memory_order_release);
+                ++table->used_count;
+                return;
+            }
+        }
+    }
+
+    // Called with write_lock_ held. Clears the tombstones of the current table without allocating.
+    static void RebuildInPlace(Table *table) {
+        std::vector<std::pair<void *, DATA_T *>> live;
+        for (size_t i = 0; i <= table->mask; ++i) {
+            void *slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key != nullptr && slot_key != Tombstone()) {
+                live.emplace_back(slot_key, table->slots[i].value.load(std::memory_order_relaxed));
+            }
+        }
+        const uint32_t sequence = table->sequence.load(std::memory_order_relaxed);
+        table->sequence.store(sequence + 1, std::memory_order_relaxed);
+        // Readers that see any of the slot stores below must also see the odd sequence
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i <= table->mask; ++i) {
+            table->slots[i].key.store(nullptr, std::memory_order_relaxed);
+            table->slots[i].value.store(nullptr, std::memory_order_relaxed);
+        }
+        table->used_count = 0;
+        for (const auto &entry : live) {
+            Place(table, entry.first, entry.second);
+        }
+        table->sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Called with write_lock_ held
+    void Insert(void *key, DATA_T *data) {
+        Table *table = table_.load(std::memory_order_relaxed);
+        if ((table->used_count + 1) * 2 > table->mask + 1) {
+            size_t capacity = kMinCapacity;
+            while (capacity < (live_count_ + 1) * 4) {
+                capacity *= 2;
+            }
+            if (capacity <= table->mask + 1) {
+                // Only tombstones are in the way
+                RebuildInPlace(table);
+            } else {
+                Table *new_table = NewTable(capacity);
+                for (size_t i = 0; i <= table->mask; ++i) {
+                    void *slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+                    if (slot_key != nullptr && slot_key != Tombstone()) {
+                        Place(new_table, slot_key, table->slots[i].value.load(std::memory_order_relaxed));
+                    }
+                }
+                table_.store(new_table, std::memory_order_release);
+                table = new_table;
+            }
+        }
+        Place(table, key, data);
+        ++live_count_;
+    }
+
+    std::atomic<Table *> table_;
+    mutable std::mutex write_lock_;
+    size_t live_count_ = 0;
+    std::vector<std::unique_ptr<Table>> tables_;
+};
+
+// For the given data key, look up the layer_data instance from given layer_data_map
+template <typename DATA_T>
+DATA_T *GetLayerDataPtr(void *data_key, dispatch_key_map<DATA_T> &layer_data_map) {
+    return layer_data_map.get_or_create(data_key);
 }
 
 template <typename DATA_T>
-void FreeLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
-    delete layer_data_map[data_key];
-    layer_data_map.erase(data_key);
+void FreeLayerDataPtr(void *data_key, dispatch_key_map<DATA_T> &layer_data_map) {
+    layer_data_map.erase_and_delete(data_key);
 }
 
 // For the given data key, look up the layer_data instance from given layer_data_map
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <array>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -659,6 +660,34 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 }
 #endif
 
+// Messages logged on a thread while a LogCaptureScope is active on it are counted in a CapturedLogMessages instead of
+// being reported. This lets validation that is split across worker threads find out which pieces have something to
+// report without reporting anything itself; those pieces are then validated again serially, uncaptured, so that the
+// reported messages, duplicate message counting and Log*() return values are exactly those of a serial run.
+struct CapturedLogMessages {
+    uint32_t count = 0;
+};
+
+// Not static, so that all translation units share the per-thread capture
+inline CapturedLogMessages *&CurrentLogCapture() {
+    static thread_local CapturedLogMessages *capture = nullptr;
+    return capture;
+}
+
+// A null destination reports messages normally for the duration of the scope, even inside an enclosing capture
+class LogCaptureScope {
+  public:
+    explicit LogCaptureScope(CapturedLogMessages *destination) : previous_(CurrentLogCapture()) {
+        CurrentLogCapture() = destination;
+    }
+    ~LogCaptureScope() { CurrentLogCapture() = previous_; }
+    LogCaptureScope(const LogCaptureScope &) = delete;
+    LogCaptureScope &operator=(const LogCaptureScope &) = delete;
+
+  private:
+    CapturedLogMessages *previous_;
+};
+
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
 static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std::string &vuid_text,
@@ -672,6 +701,11 @@ static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std:
         != debug_data->filter_message_ids.end()) {
         return false;
     }
+    // Captured messages are only counted, they are reported (and counted against the limit) by the serial re-run
+    if (auto *capture = CurrentLogCapture()) {
+        ++capture->count;
+        return false;
+    }
     if ((debug_data->duplicate_message_limit > 0) && UpdateLogMsgCounts(debug_data, static_cast<int32_t>(message_id))) {
         // Count for this particular message is over the limit, ignore it
         return false;
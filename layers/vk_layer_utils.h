@@ -21,11 +21,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <stdbool.h>
 #include <string>
+#include <thread>
 #include <vector>
 #include <iomanip>
 #include "cast_utils.h"
@@ -407,6 +415,48 @@ class LockedSharedPtr : public std::shared_ptr<T> {
     Guard guard_;
 };
 
+// Non-owning counterpart of LockedSharedPtr, used for state objects borrowed under an EpochGuard (see
+// vl_concurrent_read_mostly_map::find_borrowed()). Neither the pointer nor the lock may outlive that EpochGuard.
+template <typename T, typename Guard>
+class LockedBorrowedPtr {
+  public:
+    LockedBorrowedPtr(T *ptr, Guard &&guard) : ptr_(ptr), guard_(std::move(guard)) {}
+    LockedBorrowedPtr() : ptr_(nullptr), guard_() {}
+
+    T *get() const { return ptr_; }
+    T &operator*() const { return *ptr_; }
+    T *operator->() const { return ptr_; }
+    explicit operator bool() const { return ptr_ != nullptr; }
+
+  private:
+    T *ptr_;
+    Guard guard_;
+};
+
+// Type returned by find() and end() of the concurrent maps below.
+template <typename T>
+class ConcurrentMapFindResult {
+  public:
+    ConcurrentMapFindResult(bool a, T b) : result(a, std::move(b)) {}
+
+    // == and != only support comparing against end()
+    bool operator==(const ConcurrentMapFindResult &other) const {
+        if (result.first == false && other.result.first == false) {
+            return true;
+        }
+        return false;
+    }
+    bool operator!=(const ConcurrentMapFindResult &other) const { return !(*this == other); }
+
+    // Make -> act kind of like an iterator.
+    std::pair<bool, T> *operator->() { return &result; }
+    const std::pair<bool, T> *operator->() const { return &result; }
+
+  private:
+    // (found, reference to element)
+    std::pair<bool, T> result;
+};
+
 // Limited concurrent_unordered_map that supports internally-synchronized
 // insert/erase/access. Splits locking across N buckets and uses shared_mutex
 // for read/write locking. Iterators are not supported. The following
@@ -463,27 +513,7 @@ class vl_concurrent_unordered_map {
     }
 
     // type returned by find() and end().
-    class FindResult {
-      public:
-        FindResult(bool a, T b) : result(a, std::move(b)) {}
-
-        // == and != only support comparing against end()
-        bool operator==(const FindResult &other) const {
-            if (result.first == false && other.result.first == false) {
-                return true;
-            }
-            return false;
-        }
-        bool operator!=(const FindResult &other) const { return !(*this == other); }
-
-        // Make -> act kind of like an iterator.
-        std::pair<bool, T> *operator->() { return &result; }
-        const std::pair<bool, T> *operator->() const { return &result; }
-
-      private:
-        // (found, reference to element)
-        std::pair<bool, T> result;
-    };
+    using FindResult = ConcurrentMapFindResult<T>;
 
     // find()/end() return a FindResult containing a copy of the value. For end(),
     // return a default value.
@@ -576,4 +606,786 @@ class vl_concurrent_unordered_map {
         return hash;
     }
 };
+
+// Epoch based reclamation for containers that allow lock-free readers.
+//
+// Readers bracket their accesses with an EpochGuard, which announces the global epoch in a per-thread record.
+// Writers unlink objects and hand them to an EpochRetireList owned by the container. Retiring an object advances the
+// global epoch; every reader that announces the new epoch or a later one entered after the object was unlinked and
+// can't see it. The object is destroyed right away, on the retiring thread, if no reader older than that is active,
+// which is the common case since read-side critical sections are short. Otherwise it is parked in the retire list
+// until a later write to the same container finds the old readers gone, or until the container is destroyed.
+// Readers never write to shared cache lines; the only cost is a store and a fence on their own record.
+class EpochDomain {
+  public:
+    static EpochDomain &Instance() {
+        // Intentionally leaked, so that thread exit and static destruction order never race with it.
+        static EpochDomain *domain = new EpochDomain;
+        return *domain;
+    }
+
+    void Enter() {
+        ThreadRecord *record = LocalRecord();
+        if (record->nesting++ == 0) {
+            record->epoch.store(global_epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            // The announcement must be visible before any pointer in the protected structure is read.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    void Exit() {
+        ThreadRecord *record = LocalRecord();
+        assert(record->nesting > 0);
+        if (--record->nesting == 0) {
+            record->epoch.store(kQuiescent, std::memory_order_release);
+        }
+    }
+
+    // Called after an object has been made unreachable from the protected structure. Returns the epoch a reader must
+    // have announced to be unable to see it.
+    uint64_t Advance() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return global_epoch_.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Returns the oldest epoch announced by an active reader, or UINT64_MAX if there is none. Objects retired at or
+    // before this epoch can be destroyed.
+    uint64_t OldestActive() const {
+        uint64_t oldest = UINT64_MAX;
+        for (const ThreadRecord *record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            const uint64_t announced = record->epoch.load(std::memory_order_acquire);
+            if (announced != kQuiescent && announced < oldest) {
+                oldest = announced;
+            }
+        }
+        return oldest;
+    }
+
+  private:
+    static const uint64_t kQuiescent = 0;
+    static const size_t kCacheLine = 64;
+
+    // Each record is on its own cache line so announcing an epoch does not invalidate other readers.
+    struct alignas(kCacheLine) ThreadRecord {
+        std::atomic<uint64_t> epoch{kQuiescent};
+        std::atomic<bool> in_use{true};
+        ThreadRecord *next = nullptr;
+        // Only accessed by the owning thread, allows EpochGuards to nest.
+        uint32_t nesting = 0;
+    };
+
+    // Releases the thread record for reuse when its thread exits.
+    struct ThreadRecordHolder {
+        ThreadRecord *record;
+        ThreadRecordHolder() : record(Instance().AcquireRecord()) {}
+        ~ThreadRecordHolder() {
+            record->nesting = 0;
+            record->epoch.store(kQuiescent, std::memory_order_release);
+            record->in_use.store(false, std::memory_order_release);
+        }
+    };
+
+    EpochDomain() = default;
+
+    static ThreadRecord *LocalRecord() {
+        static thread_local ThreadRecordHolder holder;
+        return holder.record;
+    }
+
+    ThreadRecord *AcquireRecord() {
+        for (ThreadRecord *record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            bool expected = false;
+            if (!record->in_use.load(std::memory_order_relaxed) &&
+                record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return record;
+            }
+        }
+        // Records are never freed, there is at most one per concurrently live thread. operator new only guarantees
+        // alignof(std::max_align_t) before C++17, so align the record by hand.
+        void *storage = ::operator new(sizeof(ThreadRecord) + kCacheLine - 1);
+        const uintptr_t aligned = (reinterpret_cast<uintptr_t>(storage) + kCacheLine - 1) & ~uintptr_t(kCacheLine - 1);
+        ThreadRecord *record = new (reinterpret_cast<void *>(aligned)) ThreadRecord;
+        ThreadRecord *head = records_.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!records_.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        return record;
+    }
+
+    std::atomic<uint64_t> global_epoch_{1};
+    std::atomic<ThreadRecord *> records_{nullptr};
+};
+
+// RAII read-side critical section for EpochDomain
+class EpochGuard {
+  public:
+    EpochGuard() { EpochDomain::Instance().Enter(); }
+    ~EpochGuard() { EpochDomain::Instance().Exit(); }
+    EpochGuard(const EpochGuard &) = delete;
+    EpochGuard &operator=(const EpochGuard &) = delete;
+};
+
+// Objects retired by one container. Destruction happens on the thread retiring the object, on a thread retiring a
+// later object from the same container, or when the container (and therefore this list) is destroyed; never during
+// an unrelated container's writes, so state objects are never torn down after their device.
+class EpochRetireList {
+  public:
+    typedef void (*Deleter)(void *);
+
+    EpochRetireList() = default;
+    EpochRetireList(const EpochRetireList &) = delete;
+    EpochRetireList &operator=(const EpochRetireList &) = delete;
+    // The owner guarantees that no reader is left when it is destroyed.
+    ~EpochRetireList() {
+        for (auto &retired : retired_) {
+            retired.deleter(retired.object);
+        }
+    }
+
+    // Destroy object with deleter once no reader can still hold a reference to it. Must be called after the object
+    // has been made unreachable from the protected structure, and without any lock the deleter may need.
+    void Retire(void *object, Deleter deleter) {
+        EpochDomain &domain = EpochDomain::Instance();
+        const uint64_t epoch = domain.Advance();
+        const uint64_t oldest = domain.OldestActive();
+        std::vector<RetiredObject> reclaimable;
+        if (epoch <= oldest) {
+            reclaimable.push_back({epoch, object, deleter});
+        }
+        if (epoch > oldest || pending_.load(std::memory_order_relaxed) != 0) {
+            std::lock_guard<std::mutex> lock(lock_);
+            if (epoch > oldest) {
+                retired_.push_back({epoch, object, deleter});
+            }
+            // Epochs are taken before the lock, so the list is only approximately sorted; stopping at the first entry
+            // that can't be reclaimed yet is conservative.
+            while (!retired_.empty() && retired_.front().epoch <= oldest) {
+                reclaimable.push_back(retired_.front());
+                retired_.pop_front();
+            }
+            pending_.store(retired_.size(), std::memory_order_relaxed);
+        }
+        // Deleters may recursively retire objects (e.g. a state object holding other containers), so they must run
+        // without lock_ held.
+        for (auto &retired : reclaimable) {
+            retired.deleter(retired.object);
+        }
+    }
+
+  private:
+    struct RetiredObject {
+        uint64_t epoch;
+        void *object;
+        Deleter deleter;
+    };
+
+    std::mutex lock_;
+    std::deque<RetiredObject> retired_;
+    std::atomic<size_t> pending_{0};
+};
+
+// Read-mostly variant of vl_concurrent_unordered_map with the same interface.
+//
+// find/contains/snapshot/size never take a lock: the table is an array of singly linked bucket chains whose nodes are
+// immutable once published. Writers lock one of 2^LOCKSLOG2 stripes (selected by hash, so a bucket always maps to the
+// same stripe), build new nodes and publish them with release stores. Replaced and erased nodes, as well as the old
+// table when the table grows, are handed to the map's EpochRetireList once the stripe lock is released. Their values
+// are therefore normally destroyed by the writer that removed them, and at the latest when the map is destroyed.
+//
+// Because values are immutable once published, insert_or_assign allocates a replacement node rather than updating
+// the value in place, and growing the table copies every value once.
+template <typename Key, typename T, int LOCKSLOG2 = 2, typename Hash = layer_data::hash<Key>>
+class vl_concurrent_read_mostly_map {
+  public:
+    // type returned by find() and end().
+    using FindResult = ConcurrentMapFindResult<T>;
+
+    vl_concurrent_read_mostly_map() : table_(Table::Create(kMinBuckets)) {}
+    ~vl_concurrent_read_mostly_map() { Table::DestroyWithNodes(table_.load(std::memory_order_relaxed)); }
+    vl_concurrent_read_mostly_map(const vl_concurrent_read_mostly_map &) = delete;
+    vl_concurrent_read_mostly_map &operator=(const vl_concurrent_read_mostly_map &) = delete;
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        const size_t hash = HashKey(key);
+        Node *replaced = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(Stripe(hash));
+            Table *table = table_.load(std::memory_order_relaxed);
+            std::atomic<Node *> *link = nullptr;
+            Node *node = FindLocked(table, key, hash, link);
+            Node *new_node = new Node(key, hash, T{std::forward<Args>(args)...});
+            if (node) {
+                new_node->next.store(node->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                link->store(new_node, std::memory_order_release);
+                replaced = node;
+            } else {
+                Link(table, new_node);
+                count_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (replaced) {
+            Retire(replaced);
+        } else {
+            GrowIfNeeded();
+        }
+    }
+
+    template <typename... Args>
+    bool insert(const Key &key, Args &&...args) {
+        const size_t hash = HashKey(key);
+        {
+            std::lock_guard<std::mutex> lock(Stripe(hash));
+            Table *table = table_.load(std::memory_order_relaxed);
+            std::atomic<Node *> *link = nullptr;
+            if (FindLocked(table, key, hash, link)) {
+                return false;
+            }
+            Link(table, new Node(key, hash, T(std::forward<Args>(args)...)));
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        GrowIfNeeded();
+        return true;
+    }
+
+    // returns size_type
+    size_t erase(const Key &key) {
+        Node *node = Unlink(key);
+        if (!node) {
+            return 0;
+        }
+        Retire(node);
+        return 1;
+    }
+
+    bool contains(const Key &key) const {
+        EpochGuard guard;
+        return FindNode(key) != nullptr;
+    }
+
+    // find()/end() return a FindResult containing a copy of the value. For end(),
+    // return a default value.
+    FindResult end() const { return FindResult(false, T()); }
+    FindResult cend() const { return end(); }
+
+    FindResult find(const Key &key) const {
+        EpochGuard guard;
+        const Node *node = FindNode(key);
+        if (node) {
+            return FindResult(true, node->value);
+        }
+        return end();
+    }
+
+    // Returns a pointer to the stored value, or nullptr if key isn't present. The value is neither copied nor locked,
+    // it stays valid (even if concurrently erased or replaced) until the guard passed in is destroyed.
+    const T *find_borrowed(const EpochGuard &, const Key &key) const {
+        const Node *node = FindNode(key);
+        return node ? &node->value : nullptr;
+    }
+
+    FindResult pop(const Key &key) {
+        Node *node = Unlink(key);
+        if (!node) {
+            return end();
+        }
+        // Unlinked nodes are only reachable by readers, which never modify them, so the value can be read here.
+        FindResult ret(true, node->value);
+        Retire(node);
+        return ret;
+    }
+
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
+        std::vector<std::pair<const Key, T>> ret;
+        EpochGuard guard;
+        const Table *table = table_.load(std::memory_order_acquire);
+        for (size_t b = 0; b < table->bucket_count; ++b) {
+            for (const Node *node = table->buckets[b].load(std::memory_order_acquire); node;
+                 node = node->next.load(std::memory_order_acquire)) {
+                if (!f || f(node->value)) {
+                    ret.emplace_back(node->key, node->value);
+                }
+            }
+        }
+        return ret;
+    }
+
+    void clear() {
+        Table *old_table;
+        {
+            AllStripesLock lock(*this);
+            old_table = table_.load(std::memory_order_relaxed);
+            table_.store(Table::Create(kMinBuckets), std::memory_order_release);
+            bucket_count_.store(kMinBuckets, std::memory_order_relaxed);
+            count_.store(0, std::memory_order_relaxed);
+        }
+        retired_.Retire(old_table, &Table::DestroyWithNodesErased);
+    }
+
+    size_t size() const { return count_.load(std::memory_order_relaxed); }
+
+    bool empty() const { return size() == 0; }
+
+  private:
+    static const int STRIPES = (1 << LOCKSLOG2);
+    static const size_t kMinBuckets = (STRIPES > 16) ? STRIPES : 16;
+    // Grow when the average chain is longer than this.
+    static const size_t kMaxLoadFactor = 2;
+
+    struct Node {
+        Node(const Key &k, size_t h, T &&v) : key(k), hash(h), value(std::move(v)), next(nullptr) {}
+        const Key key;
+        const size_t hash;
+        const T value;
+        std::atomic<Node *> next;
+    };
+
+    struct Table {
+        size_t bucket_count;
+        std::unique_ptr<std::atomic<Node *>[]> buckets;
+
+        static Table *Create(size_t bucket_count) {
+            Table *table = new Table;
+            table->bucket_count = bucket_count;
+            table->buckets.reset(new std::atomic<Node *>[bucket_count]);
+            for (size_t b = 0; b < bucket_count; ++b) {
+                table->buckets[b].store(nullptr, std::memory_order_relaxed);
+            }
+            return table;
+        }
+        static void DestroyWithNodes(Table *table) {
+            for (size_t b = 0; b < table->bucket_count; ++b) {
+                Node *node = table->buckets[b].load(std::memory_order_relaxed);
+                while (node) {
+                    Node *next = node->next.load(std::memory_order_relaxed);
+                    delete node;
+                    node = next;
+                }
+            }
+            delete table;
+        }
+        static void DestroyWithNodesErased(void *table) { DestroyWithNodes(static_cast<Table *>(table)); }
+    };
+
+    // Takes every stripe lock in a fixed order, needed whenever the table itself is replaced.
+    class AllStripesLock {
+      public:
+        explicit AllStripesLock(const vl_concurrent_read_mostly_map &map) : map_(map) {
+            for (int s = 0; s < STRIPES; ++s) map_.locks_[s].lock.lock();
+        }
+        ~AllStripesLock() {
+            for (int s = STRIPES - 1; s >= 0; --s) map_.locks_[s].lock.unlock();
+        }
+
+      private:
+        const vl_concurrent_read_mostly_map &map_;
+    };
+
+    static size_t HashKey(const Key &key) {
+        // Handles and pointers hash to themselves with most hashers, so mix the bits before masking.
+        uint64_t h = static_cast<uint64_t>(Hash()(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    std::mutex &Stripe(size_t hash) const { return locks_[hash & (STRIPES - 1)].lock; }
+
+    // Must be called inside an EpochGuard
+    const Node *FindNode(const Key &key) const {
+        const size_t hash = HashKey(key);
+        const Table *table = table_.load(std::memory_order_acquire);
+        for (const Node *node = table->buckets[hash & (table->bucket_count - 1)].load(std::memory_order_acquire); node;
+             node = node->next.load(std::memory_order_acquire)) {
+            if (node->hash == hash && node->key == key) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    // Must be called with the stripe for hash locked. On success, link is the atomic pointing at the node.
+    static Node *FindLocked(Table *table, const Key &key, size_t hash, std::atomic<Node *> *&link) {
+        link = &table->buckets[hash & (table->bucket_count - 1)];
+        for (Node *node = link->load(std::memory_order_relaxed); node; node = node->next.load(std::memory_order_relaxed)) {
+            if (node->hash == hash && node->key == key) {
+                return node;
+            }
+            link = &node->next;
+        }
+        return nullptr;
+    }
+
+    // Must be called with the stripe for node->hash locked.
+    static void Link(Table *table, Node *node) {
+        std::atomic<Node *> &head = table->buckets[node->hash & (table->bucket_count - 1)];
+        node->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        head.store(node, std::memory_order_release);
+    }
+
+    Node *Unlink(const Key &key) {
+        const size_t hash = HashKey(key);
+        std::lock_guard<std::mutex> lock(Stripe(hash));
+        std::atomic<Node *> *link = nullptr;
+        Node *node = FindLocked(table_.load(std::memory_order_relaxed), key, hash, link);
+        if (node) {
+            // Readers currently on node still see the rest of the chain through node->next, which is left intact.
+            link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+            count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return node;
+    }
+
+    static void DeleteNode(void *node) { delete static_cast<Node *>(node); }
+    void Retire(Node *node) { retired_.Retire(node, &DeleteNode); }
+
+    void GrowIfNeeded() {
+        // bucket_count_ mirrors the current table's size, since the table itself may be retired by another writer.
+        if (count_.load(std::memory_order_relaxed) > bucket_count_.load(std::memory_order_relaxed) * kMaxLoadFactor) {
+            Grow();
+        }
+    }
+
+    void Grow() {
+        Table *old_table;
+        {
+            AllStripesLock lock(*this);
+            old_table = table_.load(std::memory_order_relaxed);
+            if (count_.load(std::memory_order_relaxed) <= old_table->bucket_count * kMaxLoadFactor) {
+                return;  // another writer already grew the table
+            }
+            // Nodes can't be relinked in place while readers may be walking the old chains, so copy them.
+            Table *new_table = Table::Create(old_table->bucket_count * 4);
+            for (size_t b = 0; b < old_table->bucket_count; ++b) {
+                for (Node *node = old_table->buckets[b].load(std::memory_order_relaxed); node;
+                     node = node->next.load(std::memory_order_relaxed)) {
+                    T value(node->value);
+                    Link(new_table, new Node(node->key, node->hash, std::move(value)));
+                }
+            }
+            table_.store(new_table, std::memory_order_release);
+            bucket_count_.store(new_table->bucket_count, std::memory_order_relaxed);
+        }
+        retired_.Retire(old_table, &Table::DestroyWithNodesErased);
+    }
+
+    std::atomic<Table *> table_;
+    std::atomic<size_t> bucket_count_{kMinBuckets};
+    std::atomic<size_t> count_{0};
+    struct {
+        mutable std::mutex lock;
+        // Put each lock on its own cache line to avoid false cache line sharing.
+        char padding[(-int(sizeof(std::mutex))) & 63];
+    } locks_[STRIPES];
+    EpochRetireList retired_;
+};
+
+// Map from wrapped handle IDs to driver handles, as used by handle wrapping.
+//
+// In the default (hashed) mode Wrap() hands out a new unique ID, premixed with Hash::hash(), and stores it in a
+// vl_concurrent_read_mostly_map. In slab mode the ID instead encodes the index of a record holding the driver handle,
+// with the low bit set as a tag, and the record's generation in the upper 32 bits. Unwrap() is then a bounds check, a
+// load of the slab from a fixed directory and two loads from the record, with no hashing, bucket walk or lock.
+// Records are carved out of fixed size slabs that are only freed with the map. A record's generation is odd while it
+// is in use, and both pop() and reuse by Wrap() bump it, so an ID that was already released, or that was never handed
+// out, unwraps to 0 just as in hashed mode. Released records are recycled in FIFO order and only once kMinFreeRecords
+// others are waiting, which keeps generations from wrapping around quickly.
+//
+// The mode can only be changed while nothing is wrapped.
+template <int LOCKSLOG2, typename Hash>
+class vl_wrapped_handle_map {
+  public:
+    // type returned by find() and end().
+    using FindResult = ConcurrentMapFindResult<uint64_t>;
+
+    vl_wrapped_handle_map() {
+        for (auto &slab : slabs_) {
+            slab.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~vl_wrapped_handle_map() {
+        for (auto &slab : slabs_) {
+            delete[] slab.load(std::memory_order_relaxed);
+        }
+    }
+    vl_wrapped_handle_map(const vl_wrapped_handle_map &) = delete;
+    vl_wrapped_handle_map &operator=(const vl_wrapped_handle_map &) = delete;
+
+    // Returns whether the requested mode is in effect, which is not the case if handles were already wrapped in the
+    // other mode.
+    bool set_slab_mode(bool enable) {
+        std::lock_guard<std::mutex> lock(slab_lock_);
+        if (slab_count_.load(std::memory_order_relaxed) == 0 && hashed_.empty()) {
+            slab_mode_.store(enable, std::memory_order_relaxed);
+        }
+        return slab_mode_.load(std::memory_order_relaxed) == enable;
+    }
+    bool slab_mode() const { return slab_mode_.load(std::memory_order_relaxed); }
+
+    // Returns a new ID for handle
+    uint64_t Wrap(uint64_t handle) {
+        if (!slab_mode()) {
+            const uint64_t unique_id = Hash::hash(next_id_++);
+            hashed_.insert_or_assign(unique_id, handle);
+            return unique_id;
+        }
+        std::lock_guard<std::mutex> lock(slab_lock_);
+        uint32_t index;
+        // Only dip below kMinFreeRecords once the directory is full
+        if (free_records_.size() > kMinFreeRecords || (slab_used_ == kSlabRecords && slab_total_ == kMaxSlabs)) {
+            if (free_records_.empty()) {
+                // More than kMaxSlabs * kSlabRecords live handles, which is far beyond what drivers support
+                assert(false);
+                return 0;
+            }
+            index = free_records_.front();
+            free_records_.pop_front();
+            slabs_[index / kSlabRecords].load(std::memory_order_relaxed)[index % kSlabRecords].generation.fetch_add(
+                1, std::memory_order_relaxed);
+        } else {
+            if (slab_used_ == kSlabRecords) {
+                slabs_[slab_total_].store(new Record[kSlabRecords], std::memory_order_release);
+                ++slab_total_;
+                slab_used_ = 0;
+            }
+            index = static_cast<uint32_t>((slab_total_ - 1) * kSlabRecords + slab_used_++);
+            records_allocated_.store(index + 1, std::memory_order_release);
+        }
+        Record &record = slabs_[index / kSlabRecords].load(std::memory_order_relaxed)[index % kSlabRecords];
+        record.handle.store(handle, std::memory_order_release);
+        slab_count_.fetch_add(1, std::memory_order_relaxed);
+        return (static_cast<uint64_t>(record.generation.load(std::memory_order_relaxed)) << 32) |
+               (static_cast<uint64_t>(index) << 1) | kTag;
+    }
+
+    // Returns the driver handle for id, or 0 if id isn't a wrapped handle
+    uint64_t Unwrap(uint64_t id) const {
+        if (slab_mode()) {
+            const Record *record = FindRecord(id);
+            if (!record) {
+                return 0;
+            }
+            // Wrap() bumps the generation before storing the handle of a reused record, so if the handle loaded here
+            // was stored for a newer ID the generation check below fails.
+            const uint64_t handle = record->handle.load(std::memory_order_acquire);
+            return (record->generation.load(std::memory_order_relaxed) == static_cast<uint32_t>(id >> 32)) ? handle : 0;
+        }
+        const auto iter = hashed_.find(id);
+        return (iter != hashed_.end()) ? iter->second : 0;
+    }
+
+    FindResult end() const { return FindResult(false, 0); }
+    FindResult cend() const { return end(); }
+
+    FindResult find(uint64_t id) const {
+        if (!slab_mode()) {
+            return hashed_.find(id);
+        }
+        const Record *record = FindRecord(id);
+        if (!record) {
+            return end();
+        }
+        const uint64_t handle = record->handle.load(std::memory_order_acquire);
+        return (record->generation.load(std::memory_order_relaxed) == static_cast<uint32_t>(id >> 32))
+                   ? FindResult(true, handle)
+                   : end();
+    }
+
+    bool contains(uint64_t id) const { return find(id) != end(); }
+
+    FindResult pop(uint64_t id) {
+        if (!slab_mode()) {
+            return hashed_.pop(id);
+        }
+        Record *record = const_cast<Record *>(FindRecord(id));
+        uint32_t generation = static_cast<uint32_t>(id >> 32);
+        // Only one of several racing pop()s of the same ID gets to release the record, and the even generation marks it
+        // as free
+        if (!record || !record->generation.compare_exchange_strong(generation, generation + 1, std::memory_order_acq_rel)) {
+            return end();
+        }
+        const uint64_t handle = record->handle.exchange(0, std::memory_order_acq_rel);
+        {
+            std::lock_guard<std::mutex> lock(slab_lock_);
+            free_records_.push_back(static_cast<uint32_t>((id & kIndexMask) >> 1));
+        }
+        slab_count_.fetch_sub(1, std::memory_order_relaxed);
+        return FindResult(true, handle);
+    }
+
+    // returns size_type
+    size_t erase(uint64_t id) { return (pop(id) != end()) ? 1 : 0; }
+
+    size_t size() const { return slab_mode() ? slab_count_.load(std::memory_order_relaxed) : hashed_.size(); }
+
+    bool empty() const { return size() == 0; }
+
+  private:
+    static const uint64_t kTag = 1;
+    static const uint64_t kIndexMask = 0xFFFFFFFEull;
+    static const size_t kSlabRecords = 4096;
+    static const size_t kMaxSlabs = 8192;  // 32M records, a 64KB directory on 64-bit
+    static const size_t kMinFreeRecords = 1024;
+
+    struct Record {
+        std::atomic<uint64_t> handle{0};
+        std::atomic<uint32_t> generation{1};
+    };
+
+    // Lock free. Returns nullptr if id can't name a live record, without checking it against the record's generation.
+    const Record *FindRecord(uint64_t id) const {
+        // Both the tag and the generation of a live record are odd
+        if ((id & kTag) == 0 || ((id >> 32) & 1) == 0) {
+            return nullptr;
+        }
+        const size_t index = static_cast<size_t>((id & kIndexMask) >> 1);
+        if (index >= records_allocated_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &slabs_[index / kSlabRecords].load(std::memory_order_relaxed)[index % kSlabRecords];
+    }
+
+    std::atomic<bool> slab_mode_{false};
+
+    // hashed mode
+    std::atomic<uint64_t> next_id_{1};
+    vl_concurrent_read_mostly_map<uint64_t, uint64_t, LOCKSLOG2, Hash> hashed_;
+
+    // slab mode. slab_lock_ only guards allocation and the free list, lookups read the directory without it.
+    std::atomic<Record *> slabs_[kMaxSlabs];
+    mutable std::mutex slab_lock_;
+    size_t slab_total_ = 0;
+    size_t slab_used_ = kSlabRecords;
+    std::deque<uint32_t> free_records_;
+    std::atomic<size_t> records_allocated_{0};
+    std::atomic<size_t> slab_count_{0};
+};
+
+// Fixed size pool of worker threads for validation work that can be split into independent pieces.
+//
+// ParallelFor() hands out indices through an atomic counter, and the calling thread takes part in the loop too. A loop
+// therefore always makes progress, even when it is nested inside another loop or all workers are busy, and a pool with
+// zero workers simply runs the loop serially on the calling thread.
+class ValidationThreadPool {
+  public:
+    explicit ValidationThreadPool(uint32_t worker_count) {
+        workers_.reserve(worker_count);
+        for (uint32_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back(&ValidationThreadPool::WorkerLoop, this);
+        }
+    }
+    ~ValidationThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            shutdown_ = true;
+        }
+        work_available_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+    ValidationThreadPool(const ValidationThreadPool &) = delete;
+    ValidationThreadPool &operator=(const ValidationThreadPool &) = delete;
+
+    size_t worker_count() const { return workers_.size(); }
+
+    // Queues task to run on a worker without waiting for it. Tasks still queued when the pool is destroyed are run
+    // before the destructor returns.
+    void Post(std::function<void()> &&task) {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            queue_.emplace_back(std::move(task));
+        }
+        work_available_.notify_one();
+    }
+
+    // Calls func(i) once for every i in [0, count), and returns when all calls have completed. The order in which the
+    // calls are made, and the threads they are made on, are unspecified.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func) {
+        if (count == 0) {
+            return;
+        }
+        Loop loop(count, func);
+        // No point in waking more workers than there are indices left for them
+        const size_t tickets = std::min(count - 1, workers_.size());
+        if (tickets > 0) {
+            {
+                std::lock_guard<std::mutex> lock(lock_);
+                for (size_t i = 0; i < tickets; ++i) {
+                    queue_.emplace_back(&loop);
+                }
+                loop.pending_tickets = tickets;
+            }
+            work_available_.notify_all();
+        }
+        loop.Run();
+        if (tickets > 0) {
+            std::unique_lock<std::mutex> lock(lock_);
+            // Take back the tickets no worker has picked up yet, then wait for the workers still inside the loop
+            for (auto it = queue_.begin(); it != queue_.end();) {
+                if (it->loop == &loop) {
+                    it = queue_.erase(it);
+                    --loop.pending_tickets;
+                } else {
+                    ++it;
+                }
+            }
+            loop_done_.wait(lock, [&loop] { return loop.pending_tickets == 0; });
+        }
+    }
+
+  private:
+    struct Loop {
+        Loop(size_t c, const std::function<void(size_t)> &f) : count(c), func(f) {}
+        void Run() {
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+                 i = next.fetch_add(1, std::memory_order_relaxed)) {
+                func(i);
+            }
+        }
+        const size_t count;
+        const std::function<void(size_t)> &func;
+        std::atomic<size_t> next{0};
+        // Tickets queued or being run by a worker, guarded by lock_
+        size_t pending_tickets = 0;
+    };
+    // Either a ticket for a ParallelFor() loop or a posted task
+    struct WorkItem {
+        explicit WorkItem(Loop *l) : loop(l) {}
+        explicit WorkItem(std::function<void()> &&t) : loop(nullptr), task(std::move(t)) {}
+        Loop *loop;
+        std::function<void()> task;
+    };
+
+    void WorkerLoop() {
+        std::unique_lock<std::mutex> lock(lock_);
+        for (;;) {
+            work_available_.wait(lock, [this] { return shutdown_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            WorkItem item = std::move(queue_.front());
+            queue_.pop_front();
+            lock.unlock();
+            if (item.loop) {
+                item.loop->Run();
+            } else {
+                item.task();
+                item.task = nullptr;
+            }
+            lock.lock();
+            if (item.loop && --item.loop->pending_tickets == 0) {
+                loop_done_.notify_all();
+            }
+        }
+    }
+
+    std::mutex lock_;
+    std::condition_variable work_available_;
+    std::condition_variable loop_done_;
+    std::deque<WorkItem> queue_;
+    bool shutdown_ = false;
+    std::vector<std::thread> workers_;
+};
 #endif
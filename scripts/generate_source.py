@@ -31,7 +31,8 @@ import common_codegen
 
 # files to exclude from --verify check
 verify_exclude = ['.clang-format',
-                  'gpu_pre_draw_shader.h'] # Requires glslangvalidator, so updated manually when needed
+                  'gpu_pre_draw_shader.h', # Requires glslangvalidator, so updated manually when needed
+                  'gpu_compact_output_shader.h']
 
 def main(argv):
     parser = argparse.ArgumentParser(description='Generate source code for this repository')
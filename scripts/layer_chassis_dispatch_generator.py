@@ -153,6 +153,121 @@ class LayerChassisDispatchOutputGenerator(OutputGenerator):
 
 #define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
+// Per-thread bump allocator for the temporary copies made while unwrapping the handles of the barrier and descriptor
+// write commands further down. A DispatchScratch rewinds the thread's arena to where it found it when it goes out of
+// scope, so down-chain calls nested on one thread stack naturally, and once the arena has grown nothing is allocated
+// per call.
+class DispatchScratch {
+  public:
+    DispatchScratch()
+        : arena_(LocalArena()), block_(arena_.block), offset_(arena_.offset), pnext_count_(arena_.pnext_chains.size()) {}
+    ~DispatchScratch() {
+        while (arena_.pnext_chains.size() > pnext_count_) {
+            FreePnextChain(arena_.pnext_chains.back());
+            arena_.pnext_chains.pop_back();
+        }
+        arena_.block = block_;
+        arena_.offset = offset_;
+    }
+    DispatchScratch(const DispatchScratch &) = delete;
+    DispatchScratch &operator=(const DispatchScratch &) = delete;
+
+    // Shallow copy of count elements of src, T must be trivially copyable
+    template <typename T>
+    T *Copy(const T *src, uint32_t count) {
+        T *dst = static_cast<T *>(Allocate(sizeof(T) * count));
+        if (count) memcpy(dst, src, sizeof(T) * count);
+        return dst;
+    }
+
+    // Deep copies a pNext chain, if there is one, and unwraps the handles in it. The copy is freed along with the scratch.
+    const void *UnwrapPnext(ValidationObject *layer_data, const void *pNext) {
+        if (!pNext) return nullptr;
+        void *copy = SafePnextCopy(pNext);
+        WrapPnextChainHandles(layer_data, copy);
+        arena_.pnext_chains.push_back(copy);
+        return copy;
+    }
+
+  private:
+    static const size_t kBlockSize = 64 * 1024;
+    static const size_t kAlignment = 16;
+
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+    struct Arena {
+        std::vector<Block> blocks;
+        size_t block = 0;
+        size_t offset = 0;
+        std::vector<void *> pnext_chains;
+    };
+
+    static Arena &LocalArena() {
+        static thread_local Arena arena;
+        return arena;
+    }
+
+    void *Allocate(size_t size) {
+        size = (size + kAlignment - 1) & ~(kAlignment - 1);
+        if (arena_.block < arena_.blocks.size() && arena_.offset + size <= arena_.blocks[arena_.block].size) {
+            void *ptr = arena_.blocks[arena_.block].data.get() + arena_.offset;
+            arena_.offset += size;
+            return ptr;
+        }
+        // Allocations are strictly nested, so every block after the current one is unused and can be replaced if it is
+        // too small.
+        const size_t next = arena_.blocks.empty() ? 0 : arena_.block + 1;
+        if (next == arena_.blocks.size()) {
+            arena_.blocks.emplace_back();
+        }
+        Block &block = arena_.blocks[next];
+        if (block.data == nullptr || block.size < size) {
+            block.size = (size > kBlockSize) ? size : kBlockSize;
+            block.data.reset(new uint8_t[block.size]);
+        }
+        arena_.block = next;
+        arena_.offset = size;
+        return block.data.get();
+    }
+
+    Arena &arena_;
+    const size_t block_;
+    const size_t offset_;
+    const size_t pnext_count_;
+};
+
+// VkWriteDescriptorSet array pointers that don't match descriptorType are ignored, and may be invalid
+static inline bool DescriptorTypeUsesImageInfo(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static inline bool DescriptorTypeUsesBufferInfo(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static inline bool DescriptorTypeUsesTexelBufferView(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+}
+
 // The VK_EXT_pipeline_creation_feedback extension returns data from the driver -- we've created a copy of the pnext chain, so
 // copy the returned data to the caller before freeing the copy's data.
 void CopyCreatePipelineFeedbackData(const void *src_chain, const void *dst_chain) {
@@ -1365,6 +1480,231 @@ VkResult DispatchGetDeferredOperationResultKHR(
 
     return result;
 }
+
+// The barrier and descriptor write commands below are called often, with large arrays. Instead of deep copying their
+// parameters into safe structs, they make shallow copies in a DispatchScratch and only rewrite the handle members. None
+// of the structs that can extend the barrier structs contain handles, so the barriers' pNext chains are passed on as is.
+static void UnwrapBarrierHandles(ValidationObject *layer_data, VkBufferMemoryBarrier &barrier) {
+    if (barrier.buffer) {
+        barrier.buffer = layer_data->Unwrap(barrier.buffer);
+    }
+}
+
+static void UnwrapBarrierHandles(ValidationObject *layer_data, VkImageMemoryBarrier &barrier) {
+    if (barrier.image) {
+        barrier.image = layer_data->Unwrap(barrier.image);
+    }
+}
+
+static void UnwrapBarrierHandles(ValidationObject *layer_data, VkBufferMemoryBarrier2 &barrier) {
+    if (barrier.buffer) {
+        barrier.buffer = layer_data->Unwrap(barrier.buffer);
+    }
+}
+
+static void UnwrapBarrierHandles(ValidationObject *layer_data, VkImageMemoryBarrier2 &barrier) {
+    if (barrier.image) {
+        barrier.image = layer_data->Unwrap(barrier.image);
+    }
+}
+
+template <typename Barrier>
+static const Barrier *UnwrapBarriers(ValidationObject *layer_data, DispatchScratch &scratch, const Barrier *barriers,
+                                     uint32_t count) {
+    if (!barriers) return nullptr;
+    Barrier *local_barriers = scratch.Copy(barriers, count);
+    for (uint32_t index = 0; index < count; ++index) {
+        UnwrapBarrierHandles(layer_data, local_barriers[index]);
+    }
+    return local_barriers;
+}
+
+static const VkDependencyInfo *UnwrapDependencyInfos(ValidationObject *layer_data, DispatchScratch &scratch,
+                                                     const VkDependencyInfo *infos, uint32_t count) {
+    if (!infos) return nullptr;
+    VkDependencyInfo *local_infos = scratch.Copy(infos, count);
+    for (uint32_t index = 0; index < count; ++index) {
+        local_infos[index].pBufferMemoryBarriers =
+            UnwrapBarriers(layer_data, scratch, infos[index].pBufferMemoryBarriers, infos[index].bufferMemoryBarrierCount);
+        local_infos[index].pImageMemoryBarriers =
+            UnwrapBarriers(layer_data, scratch, infos[index].pImageMemoryBarriers, infos[index].imageMemoryBarrierCount);
+    }
+    return local_infos;
+}
+
+static const VkWriteDescriptorSet *UnwrapDescriptorWrites(ValidationObject *layer_data, DispatchScratch &scratch,
+                                                          const VkWriteDescriptorSet *writes, uint32_t count) {
+    if (!writes) return nullptr;
+    VkWriteDescriptorSet *local_writes = scratch.Copy(writes, count);
+    for (uint32_t index0 = 0; index0 < count; ++index0) {
+        VkWriteDescriptorSet &write = local_writes[index0];
+        // Acceleration structure writes are chained in pNext
+        write.pNext = scratch.UnwrapPnext(layer_data, write.pNext);
+        if (write.dstSet) {
+            write.dstSet = layer_data->Unwrap(write.dstSet);
+        }
+        if (write.pImageInfo && DescriptorTypeUsesImageInfo(write.descriptorType)) {
+            VkDescriptorImageInfo *local_image_info = scratch.Copy(write.pImageInfo, write.descriptorCount);
+            for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                if (local_image_info[index1].sampler) {
+                    local_image_info[index1].sampler = layer_data->Unwrap(local_image_info[index1].sampler);
+                }
+                if (local_image_info[index1].imageView) {
+                    local_image_info[index1].imageView = layer_data->Unwrap(local_image_info[index1].imageView);
+                }
+            }
+            write.pImageInfo = local_image_info;
+        }
+        if (write.pBufferInfo && DescriptorTypeUsesBufferInfo(write.descriptorType)) {
+            VkDescriptorBufferInfo *local_buffer_info = scratch.Copy(write.pBufferInfo, write.descriptorCount);
+            for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                if (local_buffer_info[index1].buffer) {
+                    local_buffer_info[index1].buffer = layer_data->Unwrap(local_buffer_info[index1].buffer);
+                }
+            }
+            write.pBufferInfo = local_buffer_info;
+        }
+        if (write.pTexelBufferView && DescriptorTypeUsesTexelBufferView(write.descriptorType)) {
+            VkBufferView *local_texel_buffer_view = scratch.Copy(write.pTexelBufferView, write.descriptorCount);
+            for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                local_texel_buffer_view[index1] = layer_data->Unwrap(local_texel_buffer_view[index1]);
+            }
+            write.pTexelBufferView = local_texel_buffer_view;
+        }
+    }
+    return local_writes;
+}
+
+void DispatchCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                           VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount,
+                           const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount,
+                           const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
+                           const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask,
+                                                               memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                                               pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                                               pImageMemoryBarriers);
+    DispatchScratch scratch;
+    VkEvent *local_pEvents = NULL;
+    if (pEvents) {
+        local_pEvents = scratch.Copy(pEvents, eventCount);
+        for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
+            local_pEvents[index0] = layer_data->Unwrap(local_pEvents[index0]);
+        }
+    }
+    layer_data->device_dispatch_table.CmdWaitEvents(
+        commandBuffer, eventCount, local_pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers,
+        bufferMemoryBarrierCount, UnwrapBarriers(layer_data, scratch, pBufferMemoryBarriers, bufferMemoryBarrierCount),
+        imageMemoryBarrierCount, UnwrapBarriers(layer_data, scratch, pImageMemoryBarriers, imageMemoryBarrierCount));
+}
+
+void DispatchCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount,
+                                const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount,
+                                const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
+                                const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
+                                                                    memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                                                    pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                                                    pImageMemoryBarriers);
+    DispatchScratch scratch;
+    layer_data->device_dispatch_table.CmdPipelineBarrier(
+        commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+        UnwrapBarriers(layer_data, scratch, pBufferMemoryBarriers, bufferMemoryBarrierCount), imageMemoryBarrierCount,
+        UnwrapBarriers(layer_data, scratch, pImageMemoryBarriers, imageMemoryBarrierCount));
+}
+
+void DispatchCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                            const VkDependencyInfo *pDependencyInfos) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.CmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    DispatchScratch scratch;
+    VkEvent *local_pEvents = NULL;
+    if (pEvents) {
+        local_pEvents = scratch.Copy(pEvents, eventCount);
+        for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
+            local_pEvents[index0] = layer_data->Unwrap(local_pEvents[index0]);
+        }
+    }
+    layer_data->device_dispatch_table.CmdWaitEvents2(commandBuffer, eventCount, local_pEvents,
+                                                     UnwrapDependencyInfos(layer_data, scratch, pDependencyInfos, eventCount));
+}
+
+void DispatchCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                               const VkDependencyInfo *pDependencyInfos) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.CmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    DispatchScratch scratch;
+    VkEvent *local_pEvents = NULL;
+    if (pEvents) {
+        local_pEvents = scratch.Copy(pEvents, eventCount);
+        for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
+            local_pEvents[index0] = layer_data->Unwrap(local_pEvents[index0]);
+        }
+    }
+    layer_data->device_dispatch_table.CmdWaitEvents2KHR(commandBuffer, eventCount, local_pEvents,
+                                                        UnwrapDependencyInfos(layer_data, scratch, pDependencyInfos, eventCount));
+}
+
+void DispatchCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    if (!wrap_handles) return layer_data->device_dispatch_table.CmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+    DispatchScratch scratch;
+    layer_data->device_dispatch_table.CmdPipelineBarrier2(commandBuffer,
+                                                          UnwrapDependencyInfos(layer_data, scratch, pDependencyInfo, 1));
+}
+
+void DispatchCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    if (!wrap_handles) return layer_data->device_dispatch_table.CmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+    DispatchScratch scratch;
+    layer_data->device_dispatch_table.CmdPipelineBarrier2KHR(commandBuffer,
+                                                             UnwrapDependencyInfos(layer_data, scratch, pDependencyInfo, 1));
+}
+
+void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
+                                                                      descriptorCopyCount, pDescriptorCopies);
+    DispatchScratch scratch;
+    VkCopyDescriptorSet *local_pDescriptorCopies = NULL;
+    if (pDescriptorCopies) {
+        local_pDescriptorCopies = scratch.Copy(pDescriptorCopies, descriptorCopyCount);
+        for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
+            if (local_pDescriptorCopies[index0].srcSet) {
+                local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(local_pDescriptorCopies[index0].srcSet);
+            }
+            if (local_pDescriptorCopies[index0].dstSet) {
+                local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(local_pDescriptorCopies[index0].dstSet);
+            }
+        }
+    }
+    layer_data->device_dispatch_table.UpdateDescriptorSets(
+        device, descriptorWriteCount, UnwrapDescriptorWrites(layer_data, scratch, pDescriptorWrites, descriptorWriteCount),
+        descriptorCopyCount, local_pDescriptorCopies);
+}
+
+void DispatchCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                     VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount,
+                                     const VkWriteDescriptorSet *pDescriptorWrites) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set,
+                                                                         descriptorWriteCount, pDescriptorWrites);
+    DispatchScratch scratch;
+    layout = layer_data->Unwrap(layout);
+    layer_data->device_dispatch_table.CmdPushDescriptorSetKHR(
+        commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
+        UnwrapDescriptorWrites(layer_data, scratch, pDescriptorWrites, descriptorWriteCount));
+}
 """
     # Separate generated text for source and headers
     ALL_SECTIONS = ['source_file', 'header_file']
@@ -1432,6 +1772,15 @@ VkResult DispatchGetDeferredOperationResultKHR(
             'vkFreeCommandBuffers',
             'vkDestroyCommandPool',
             'vkBeginCommandBuffer',
+            # These unwrap their barrier and descriptor write arrays with shallow copies
+            'vkCmdPipelineBarrier',
+            'vkCmdPipelineBarrier2',
+            'vkCmdPipelineBarrier2KHR',
+            'vkCmdWaitEvents',
+            'vkCmdWaitEvents2',
+            'vkCmdWaitEvents2KHR',
+            'vkUpdateDescriptorSets',
+            'vkCmdPushDescriptorSetKHR',
             ]
         self.headerVersion = None
         # Internal state - accumulators for different inner block text
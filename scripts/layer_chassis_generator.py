@@ -240,8 +240,6 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_typemap_helper.h"
 
 
-extern std::atomic<uint64_t> global_unique_id;
-
 // To avoid re-hashing unique ids on each use, we precompute the hash and store the
 // hash's LSBs in the high 24 bits.
 struct HashedUint64 {
@@ -255,7 +253,7 @@ struct HashedUint64 {
     }
 };
 
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vl_wrapped_handle_map<4, HashedUint64> unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -368,6 +366,13 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{true};
+        uint32_t thread_safety_sample_period{1};
+        // Object uses of this instance or device that were checked by thread safety validation while sampling
+        std::atomic<uint64_t> thread_safety_sampled_uses{0};
+        uint32_t validation_worker_threads{0};
+        bool deferred_shader_validation{false};
+        // GPU-AV and Debug Printf settings given through VkLayerSettingsEXT, by their settings file key
+        layer_data::unordered_map<std::string, std::string> gpu_settings;
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -398,6 +403,16 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Set by InitObjectDispatchVectors() for objects whose ReadLock()/WriteLock() never take validation_object_mutex
+        // (i.e. those relying on fine_grained_locking), so the generated intercepts can skip the virtual lock calls.
+        bool intercept_lock_elided{false};
+        ReadLockGuard InterceptReadLock() {
+            return intercept_lock_elided ? ReadLockGuard() : ReadLock();
+        }
+        WriteLockGuard InterceptWriteLock() {
+            return intercept_lock_elided ? WriteLockGuard() : WriteLock();
+        }
+
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
             if (vo_enabled) {
@@ -412,6 +427,10 @@ class ValidationObject {
             enabled = framework->enabled;
             disabled = framework->disabled;
             fine_grained_locking = framework->fine_grained_locking;
+            thread_safety_sample_period = framework->thread_safety_sample_period;
+            validation_worker_threads = framework->validation_worker_threads;
+            deferred_shader_validation = framework->deferred_shader_validation;
+            gpu_settings = framework->gpu_settings;
             instance = inst;
         }
 
@@ -427,6 +446,10 @@ class ValidationObject {
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
                 fine_grained_locking = inst_obj->fine_grained_locking;
+                thread_safety_sample_period = inst_obj->thread_safety_sample_period;
+                validation_worker_threads = inst_obj->validation_worker_threads;
+                deferred_shader_validation = inst_obj->deferred_shader_validation;
+                gpu_settings = inst_obj->gpu_settings;
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -609,26 +632,19 @@ class ValidationObject {
         // Unwrap a handle.
         template <typename HandleType>
         HandleType Unwrap(HandleType wrappedHandle) {
-            auto iter = unique_id_mapping.find(reinterpret_cast<uint64_t const &>(wrappedHandle));
-            if (iter == unique_id_mapping.end())
-                return (HandleType)0;
-            return (HandleType)iter->second;
+            return (HandleType)unique_id_mapping.Unwrap(reinterpret_cast<uint64_t const &>(wrappedHandle));
         }
 
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -680,13 +696,11 @@ class ValidationObject {
 #include "layer_options.h"
 #include "layer_chassis_dispatch.h"
 
-small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
+dispatch_key_map<ValidationObject> layer_data_map;
 
-// Global unique object identifier.
-std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+vl_wrapped_handle_map<4, HashedUint64> unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -935,8 +949,15 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
     bool lock_setting;
+    bool slab_handle_setting = false;
+    uint32_t sample_period_setting = 1;
+    uint32_t worker_threads_setting = 0;
+    bool deferred_shader_setting = false;
+    layer_data::unordered_map<std::string, std::string> gpu_settings;
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting, &slab_handle_setting,
+        &sample_period_setting, &worker_threads_setting, &deferred_shader_setting,
+        &gpu_settings};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
@@ -972,6 +993,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     if (local_disables[handle_wrapping]) {
         wrap_handles = false;
     }
+    // The wrapping scheme can only change while no handles are wrapped, so the first instance decides it
+    unique_id_mapping.set_slab_mode(slab_handle_setting);
 
     // Init dispatch array and call registration functions
     bool skip = false;
@@ -995,6 +1018,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->disabled = local_disables;
     framework->enabled = local_enables;
     framework->fine_grained_locking = lock_setting;
+    framework->thread_safety_sample_period = sample_period_setting;
+    framework->validation_worker_threads = worker_threads_setting;
+    framework->deferred_shader_validation = deferred_shader_setting;
+    framework->gpu_settings = std::move(gpu_settings);
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -1877,7 +1904,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             chassis_hdr_content += self.virtual_fcn_defs
             chassis_hdr_content += self.inline_custom_validation_class_definitions
             chassis_hdr_content += '};\n\n'
-            chassis_hdr_content += 'extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;'
+            chassis_hdr_content += 'extern dispatch_key_map<ValidationObject> layer_data_map;'
             write(chassis_hdr_content, file=self.outFile)
         elif self.helper_header:
             self.newline()
@@ -1895,6 +1922,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             helper_content += '\n\n'
             helper_content += '    intercept_vectors.resize(InterceptIdCount);\n\n'
             helper_content += self.dispatch_vector_fcns;
+            helper_content += self.init_intercept_lock_elision
             helper_content += '};\n'
             write(helper_content, file=self.outFile)
 
@@ -1982,6 +2010,13 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         elif resulttype.text == 'VkDeviceAddress':
             post_call_record = post_call_record.replace(')', ', VkDeviceAddress result)')
         return '        %s\n        %s\n        %s\n' % (pre_call_validate, pre_call_record, post_call_record)
+    init_intercept_lock_elision = """
+    // ReadLock()/WriteLock() are fixed once the device is created, so probe them once here rather than making two virtual
+    // calls per intercept per API call.
+    for (auto item : this->object_dispatch) {
+        item->intercept_lock_elided = !item->ReadLock().owns_lock() && !item->WriteLock().owns_lock();
+    }
+"""
     #
     # Command generation
     def genCmd(self, cmdinfo, name, alias):
@@ -2073,15 +2108,22 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             if (resulttype.text != 'void'):
                 assignresult = resulttype.text + ' result = '
 
-            # Set up skip and locking
+            # Set up skip and locking. Device level intercepts go through the per-device intercept vectors, which also know
+            # whether each object's lock can be elided.
             self.appendSection('command', '    bool skip = false;')
+            if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
+                read_lock = 'InterceptReadLock'
+                write_lock = 'InterceptWriteLock'
+            else:
+                read_lock = 'ReadLock'
+                write_lock = 'WriteLock'
 
             # Generate pre-call validation source code
             if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
-            self.appendSection('command', '        auto lock = intercept->ReadLock();')
+            self.appendSection('command', '        auto lock = intercept->%s();' % read_lock)
             self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
             self.appendSection('command', '    }')
@@ -2091,7 +2133,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
-            self.appendSection('command', '        auto lock = intercept->WriteLock();')
+            self.appendSection('command', '        auto lock = intercept->%s();' % write_lock)
             self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '    }')
 
@@ -2114,7 +2156,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             returnparam = ''
             if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
                 returnparam = ', result'
-            self.appendSection('command', '        auto lock = intercept->WriteLock();')
+            self.appendSection('command', '        auto lock = intercept->%s();' % write_lock)
             self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
             self.appendSection('command', '    }')
             # Return result variable, if any.
@@ -162,6 +162,8 @@ class ThreadOutputGenerator(OutputGenerator):
 
 #include <atomic>
 #include <chrono>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -204,38 +206,29 @@ public:
     class WriteReadCount
     {
     public:
-        WriteReadCount(int64_t v) : count(v) {}
+        WriteReadCount(uint64_t v) : count(v) {}
 
-        int32_t GetReadCount() const { return (int32_t)(count & 0xFFFFFFFF); }
-        int32_t GetWriteCount() const { return (int32_t)(count >> 32); }
+        int32_t GetReadCount() const { return (int32_t)(count & kCountMask); }
+        int32_t GetWriteCount() const { return (int32_t)((count >> kWriterShift) & kCountMask); }
 
     private:
-        int64_t count;
+        uint64_t count;
     };
 
-    ObjectUseData() : thread(0), writer_reader_count(0) {
+    ObjectUseData() : thread(0), state(0) {
         // silence -Wunused-private-field warning
         padding[0] = 0;
     }
 
-    WriteReadCount AddWriter() {
-        int64_t prev = writer_reader_count.fetch_add(1ULL << 32);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount AddReader() {
-        int64_t prev = writer_reader_count.fetch_add(1ULL);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount RemoveWriter() {
-        int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
-        return WriteReadCount(prev);
-    }
-    WriteReadCount RemoveReader() {
-        int64_t prev = writer_reader_count.fetch_add(-1LL);
-        return WriteReadCount(prev);
-    }
+    // Add*() and Remove*() fail, and return false, if the record was released since generation was read. This keeps a use
+    // that races with the destruction of its object from changing the counts of the next object using the record.
+    // Remove*() also fails instead of taking a count below zero.
+    bool AddWriter(uint32_t generation, WriteReadCount &prev) { return Add(generation, kOneWriter, prev); }
+    bool AddReader(uint32_t generation, WriteReadCount &prev) { return Add(generation, kOneReader, prev); }
+    bool RemoveWriter(uint32_t generation) { return Remove(generation, kWriterShift); }
+    bool RemoveReader(uint32_t generation) { return Remove(generation, 0); }
     WriteReadCount GetCount() {
-        return WriteReadCount(writer_reader_count);
+        return WriteReadCount(state.load());
     }
 
     void WaitForObjectIdle(bool is_writer)  {
@@ -245,17 +238,161 @@ public:
         }
     }
 
+    uint32_t GetGeneration() const { return (uint32_t)(state.load(std::memory_order_acquire) >> kGenerationShift); }
+    // Only called by ObjectUseDataPool when the record is released. Moves to the next generation and drops the counts of
+    // uses still in flight, whose Remove*() calls then fail.
+    void Release() {
+        uint64_t prev = state.load(std::memory_order_relaxed);
+        while (!state.compare_exchange_weak(prev, ((prev >> kGenerationShift) + 1) << kGenerationShift,
+                                            std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        }
+    }
+
     std::atomic<loader_platform_thread_id> thread;
 
 private:
-    // need to update write and read counts atomically. Writer in high
-    // 32 bits, reader in low 32 bits.
-    std::atomic<int64_t> writer_reader_count;
+    // The generation, writer count and reader count are updated together. Generation in the high 16 bits, writers in the
+    // next 24 bits and readers in the low 24 bits.
+    static const uint64_t kCountMask = 0xFFFFFF;
+    static const int kWriterShift = 24;
+    static const int kGenerationShift = 48;
+    static const uint64_t kOneReader = 1;
+    static const uint64_t kOneWriter = 1ULL << kWriterShift;
+
+    bool Add(uint32_t generation, uint64_t one, WriteReadCount &prev) {
+        uint64_t current = state.load(std::memory_order_relaxed);
+        do {
+            if ((current >> kGenerationShift) != generation) {
+                return false;
+            }
+        } while (!state.compare_exchange_weak(current, current + one, std::memory_order_acq_rel, std::memory_order_relaxed));
+        prev = WriteReadCount(current);
+        return true;
+    }
+    bool Remove(uint32_t generation, int shift) {
+        uint64_t current = state.load(std::memory_order_relaxed);
+        do {
+            if ((current >> kGenerationShift) != generation || ((current >> shift) & kCountMask) == 0) {
+                return false;
+            }
+        } while (!state.compare_exchange_weak(current, current - (1ULL << shift), std::memory_order_acq_rel,
+                                              std::memory_order_relaxed));
+        return true;
+    }
+
+    std::atomic<uint64_t> state;
 
     // Put each lock on its own cache line to avoid false cache line sharing.
-    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>))) & 63];
+    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<uint64_t>))) & 63];
 };
 
+// Stable storage for the ObjectUseData records of one counter. Records are carved out of cache line aligned slabs that
+// are only freed with the pool, so a pointer returned by counter::FindObject() stays dereferenceable even if the object
+// is destroyed concurrently. Released records get a new generation, which lets a use racing with the destruction of its
+// object notice and back out, and are recycled in FIFO order only once kMinFreeRecords others are waiting.
+class ObjectUseDataPool {
+public:
+    struct Ref {
+        ObjectUseData *data;
+        uint32_t generation;
+    };
+
+    Ref Allocate() {
+        std::lock_guard<std::mutex> lock(lock_);
+        ObjectUseData *data;
+        if (free_records_.size() > kMinFreeRecords) {
+            data = free_records_.front();
+            free_records_.pop_front();
+            data->thread.store(0, std::memory_order_relaxed);
+        } else {
+            if (slab_used_ == kSlabRecords) {
+                slabs_.emplace_back(new char[(kSlabRecords + 1) * sizeof(ObjectUseData)]);
+                const uintptr_t address = reinterpret_cast<uintptr_t>(slabs_.back().get());
+                current_slab_ = reinterpret_cast<char *>((address + kCacheLineSize - 1) & ~(kCacheLineSize - 1));
+                slab_used_ = 0;
+            }
+            data = new (current_slab_ + slab_used_++ * sizeof(ObjectUseData)) ObjectUseData();
+        }
+        return {data, data->GetGeneration()};
+    }
+
+    void Free(ObjectUseData *data) {
+        std::lock_guard<std::mutex> lock(lock_);
+        data->Release();
+        free_records_.push_back(data);
+    }
+
+private:
+    static const uintptr_t kCacheLineSize = 64;
+    static const size_t kSlabRecords = 256;
+    static const size_t kMinFreeRecords = 256;
+
+    std::mutex lock_;
+    // ObjectUseData is trivially destructible, so the slabs are released as raw storage.
+    std::vector<std::unique_ptr<char[]>> slabs_;
+    char *current_slab_ = nullptr;
+    size_t slab_used_ = kSlabRecords;
+    std::deque<ObjectUseData *> free_records_;
+};
+
+
+// Per-thread list of the object uses that this thread started and hasn't finished yet. Finish*() takes the record and
+// generation that Start*() used from here rather than looking the object up again, so it costs no map lookup and never
+// touches the record of an object that replaced the one it started on. When thread_safety_sample_period is greater than
+// one, each thread only checks one in every N of its object uses, and only those are listed. The number of sampled uses
+// is counted per validation object and reported when a device is destroyed.
+class ThreadSafetyUses {
+public:
+    // Returns false if this use is skipped by sampling
+    static bool Sample(uint32_t period, std::atomic<uint64_t> &sampled_uses) {
+        if (period <= 1) {
+            return true;
+        }
+        ThreadState &state = GetThreadState();
+        if (++state.unsampled_uses < period) {
+            return false;
+        }
+        state.unsampled_uses = 0;
+        sampled_uses.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    static void Started(const void *counter, uint64_t object, bool is_write, ObjectUseData *data, uint32_t generation) {
+        GetThreadState().outstanding.push_back({counter, object, is_write, data, generation});
+    }
+
+    // Returns false if Start*() skipped or didn't count this use
+    static bool Finished(const void *counter, uint64_t object, bool is_write, ObjectUseData *&data, uint32_t &generation) {
+        auto &outstanding = GetThreadState().outstanding;
+        // Uses are nested within a call, so the matching entry is almost always the last one
+        for (auto it = outstanding.rbegin(); it != outstanding.rend(); ++it) {
+            if (it->counter == counter && it->object == object && it->is_write == is_write) {
+                data = it->data;
+                generation = it->generation;
+                outstanding.erase(std::next(it).base());
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Use {
+        const void *counter;
+        uint64_t object;
+        bool is_write;
+        ObjectUseData *data;
+        uint32_t generation;
+    };
+    struct ThreadState {
+        uint32_t unsampled_uses = 0;
+        std::vector<Use> outstanding;
+    };
+    static ThreadState &GetThreadState() {
+        static thread_local ThreadState state;
+        return state;
+    }
+};
 
 template <typename T>
 class counter {
@@ -264,23 +401,32 @@ public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vl_concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    ObjectUseDataPool use_data_pool;
+    vl_concurrent_read_mostly_map<T, ObjectUseDataPool::Ref, 6> object_table;
 
     void CreateObject(T object) {
-        object_table.insert(object, std::make_shared<ObjectUseData>());
+        const ObjectUseDataPool::Ref ref = use_data_pool.Allocate();
+        if (!object_table.insert(object, ref)) {
+            use_data_pool.Free(ref.data);
+        }
     }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            auto iter = object_table.pop(object);
+            if (iter != object_table.end()) {
+                use_data_pool.Free(iter->second.data);
+            }
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object) {
+    // Also returns the generation of the record at the time of the lookup, see ObjectUseDataPool
+    ObjectUseData *FindObject(T object, uint32_t &generation) {
         assert(object_table.contains(object));
-        auto iter = std::move(object_table.find(object));
+        auto iter = object_table.find(object);
         if (iter != object_table.end()) {
-            return std::move(iter->second);
+            generation = iter->second.generation;
+            return iter->second.data;
         } else {
             object_data->LogError(object, kVUID_Threading_Info,
                     "Couldn't find %s Object 0x%" PRIxLEAST64
@@ -290,18 +436,29 @@ public:
         }
     }
 
+    // Returns false if this use of object is skipped by thread_safety_sample_period
+    bool SampleStart() {
+        return ThreadSafetyUses::Sample(object_data->thread_safety_sample_period, object_data->thread_safety_sampled_uses);
+    }
+
     void StartWrite(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !SampleStart()) {
             return;
         }
         bool skip = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
 
-        auto use_data = FindObject(object);
+        uint32_t generation;
+        ObjectUseData *use_data = FindObject(object, generation);
         if (!use_data) {
             return;
         }
-        const ObjectUseData::WriteReadCount prevCount = use_data->AddWriter();
+        ObjectUseData::WriteReadCount prevCount(0);
+        if (!use_data->AddWriter(generation, prevCount)) {
+            // The object was destroyed by another thread since the lookup, and the record no longer belongs to it
+            return;
+        }
+        ThreadSafetyUses::Started(this, HandleToUint64(object), true, use_data, generation);
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
             // There is no current use of the object.  Record writer thread.
@@ -353,29 +510,33 @@ public:
     }
 
     void FinishWrite(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
-            return;
-        }
-        // Object is no longer in use
-        auto use_data = FindObject(object);
-        if (!use_data) {
+        ObjectUseData *use_data;
+        uint32_t generation;
+        if (object == VK_NULL_HANDLE || !ThreadSafetyUses::Finished(this, HandleToUint64(object), true, use_data, generation)) {
             return;
         }
-        use_data->RemoveWriter();
+        // Object is no longer in use. Does nothing if the object was destroyed since StartWrite().
+        use_data->RemoveWriter(generation);
     }
 
     void StartRead(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !SampleStart()) {
             return;
         }
         bool skip = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
 
-        auto use_data = FindObject(object);
+        uint32_t generation;
+        ObjectUseData *use_data = FindObject(object, generation);
         if (!use_data) {
             return;
         }
-        const ObjectUseData::WriteReadCount prevCount = use_data->AddReader();
+        ObjectUseData::WriteReadCount prevCount(0);
+        if (!use_data->AddReader(generation, prevCount)) {
+            // The object was destroyed by another thread since the lookup, and the record no longer belongs to it
+            return;
+        }
+        ThreadSafetyUses::Started(this, HandleToUint64(object), false, use_data, generation);
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
             // There is no current use of the object.
@@ -396,15 +557,13 @@ public:
         }
     }
     void FinishRead(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
+        ObjectUseData *use_data;
+        uint32_t generation;
+        if (object == VK_NULL_HANDLE || !ThreadSafetyUses::Finished(this, HandleToUint64(object), false, use_data, generation)) {
             return;
         }
-
-        auto use_data = FindObject(object);
-        if (!use_data) {
-            return;
-        }
-        use_data->RemoveReader();
+        // Does nothing if the object was destroyed since StartRead()
+        use_data->RemoveReader(generation);
     }
     counter(const char *name = "", VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr) {
             typeName = name;
@@ -1149,6 +1308,12 @@ void ThreadSafety::PostCallRecordDestroyDevice(
     const VkAllocationCallbacks*                pAllocator) {
     FinishWriteObjectParentInstance(device, "vkDestroyDevice");
     DestroyObjectParentInstance(device);
+    if (thread_safety_sample_period > 1) {
+        LogInfo(device, kVUID_Threading_Info,
+                "vkDestroyDevice(): %" PRIu64 " uses of objects of this device were checked for thread safety, sampling "
+                "1 in every %" PRIu32 " uses per thread.",
+                thread_safety_sampled_uses.load(std::memory_order_relaxed), thread_safety_sample_period);
+    }
     // Host access to device must be externally synchronized
     auto lock = WriteLockGuard(thread_safety_lock);
     for (auto &queue : device_queues_map[device]) {
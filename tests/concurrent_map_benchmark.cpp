@@ -0,0 +1,147 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the striped-lock vl_concurrent_unordered_map with vl_concurrent_read_mostly_map on the two ways the layers use
+// them: state object lookups (shared_ptr values, as in ValidationStateTracker::Get<T>()) and handle unwrapping (uint64_t
+// values, as in unique_id_mapping). Reader threads look up random live keys while an optional writer thread keeps
+// creating and destroying objects, and the benchmark reports the average cost of a lookup.
+//
+// Usage: concurrent_map_benchmark [max reader threads]
+
+#include "vk_layer_data.h"
+#include "vk_layer_utils.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+namespace {
+
+const uint64_t kStableKeys = 4096;     // Keys that are always present, readers only look these up
+const uint64_t kChurnKeys = 4096;      // Keys the writer inserts and erases
+const uint64_t kLookupsPerThread = 2000000;
+
+struct StateObject {
+    explicit StateObject(uint64_t v) : value(v) {}
+    uint64_t value;
+};
+
+uint64_t MakeKey(uint64_t index) { return (index + 1) * 0x1000; }  // Handle-like keys
+
+template <typename Map>
+void Insert(Map &map, uint64_t key, std::shared_ptr<StateObject> *) {
+    map.insert_or_assign(key, std::make_shared<StateObject>(key));
+}
+template <typename Map>
+void Insert(Map &map, uint64_t key, uint64_t *) {
+    map.insert_or_assign(key, key);
+}
+
+uint64_t ValueOf(const std::shared_ptr<StateObject> &value) { return value ? value->value : 0; }
+uint64_t ValueOf(uint64_t value) { return value; }
+
+struct Result {
+    double ns_per_lookup;
+    bool valid;
+};
+
+template <typename Map, typename T>
+Result Run(uint32_t reader_count, bool churn) {
+    Map map;
+    for (uint64_t i = 0; i < kStableKeys; ++i) {
+        Insert(map, MakeKey(i), static_cast<T *>(nullptr));
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread writer;
+    if (churn) {
+        writer = std::thread([&]() {
+            std::mt19937 rng(1);
+            while (!stop.load(std::memory_order_relaxed)) {
+                const uint64_t key = MakeKey(kStableKeys + rng() % kChurnKeys);
+                if (rng() % 2) {
+                    Insert(map, key, static_cast<T *>(nullptr));
+                } else {
+                    map.erase(key);
+                }
+            }
+        });
+    }
+
+    std::atomic<bool> valid{true};
+    std::vector<std::thread> readers;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < reader_count; ++t) {
+        readers.emplace_back([&map, &valid, t]() {
+            std::mt19937 rng(t + 2);
+            for (uint64_t i = 0; i < kLookupsPerThread; ++i) {
+                const uint64_t key = MakeKey(rng() % kStableKeys);
+                const auto found = map.find(key);
+                if (found == map.end() || ValueOf(found->second) != key) {
+                    valid.store(false, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto &reader : readers) reader.join();
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    stop.store(true);
+    if (writer.joinable()) writer.join();
+
+    // Each reader thread runs in parallel, so this is the average latency of a lookup as seen by one thread
+    return {elapsed / kLookupsPerThread, valid.load()};
+}
+
+bool Report(const char *name, const Result &striped, const Result &read_mostly) {
+    printf("  %-36s striped %8.1f ns  read-mostly %8.1f ns\n", name, striped.ns_per_lookup, read_mostly.ns_per_lookup);
+    if (!striped.valid || !read_mostly.valid) {
+        fprintf(stderr, "%s: a lookup of a live key failed\n", name);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const uint32_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    const uint32_t max_readers = (argc > 1) ? std::max(1, atoi(argv[1])) : std::min(16u, hardware_threads);
+
+    using SharedValue = std::shared_ptr<StateObject>;
+    using StripedStateMap = vl_concurrent_unordered_map<uint64_t, SharedValue, 6>;
+    using ReadMostlyStateMap = vl_concurrent_read_mostly_map<uint64_t, SharedValue, 6>;
+    using StripedIdMap = vl_concurrent_unordered_map<uint64_t, uint64_t, 4>;
+    using ReadMostlyIdMap = vl_concurrent_read_mostly_map<uint64_t, uint64_t, 4>;
+
+    int result = 0;
+    for (uint32_t readers = 1; readers <= max_readers; readers *= 2) {
+        for (int churn = 0; churn < 2; ++churn) {
+            printf("%u reader thread(s)%s\n", readers, churn ? ", one writer creating and destroying objects" : "");
+            if (!Report("state objects (shared_ptr values)", Run<StripedStateMap, SharedValue>(readers, churn != 0),
+                        Run<ReadMostlyStateMap, SharedValue>(readers, churn != 0))) {
+                result = 1;
+            }
+            if (!Report("wrapped handle IDs (uint64_t values)", Run<StripedIdMap, uint64_t>(readers, churn != 0),
+                        Run<ReadMostlyIdMap, uint64_t>(readers, churn != 0))) {
+                result = 1;
+            }
+        }
+    }
+    return result;
+}
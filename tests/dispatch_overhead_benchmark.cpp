@@ -0,0 +1,359 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Reports the per-call cost of vkCmdDraw, vkCmdBindDescriptorSets and vkCmdPipelineBarrier through the validation layer, on
+// the first physical device. Run with VK_LAYER_FINE_GRAINED_LOCKING=0 and =1 to compare dispatch with and without the
+// per-intercept locks. The recorded commands are valid, so any message the layer reports is printed and fails the run.
+//
+// Usage: dispatch_overhead_benchmark [calls per command]
+
+#include "lvt_function_pointers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace {
+
+// void main() {}, as a vertex shader. Without a fragment shader or attachments the draw needs no other resources.
+const uint32_t kVertexShader[] = {
+    0x07230203, 0x00010000, 0, 5, 0,                  // Header, id bound 5
+    0x00020011, 1,                                    // OpCapability Shader
+    0x0003000e, 0, 1,                                 // OpMemoryModel Logical GLSL450
+    0x0005000f, 0, 1, 0x6e69616d, 0,                  // OpEntryPoint Vertex %1 "main"
+    0x00020013, 2,                                    // %2 = OpTypeVoid
+    0x00030021, 3, 2,                                 // %3 = OpTypeFunction %2
+    0x00050036, 2, 1, 0, 3,                           // %1 = OpFunction %2 None %3
+    0x000200f8, 4,                                    // %4 = OpLabel
+    0x000100fd,                                       // OpReturn
+    0x00010038,                                       // OpFunctionEnd
+};
+
+std::atomic<uint32_t> message_count(0);
+
+VKAPI_ATTR VkBool32 VKAPI_CALL CountMessage(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                            const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *) {
+    fprintf(stderr, "%s\n", callback_data->pMessage);
+    ++message_count;
+    return VK_FALSE;
+}
+
+bool Check(VkResult result, const char *call) {
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "%s failed with %d\n", call, static_cast<int>(result));
+        return false;
+    }
+    return true;
+}
+
+double TimeCalls(uint32_t calls, const std::function<void()> &call) {
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < calls; ++i) {
+        call();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+}
+
+struct Objects {
+    VkDevice device = VK_NULL_HANDLE;
+    VkSampler sampler = VK_NULL_HANDLE;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkShaderModule shader = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkCommandPool command_pool = VK_NULL_HANDLE;
+
+    ~Objects() {
+        if (device == VK_NULL_HANDLE) return;
+        vk::DestroyCommandPool(device, command_pool, nullptr);
+        vk::DestroyPipeline(device, pipeline, nullptr);
+        vk::DestroyShaderModule(device, shader, nullptr);
+        vk::DestroyFramebuffer(device, framebuffer, nullptr);
+        vk::DestroyRenderPass(device, render_pass, nullptr);
+        vk::DestroyPipelineLayout(device, pipeline_layout, nullptr);
+        vk::DestroyDescriptorPool(device, descriptor_pool, nullptr);
+        vk::DestroyDescriptorSetLayout(device, set_layout, nullptr);
+        vk::DestroySampler(device, sampler, nullptr);
+    }
+};
+
+bool Run(VkPhysicalDevice gpu, VkDevice device, uint32_t queue_family, uint32_t calls) {
+    Objects objects;
+    objects.device = device;
+
+    VkSamplerCreateInfo sampler_ci = {};
+    sampler_ci.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    sampler_ci.magFilter = VK_FILTER_NEAREST;
+    sampler_ci.minFilter = VK_FILTER_NEAREST;
+    sampler_ci.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    sampler_ci.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_ci.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_ci.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_ci.maxLod = 1.0f;
+    if (!Check(vk::CreateSampler(device, &sampler_ci, nullptr, &objects.sampler), "vkCreateSampler")) return false;
+
+    // A sampler descriptor needs no memory behind it
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_SAMPLER, 1, VK_SHADER_STAGE_ALL, nullptr};
+    VkDescriptorSetLayoutCreateInfo set_layout_ci = {};
+    set_layout_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    set_layout_ci.bindingCount = 1;
+    set_layout_ci.pBindings = &binding;
+    if (!Check(vk::CreateDescriptorSetLayout(device, &set_layout_ci, nullptr, &objects.set_layout),
+               "vkCreateDescriptorSetLayout")) {
+        return false;
+    }
+
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_SAMPLER, 1};
+    VkDescriptorPoolCreateInfo pool_ci = {};
+    pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    pool_ci.maxSets = 1;
+    pool_ci.poolSizeCount = 1;
+    pool_ci.pPoolSizes = &pool_size;
+    if (!Check(vk::CreateDescriptorPool(device, &pool_ci, nullptr, &objects.descriptor_pool), "vkCreateDescriptorPool")) {
+        return false;
+    }
+
+    VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+    VkDescriptorSetAllocateInfo set_ai = {};
+    set_ai.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    set_ai.descriptorPool = objects.descriptor_pool;
+    set_ai.descriptorSetCount = 1;
+    set_ai.pSetLayouts = &objects.set_layout;
+    if (!Check(vk::AllocateDescriptorSets(device, &set_ai, &descriptor_set), "vkAllocateDescriptorSets")) return false;
+
+    VkDescriptorImageInfo image_info = {objects.sampler, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_UNDEFINED};
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = descriptor_set;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    write.pImageInfo = &image_info;
+    vk::UpdateDescriptorSets(device, 1, &write, 0, nullptr);
+
+    VkPipelineLayoutCreateInfo pipeline_layout_ci = {};
+    pipeline_layout_ci.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipeline_layout_ci.setLayoutCount = 1;
+    pipeline_layout_ci.pSetLayouts = &objects.set_layout;
+    if (!Check(vk::CreatePipelineLayout(device, &pipeline_layout_ci, nullptr, &objects.pipeline_layout),
+               "vkCreatePipelineLayout")) {
+        return false;
+    }
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo render_pass_ci = {};
+    render_pass_ci.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    render_pass_ci.subpassCount = 1;
+    render_pass_ci.pSubpasses = &subpass;
+    if (!Check(vk::CreateRenderPass(device, &render_pass_ci, nullptr, &objects.render_pass), "vkCreateRenderPass")) return false;
+
+    VkFramebufferCreateInfo framebuffer_ci = {};
+    framebuffer_ci.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebuffer_ci.renderPass = objects.render_pass;
+    framebuffer_ci.width = 32;
+    framebuffer_ci.height = 32;
+    framebuffer_ci.layers = 1;
+    if (!Check(vk::CreateFramebuffer(device, &framebuffer_ci, nullptr, &objects.framebuffer), "vkCreateFramebuffer")) {
+        return false;
+    }
+
+    VkShaderModuleCreateInfo shader_ci = {};
+    shader_ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    shader_ci.codeSize = sizeof(kVertexShader);
+    shader_ci.pCode = kVertexShader;
+    if (!Check(vk::CreateShaderModule(device, &shader_ci, nullptr, &objects.shader), "vkCreateShaderModule")) return false;
+
+    VkPipelineShaderStageCreateInfo stage = {};
+    stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stage.module = objects.shader;
+    stage.pName = "main";
+    VkPipelineVertexInputStateCreateInfo vertex_input = {};
+    vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+    input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkViewport viewport = {0.0f, 0.0f, 32.0f, 32.0f, 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {32, 32}};
+    VkPipelineViewportStateCreateInfo viewport_state = {};
+    viewport_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_state.viewportCount = 1;
+    viewport_state.pViewports = &viewport;
+    viewport_state.scissorCount = 1;
+    viewport_state.pScissors = &scissor;
+    VkPipelineRasterizationStateCreateInfo rasterization = {};
+    rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization.cullMode = VK_CULL_MODE_NONE;
+    rasterization.lineWidth = 1.0f;
+    VkPipelineMultisampleStateCreateInfo multisample = {};
+    multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkGraphicsPipelineCreateInfo pipeline_ci = {};
+    pipeline_ci.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipeline_ci.stageCount = 1;
+    pipeline_ci.pStages = &stage;
+    pipeline_ci.pVertexInputState = &vertex_input;
+    pipeline_ci.pInputAssemblyState = &input_assembly;
+    pipeline_ci.pViewportState = &viewport_state;
+    pipeline_ci.pRasterizationState = &rasterization;
+    pipeline_ci.pMultisampleState = &multisample;
+    pipeline_ci.layout = objects.pipeline_layout;
+    pipeline_ci.renderPass = objects.render_pass;
+    if (!Check(vk::CreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &objects.pipeline),
+               "vkCreateGraphicsPipelines")) {
+        return false;
+    }
+
+    VkCommandPoolCreateInfo command_pool_ci = {};
+    command_pool_ci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    command_pool_ci.queueFamilyIndex = queue_family;
+    if (!Check(vk::CreateCommandPool(device, &command_pool_ci, nullptr, &objects.command_pool), "vkCreateCommandPool")) {
+        return false;
+    }
+
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+    VkCommandBufferAllocateInfo cb_ai = {};
+    cb_ai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cb_ai.commandPool = objects.command_pool;
+    cb_ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cb_ai.commandBufferCount = 1;
+    if (!Check(vk::AllocateCommandBuffers(device, &cb_ai, &cb), "vkAllocateCommandBuffers")) return false;
+
+    VkMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    VkRenderPassBeginInfo render_pass_bi = {};
+    render_pass_bi.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    render_pass_bi.renderPass = objects.render_pass;
+    render_pass_bi.framebuffer = objects.framebuffer;
+    render_pass_bi.renderArea = scissor;
+
+    VkCommandBufferBeginInfo cb_bi = {};
+    cb_bi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    if (!Check(vk::BeginCommandBuffer(cb, &cb_bi), "vkBeginCommandBuffer")) return false;
+    const double barrier_ns = TimeCalls(calls, [&]() {
+        vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 1, &barrier, 0,
+                               nullptr, 0, nullptr);
+    });
+    vk::CmdBeginRenderPass(cb, &render_pass_bi, VK_SUBPASS_CONTENTS_INLINE);
+    vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, objects.pipeline);
+    const double bind_ns = TimeCalls(calls, [&]() {
+        vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, objects.pipeline_layout, 0, 1, &descriptor_set, 0,
+                                  nullptr);
+    });
+    const double draw_ns = TimeCalls(calls, [&]() { vk::CmdDraw(cb, 3, 1, 0, 0); });
+    vk::CmdEndRenderPass(cb);
+    if (!Check(vk::EndCommandBuffer(cb), "vkEndCommandBuffer")) return false;
+
+    VkPhysicalDeviceProperties properties;
+    vk::GetPhysicalDeviceProperties(gpu, &properties);
+    printf("%s, %u calls each\n", properties.deviceName, calls);
+    printf("vkCmdDraw %.1f ns/call, vkCmdBindDescriptorSets %.1f ns/call, vkCmdPipelineBarrier %.1f ns/call\n", draw_ns, bind_ns,
+           barrier_ns);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const uint32_t calls = (argc > 1) ? static_cast<uint32_t>(std::max(1, atoi(argv[1]))) : 10000;
+
+    vk::InitDispatchTable();
+
+    const char *layer = "VK_LAYER_KHRONOS_validation";
+    const char *extension = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
+    VkApplicationInfo app_info = {};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.pApplicationName = "dispatch_overhead_benchmark";
+    app_info.apiVersion = VK_API_VERSION_1_1;
+    VkInstanceCreateInfo instance_ci = {};
+    instance_ci.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_ci.pApplicationInfo = &app_info;
+    instance_ci.enabledLayerCount = 1;
+    instance_ci.ppEnabledLayerNames = &layer;
+    instance_ci.enabledExtensionCount = 1;
+    instance_ci.ppEnabledExtensionNames = &extension;
+    VkInstance instance = VK_NULL_HANDLE;
+    if (!Check(vk::CreateInstance(&instance_ci, nullptr, &instance), "vkCreateInstance")) return 1;
+
+    VkDebugUtilsMessengerCreateInfoEXT messenger_ci = {};
+    messenger_ci.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+    messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    messenger_ci.pfnUserCallback = CountMessage;
+    auto create_messenger = reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(
+        vk::GetInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT"));
+    auto destroy_messenger = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(
+        vk::GetInstanceProcAddr(instance, "vkDestroyDebugUtilsMessengerEXT"));
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    if (create_messenger) create_messenger(instance, &messenger_ci, nullptr, &messenger);
+
+    bool ran = false;
+    uint32_t gpu_count = 0;
+    vk::EnumeratePhysicalDevices(instance, &gpu_count, nullptr);
+    std::vector<VkPhysicalDevice> gpus(gpu_count);
+    if (gpu_count > 0 && Check(vk::EnumeratePhysicalDevices(instance, &gpu_count, gpus.data()), "vkEnumeratePhysicalDevices")) {
+        uint32_t family_count = 0;
+        vk::GetPhysicalDeviceQueueFamilyProperties(gpus[0], &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> families(family_count);
+        vk::GetPhysicalDeviceQueueFamilyProperties(gpus[0], &family_count, families.data());
+        const auto graphics = std::find_if(families.begin(), families.end(), [](const VkQueueFamilyProperties &family) {
+            return (family.queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0;
+        });
+        const auto queue_family = static_cast<uint32_t>(graphics - families.begin());
+
+        const float priority = 1.0f;
+        VkDeviceQueueCreateInfo queue_ci = {};
+        queue_ci.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queue_ci.queueFamilyIndex = queue_family;
+        queue_ci.queueCount = 1;
+        queue_ci.pQueuePriorities = &priority;
+        VkDeviceCreateInfo device_ci = {};
+        device_ci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        device_ci.queueCreateInfoCount = 1;
+        device_ci.pQueueCreateInfos = &queue_ci;
+        VkDevice device = VK_NULL_HANDLE;
+        if (graphics == families.end()) {
+            fprintf(stderr, "The first physical device has no graphics queue\n");
+        } else if (Check(vk::CreateDevice(gpus[0], &device_ci, nullptr, &device), "vkCreateDevice")) {
+            ran = Run(gpus[0], device, queue_family, calls);
+            vk::DestroyDevice(device, nullptr);
+        }
+    } else {
+        fprintf(stderr, "No physical devices\n");
+    }
+
+    if (destroy_messenger && messenger != VK_NULL_HANDLE) destroy_messenger(instance, messenger, nullptr);
+    vk::DestroyInstance(instance, nullptr);
+
+    if (message_count > 0) {
+        fprintf(stderr, "The layer reported %u messages for valid commands\n", message_count.load());
+        return 1;
+    }
+    return ran ? 0 : 1;
+}
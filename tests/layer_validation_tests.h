@@ -317,6 +317,20 @@ class VkWsiEnabledLayerTest : public VkLayerTest {
     VkWsiEnabledLayerTest() { m_enableWSI = true; }
 };
 
+// GPU-AV and Debug Printf settings, passed to the layer through VkLayerSettingsEXT when the framework is initialized
+class GpuLayerSettings {
+  public:
+    void SetBool(const char *name, bool value);
+    void SetString(const char *name, const char *value);
+    // The VkLayerSettingsEXT to chain to the instance create info, or null if nothing was set
+    void *pnext();
+
+  private:
+    std::vector<VkLayerSettingValueEXT> values_;
+    std::vector<std::string> strings_;  // Per value, the data of string values
+    VkLayerSettingsEXT settings_{};
+};
+
 class VkGpuAssistedLayerTest : public VkLayerTest {
   public:
     bool InitGpuAssistedFramework(bool request_descriptor_indexing);
@@ -324,6 +338,7 @@ class VkGpuAssistedLayerTest : public VkLayerTest {
                               VkDescriptorType descriptor_type, const char *fragment_shader, const char *expected_error);
 
   protected:
+    GpuLayerSettings gpu_settings_;
 };
 
 class VkDebugPrintfTest : public VkLayerTest {
@@ -331,6 +346,7 @@ class VkDebugPrintfTest : public VkLayerTest {
     void InitDebugPrintfFramework();
 
   protected:
+    GpuLayerSettings gpu_settings_;
 };
 
 class VkSyncValTest : public VkLayerTest {
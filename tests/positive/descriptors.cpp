@@ -1509,3 +1509,55 @@ TEST_F(VkPositiveLayerTest, MultipleThreadsUsingHostOnlyDescriptorSet) {
 
     m_errorMonitor->VerifyNotFound();
 }
+
+TEST_F(VkPositiveLayerTest, DescriptorUpdatesWhileOtherObjectsAreDestroyed) {
+    TEST_DESCRIPTION(
+        "Update descriptor sets on several threads while another thread creates and destroys unrelated buffers, so state "
+        "objects are removed from the state maps while descriptor update validation holds borrowed references");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    m_errorMonitor->ExpectSuccess();
+
+    constexpr uint32_t kUpdateThreads = 4;
+    constexpr uint32_t kIterations = 200;
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    std::vector<std::unique_ptr<OneOffDescriptorSet>> descriptor_sets;
+    for (uint32_t i = 0; i < kUpdateThreads; ++i) {
+        descriptor_sets.emplace_back(new OneOffDescriptorSet(
+            m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}}));
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread churn_thread([&]() {
+        auto buffer_ci = VkBufferObj::create_info(64, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+        while (!stop.load()) {
+            VkBuffer churn_buffer = VK_NULL_HANDLE;
+            vk::CreateBuffer(m_device->device(), &buffer_ci, nullptr, &churn_buffer);
+            vk::DestroyBuffer(m_device->device(), churn_buffer, nullptr);
+        }
+    });
+
+    std::vector<std::thread> update_threads;
+    for (uint32_t t = 0; t < kUpdateThreads; ++t) {
+        update_threads.emplace_back([&, t]() {
+            VkDescriptorBufferInfo buffer_info = {buffer.handle(), 0, VK_WHOLE_SIZE};
+            VkWriteDescriptorSet descriptor_write = LvlInitStruct<VkWriteDescriptorSet>();
+            descriptor_write.dstSet = descriptor_sets[t]->set_;
+            descriptor_write.dstBinding = 0;
+            descriptor_write.descriptorCount = 1;
+            descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            descriptor_write.pBufferInfo = &buffer_info;
+            for (uint32_t i = 0; i < kIterations; ++i) {
+                vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, nullptr);
+            }
+        });
+    }
+    for (auto &t : update_threads) t.join();
+    stop = true;
+    churn_thread.join();
+
+    m_errorMonitor->VerifyNotFound();
+}
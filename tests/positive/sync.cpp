@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -1741,6 +1742,64 @@ TEST_F(VkPositiveLayerTest, ThreadNullFenceCollision) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkPositiveLayerTest, ThreadSafetyTrackingOverhead) {
+    TEST_DESCRIPTION(
+        "Record vkCmdBindDescriptorSets with shared objects from several threads while another thread creates and destroys "
+        "buffers, and report the per-call cost. Run with VK_LAYER_THREAD_SAFETY_SAMPLE_PERIOD or with thread safety disabled "
+        "to compare.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    m_errorMonitor->ExpectSuccess();
+
+    constexpr uint32_t kThreads = 4;
+    constexpr uint32_t kCalls = 20000;
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE);
+    descriptor_set.UpdateDescriptorSets();
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    std::atomic<bool> stop{false};
+    std::thread churn([&]() {
+        const auto buffer_ci = VkBufferObj::create_info(256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+        while (!stop.load()) {
+            VkBuffer churn_buffer = VK_NULL_HANDLE;
+            vk::CreateBuffer(device(), &buffer_ci, nullptr, &churn_buffer);
+            vk::DestroyBuffer(device(), churn_buffer, nullptr);
+        }
+    });
+
+    std::vector<double> ns_per_call(kThreads);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            VkCommandPoolObj pool(m_device, m_device->graphics_queue_node_index_);
+            VkCommandBufferObj cb(m_device, &pool);
+            cb.begin();
+            const auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < kCalls; ++i) {
+                vk::CmdBindDescriptorSets(cb.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                          &descriptor_set.set_, 0, nullptr);
+            }
+            ns_per_call[t] =
+                std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kCalls;
+            cb.end();
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    stop.store(true);
+    churn.join();
+
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        printf("thread %u: vkCmdBindDescriptorSets %.1f ns/call\n", t, ns_per_call[t]);
+    }
+    m_errorMonitor->VerifyNotFound();
+}
+
 // This is a positive test.  No errors should be generated.
 TEST_F(VkPositiveLayerTest, WaitEventThenSet) {
     TEST_DESCRIPTION("Wait on a event then set it after the wait has been submitted.");
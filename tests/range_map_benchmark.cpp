@@ -0,0 +1,681 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the std::map and flat_range_map backends of sparse_container::range_map on the access patterns synchronization
+// validation applies to its ResourceAccessRangeMaps, and checks both backends produce the same maps.
+//
+// Usage: range_map_benchmark [repeat count]
+
+#include "range_vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <vector>
+
+namespace sparse_container {
+
+// A sorted array based ordered map for range keys for use as the range map "ImplMap" as an alternate to std::map. It is only
+// used here, to compare against the std::map backend the layer uses.
+//
+// The keys are kept in sorted arrays of at most ChunkSize entries, themselves kept in sorted order (i.e. a two level B+tree),
+// s.t. lower_bound is a pair of binary searches and in order walks are linear, while the values are placed in nodes taken from
+// pooled blocks. Node addresses are stable, so as with std::map, iterators are only invalidated by erasing the entry they refer
+// to. Iterators hold a hint of their position in the key arrays, revalidated (with a search fallback) when stepping, as inserts
+// and erases shift the arrays.
+template <typename Key, typename T, typename RangeKey = range<Key>, size_t ChunkSize = 32>
+class flat_range_map {
+  public:
+    using mapped_type = T;
+    using key_type = RangeKey;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using index_type = typename key_type::index_type;
+    using size_type = size_t;
+
+  private:
+    static constexpr size_type kMinNodesPerBlock = 16;
+    // Spare chunk storage kept past erase and clear, enough to refill a map of several hundred entries
+    static constexpr size_type kMaxSpareChunks = 16;
+
+    // Used for placement new of value_type, and linking of the free list when not in use
+    struct Node {
+        union {
+            alignas(alignof(value_type)) uint8_t data[sizeof(value_type)];
+            Node *next_free;
+        };
+        value_type *get() { return reinterpret_cast<value_type *>(data); }
+        const value_type *get() const { return reinterpret_cast<const value_type *>(data); }
+    };
+    struct Entry {
+        key_type key;
+        Node *node;
+        Entry(const key_type &key_, Node *node_) : key(key_), node(node_) {}
+    };
+    struct EntryLess {
+        bool operator()(const Entry &entry, const key_type &key) const { return entry.key < key; }
+        bool operator()(const key_type &key, const Entry &entry) const { return key < entry.key; }
+    };
+    using Chunk = std::vector<Entry>;
+    // Chunks are never empty, and end() is { chunks_.size(), 0 }
+    struct Position {
+        size_type chunk;
+        size_type index;
+    };
+
+  public:
+    template <typename Map_, typename Value_>
+    struct IteratorImpl {
+      public:
+        using Map = Map_;
+        using Value = Value_;
+        friend flat_range_map;
+        Value *operator->() const { return node_->get(); }
+        Value &operator*() const { return *node_->get(); }
+        IteratorImpl &operator++() {
+            pos_ = map_->next(map_->position_of(node_, pos_));
+            node_ = map_->node_at(pos_);
+            return *this;
+        }
+        IteratorImpl &operator--() {
+            // Decrementing end() gives the last entry
+            pos_ = map_->prev(node_ ? map_->position_of(node_, pos_) : map_->end_position());
+            node_ = map_->node_at(pos_);
+            return *this;
+        }
+        // All ends are equal
+        bool operator==(const IteratorImpl &other) const { return node_ == other.node_; }
+        bool operator!=(const IteratorImpl &other) const { return node_ != other.node_; }
+
+        // At end()
+        IteratorImpl() : map_(nullptr), node_(nullptr), pos_{0, 0} {}
+
+        // Raw getters to allow for const_iterator conversion below
+        Map *get_map() const { return map_; }
+        Node *get_node() const { return node_; }
+        Position get_position() const { return pos_; }
+
+      protected:
+        IteratorImpl(Map *map, Node *node, const Position &pos) : map_(map), node_(node), pos_(pos) {}
+
+      private:
+        Map *map_;
+        Node *node_;    // nullptr at end()
+        Position pos_;  // hint for the position of node_ in the key arrays
+    };
+    using iterator = IteratorImpl<flat_range_map, value_type>;
+
+    // The const iterator must be derived to allow the conversion from iterator, which iterator doesn't support
+    class const_iterator : public IteratorImpl<const flat_range_map, const value_type> {
+        using Base = IteratorImpl<const flat_range_map, const value_type>;
+        friend flat_range_map;
+
+      public:
+        const_iterator(const iterator &it) : Base(it.get_map(), it.get_node(), it.get_position()) {}
+        const_iterator() : Base() {}
+
+      private:
+        const_iterator(const flat_range_map *map, Node *node, const Position &pos) : Base(map, node, pos) {}
+    };
+
+    flat_range_map() : chunks_(), spare_chunks_(), size_(0), blocks_(), free_list_(nullptr) {}
+    flat_range_map(const flat_range_map &other) : flat_range_map() { copy_from(other); }
+    flat_range_map(flat_range_map &&other) : flat_range_map() { swap(other); }
+    flat_range_map &operator=(const flat_range_map &other) {
+        if (this != &other) {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+    flat_range_map &operator=(flat_range_map &&other) {
+        swap(other);
+        return *this;
+    }
+    ~flat_range_map() { clear(); }
+
+    void swap(flat_range_map &other) {
+        chunks_.swap(other.chunks_);
+        spare_chunks_.swap(other.spare_chunks_);
+        std::swap(size_, other.size_);
+        blocks_.swap(other.blocks_);
+        std::swap(free_list_, other.free_list_);
+    }
+
+    iterator begin() { return make_iterator(Position{0, 0}); }
+    const_iterator cbegin() const { return make_const_iterator(Position{0, 0}); }
+    const_iterator begin() const { return cbegin(); }
+    iterator end() { return iterator(this, nullptr, end_position()); }
+    const_iterator cend() const { return const_iterator(this, nullptr, end_position()); }
+    const_iterator end() const { return cend(); }
+
+    size_type size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear() {
+        // The node blocks and some of the chunk storage are kept for reuse, s.t. refilling a cleared map allocates less
+        for (auto &chunk : chunks_) {
+            for (const auto &entry : chunk) {
+                free_node(entry.node);
+            }
+            release_chunk(std::move(chunk));
+        }
+        chunks_.clear();
+        size_ = 0;
+    }
+
+    iterator lower_bound(const key_type &key) { return make_iterator(lower_position(key)); }
+    const_iterator lower_bound(const key_type &key) const { return make_const_iterator(lower_position(key)); }
+    iterator upper_bound(const key_type &key) { return make_iterator(upper_position(key)); }
+    const_iterator upper_bound(const key_type &key) const { return make_const_iterator(upper_position(key)); }
+
+    // Find entry with an exact key match
+    iterator find(const key_type &key) {
+        const Position pos = lower_position(key);
+        return is_match(pos, key) ? make_iterator(pos) : end();
+    }
+    const_iterator find(const key_type &key) const {
+        const Position pos = lower_position(key);
+        return is_match(pos, key) ? make_const_iterator(pos) : cend();
+    }
+
+    iterator erase(const_iterator it) {
+        RANGE_ASSERT(it.get_node());
+        Position pos = position_of(it.get_node(), it.get_position());
+        Chunk &chunk = chunks_[pos.chunk];
+        free_node(chunk[pos.index].node);
+        chunk.erase(chunk.begin() + pos.index);
+        --size_;
+        if (chunk.empty()) {
+            release_chunk(std::move(chunk));
+            chunks_.erase(chunks_.begin() + pos.chunk);
+            pos.index = 0;
+        } else if (pos.index == chunk.size()) {
+            pos = Position{pos.chunk + 1, 0};
+        }
+        return make_iterator(pos);
+    }
+    iterator erase(iterator it) { return erase(const_iterator(it)); }
+
+    // Must be called with rvalue or lvalue of value_type. As with std::map, doesn't replace an existing entry for the key.
+    template <typename Value>
+    iterator emplace_hint(const_iterator hint, Value &&value) {
+        Node *node = alloc_node();
+        new (node->data) value_type(std::forward<Value>(value));
+        const key_type &key = node->get()->first;
+
+        // Check the hint is the insertion point, i.e. key is between hint and the entry before it
+        Position pos = hint.get_node() ? position_of(hint.get_node(), hint.get_position()) : end_position();
+        const bool before_hint = (pos.chunk == chunks_.size()) || (key < entry_at(pos).key);
+        const bool after_prev = ((pos.chunk == 0) && (pos.index == 0)) || (entry_at(prev(pos)).key < key);
+        if (!(before_hint && after_prev)) {
+            pos = lower_position(key);
+            if (is_match(pos, key)) {
+                free_node(node);
+                return make_iterator(pos);
+            }
+        }
+        return iterator(this, node, insert_at(pos, Entry(key, node)));
+    }
+
+    template <typename Value>
+    iterator emplace(Value &&value) {
+        return emplace_hint(cend(), std::forward<Value>(value));
+    }
+    iterator insert(const_iterator hint, const value_type &value) { return emplace_hint(hint, value); }
+    std::pair<iterator, bool> insert(const value_type &value) {
+        const Position pos = lower_position(value.first);
+        if (is_match(pos, value.first)) return std::make_pair(make_iterator(pos), false);
+        return std::make_pair(emplace_hint(make_const_iterator(pos), value), true);
+    }
+
+  protected:
+    Position end_position() const { return Position{chunks_.size(), 0}; }
+    const Entry &entry_at(const Position &pos) const { return chunks_[pos.chunk][pos.index]; }
+    Node *node_at(const Position &pos) const { return (pos.chunk < chunks_.size()) ? entry_at(pos).node : nullptr; }
+    Position next(const Position &pos) const {
+        return (pos.index + 1 < chunks_[pos.chunk].size()) ? Position{pos.chunk, pos.index + 1} : Position{pos.chunk + 1, 0};
+    }
+    Position prev(const Position &pos) const {
+        return (pos.index > 0) ? Position{pos.chunk, pos.index - 1} : Position{pos.chunk - 1, chunks_[pos.chunk - 1].size() - 1};
+    }
+
+    // The first chunk with a last key not less than key (for lower) or greater than key (for upper) holds the bound, if any
+    Position lower_position(const key_type &key) const {
+        const auto chunk = std::lower_bound(chunks_.cbegin(), chunks_.cend(), key,
+                                            [](const Chunk &c, const key_type &k) { return c.back().key < k; });
+        if (chunk == chunks_.cend()) return end_position();
+        const auto entry = std::lower_bound(chunk->cbegin(), chunk->cend(), key, EntryLess());
+        return Position{static_cast<size_type>(chunk - chunks_.cbegin()), static_cast<size_type>(entry - chunk->cbegin())};
+    }
+    Position upper_position(const key_type &key) const {
+        const auto chunk = std::upper_bound(chunks_.cbegin(), chunks_.cend(), key,
+                                            [](const key_type &k, const Chunk &c) { return k < c.back().key; });
+        if (chunk == chunks_.cend()) return end_position();
+        const auto entry = std::upper_bound(chunk->cbegin(), chunk->cend(), key, EntryLess());
+        return Position{static_cast<size_type>(chunk - chunks_.cbegin()), static_cast<size_type>(entry - chunk->cbegin())};
+    }
+    bool is_match(const Position &pos, const key_type &key) const {
+        return (pos.chunk < chunks_.size()) && !(key < entry_at(pos).key) && !(entry_at(pos).key < key);
+    }
+
+    // The current position of node, using the iterator's hint if it's still correct
+    Position position_of(const Node *node, const Position &hint) const {
+        if ((hint.chunk < chunks_.size()) && (hint.index < chunks_[hint.chunk].size()) && (entry_at(hint).node == node)) {
+            return hint;
+        }
+        const Position pos = lower_position(node->get()->first);
+        RANGE_ASSERT(node_at(pos) == node);
+        return pos;
+    }
+
+    // Insert before pos, splitting the chunk in two when full. Returns the position of the inserted entry.
+    Position insert_at(Position pos, const Entry &entry) {
+        ++size_;
+        if (pos.chunk == chunks_.size()) {
+            // Append to the last chunk, unless it's full
+            if (chunks_.empty() || (chunks_.back().size() == ChunkSize)) {
+                chunks_.emplace_back(new_chunk());
+            }
+            pos = Position{chunks_.size() - 1, chunks_.back().size()};
+        } else if (chunks_[pos.chunk].size() == ChunkSize) {
+            const size_type half = ChunkSize / 2;
+            chunks_.emplace(chunks_.begin() + pos.chunk + 1, new_chunk());
+            Chunk &lower = chunks_[pos.chunk];
+            Chunk &upper = chunks_[pos.chunk + 1];
+            upper.assign(lower.cbegin() + half, lower.cend());
+            lower.erase(lower.begin() + half, lower.end());
+            if (pos.index > half) {
+                pos = Position{pos.chunk + 1, pos.index - half};
+            }
+        }
+        Chunk &chunk = chunks_[pos.chunk];
+        chunk.insert(chunk.begin() + pos.index, entry);
+        return pos;
+    }
+
+    // An empty chunk with room for ChunkSize entries, recycled from those released by erase and clear when possible
+    Chunk new_chunk() {
+        Chunk chunk;
+        if (spare_chunks_.empty()) {
+            chunk.reserve(ChunkSize);
+        } else {
+            chunk.swap(spare_chunks_.back());
+            spare_chunks_.pop_back();
+        }
+        return chunk;
+    }
+    void release_chunk(Chunk &&chunk) {
+        if (spare_chunks_.size() < kMaxSpareChunks) {
+            chunk.clear();
+            spare_chunks_.emplace_back(std::move(chunk));
+        }
+    }
+
+    iterator make_iterator(const Position &pos) { return iterator(this, node_at(pos), pos); }
+    const_iterator make_const_iterator(const Position &pos) const { return const_iterator(this, node_at(pos), pos); }
+
+    Node *alloc_node() {
+        if (!free_list_) {
+            // Grow geometrically, s.t. the block count is logarithmic in the map size
+            const size_type block_size = std::max(static_cast<size_type>(kMinNodesPerBlock), size_);
+            blocks_.emplace_back(new Node[block_size]);
+            Node *block = blocks_.back().get();
+            for (size_type i = 0; i < block_size; ++i) {
+                block[i].next_free = free_list_;
+                free_list_ = &block[i];
+            }
+        }
+        Node *node = free_list_;
+        free_list_ = node->next_free;
+        return node;
+    }
+    void free_node(Node *node) {
+        node->get()->~value_type();
+        node->next_free = free_list_;
+        free_list_ = node;
+    }
+    void copy_from(const flat_range_map &other) {
+        chunks_.reserve(other.chunks_.size());
+        for (const auto &other_chunk : other.chunks_) {
+            chunks_.emplace_back(new_chunk());
+            for (const auto &entry : other_chunk) {
+                Node *node = alloc_node();
+                new (node->data) value_type(*entry.node->get());
+                chunks_.back().emplace_back(entry.key, node);
+                ++size_;
+            }
+        }
+    }
+
+    template <typename Map_, typename Value_>
+    friend struct IteratorImpl;
+    std::vector<Chunk> chunks_;
+    std::vector<Chunk> spare_chunks_;
+    size_type size_;
+    std::vector<std::unique_ptr<Node[]>> blocks_;
+    Node *free_list_;
+};
+
+}  // namespace sparse_container
+
+namespace {
+
+// Stand-in for ResourceAccessState, with a similar footprint so copies and moves cost about the same
+struct AccessState {
+    uint64_t write_tag = 0;
+    uint64_t read_tags[24] = {};
+    uint32_t read_count = 0;
+
+    void Update(uint64_t tag, bool is_write) {
+        if (is_write) {
+            write_tag = tag;
+            read_count = 0;
+        } else {
+            read_tags[read_count % 24] = tag;
+            ++read_count;
+        }
+    }
+    void Resolve(const AccessState &other) {
+        if (other.write_tag > write_tag) {
+            *this = other;
+        } else if (other.write_tag == write_tag) {
+            read_count = std::max(read_count, other.read_count);
+        }
+    }
+    bool operator==(const AccessState &rhs) const {
+        return (write_tag == rhs.write_tag) && (read_count == rhs.read_count) &&
+               std::equal(std::begin(read_tags), std::end(read_tags), std::begin(rhs.read_tags));
+    }
+    bool operator!=(const AccessState &rhs) const { return !(*this == rhs); }
+};
+
+using Range = sparse_container::range<uint64_t>;
+using StdMap = sparse_container::range_map<uint64_t, AccessState>;
+using FlatMap = sparse_container::range_map<uint64_t, AccessState, Range, sparse_container::flat_range_map<uint64_t, AccessState>>;
+
+// The operations of a synthetic command buffer recording: a set of buffers and images bound into one address space, accessed
+// either as a whole, as sub-ranges, or (for images) as a strided set of subresource ranges.
+struct Access {
+    std::vector<Range> ranges;
+    bool is_write;
+};
+
+std::vector<Access> MakeAccesses(uint32_t seed, uint32_t resource_count, uint32_t access_count) {
+    std::mt19937 rng(seed);
+    struct Resource {
+        uint64_t base;
+        uint64_t size;
+        uint32_t layers;  // Zero for buffers
+    };
+    std::vector<Resource> resources;
+    uint64_t base = 0;
+    for (uint32_t i = 0; i < resource_count; ++i) {
+        Resource resource;
+        resource.base = base;
+        resource.layers = (rng() % 3 == 0) ? (1 + rng() % 8) : 0;
+        resource.size = resource.layers ? resource.layers * (uint64_t(1) << (12 + rng() % 6)) : (256 << (rng() % 12));
+        resources.push_back(resource);
+        base += resource.size + 256 * (rng() % 4);  // Leave some gaps between bindings
+    }
+
+    std::vector<Access> accesses;
+    for (uint32_t i = 0; i < access_count; ++i) {
+        const Resource &resource = resources[rng() % resources.size()];
+        Access access;
+        access.is_write = (rng() % 3) == 0;
+        if (resource.layers) {
+            const uint64_t layer_size = resource.size / resource.layers;
+            const uint32_t first_layer = rng() % resource.layers;
+            const uint32_t layer_count = 1 + rng() % (resource.layers - first_layer);
+            const uint64_t row_size = layer_size / 16;
+            const bool full_rows = (rng() % 2) == 0;
+            for (uint32_t layer = first_layer; layer < first_layer + layer_count; ++layer) {
+                const uint64_t layer_base = resource.base + layer * layer_size;
+                if (full_rows) {
+                    access.ranges.emplace_back(layer_base, layer_base + layer_size);
+                } else {
+                    // A sub-rectangle of the subresource, one range per row
+                    for (uint64_t row = 4; row < 12; ++row) {
+                        access.ranges.emplace_back(layer_base + row * row_size + row_size / 4,
+                                                   layer_base + row * row_size + 3 * row_size / 4);
+                    }
+                }
+            }
+        } else if (rng() % 2) {
+            access.ranges.emplace_back(resource.base, resource.base + resource.size);
+        } else {
+            const uint64_t offset = (rng() % resource.size) & ~uint64_t(3);
+            const uint64_t size = 4 + ((rng() % (resource.size - offset)) & ~uint64_t(3));
+            const uint64_t end = std::min(resource.base + resource.size, resource.base + offset + size);
+            access.ranges.emplace_back(resource.base + offset, end);
+        }
+        accesses.push_back(access);
+    }
+    return accesses;
+}
+
+// Modeled on UpdateMemoryAccessState in synchronization_validation.cpp
+template <typename Map>
+void UpdateAccess(Map &accesses, const Range &range, uint64_t tag, bool is_write) {
+    AccessState default_state;
+    auto pos = accesses.lower_bound(range);
+    if (pos == accesses.end() || !pos->first.intersects(range)) {
+        pos = accesses.insert(pos, std::make_pair(range, default_state));
+    } else if (range.begin < pos->first.begin) {
+        pos = accesses.insert(pos, std::make_pair(Range(range.begin, pos->first.begin), default_state));
+    } else if (pos->first.begin < range.begin) {
+        pos = accesses.split(pos, range.begin, sparse_container::split_op_keep_both());
+        ++pos;
+    }
+
+    const auto the_end = accesses.end();
+    while ((pos != the_end) && pos->first.intersects(range)) {
+        if (pos->first.end > range.end) {
+            pos = accesses.split(pos, range.end, sparse_container::split_op_keep_both());
+        }
+        pos->second.Update(tag, is_write);
+        auto next = pos;
+        ++next;
+        if ((pos->first.end < range.end) && (next != the_end) && !next->first.is_subsequent_to(pos->first)) {
+            const Range new_range(pos->first.end, std::min(range.end, next->first.begin));
+            next = accesses.insert(next, std::make_pair(new_range, default_state));
+        } else if ((pos->first.end < range.end) && (next == the_end)) {
+            next = accesses.insert(next, std::make_pair(Range(pos->first.end, range.end), default_state));
+        }
+        pos = next;
+    }
+}
+
+template <typename Map>
+void Record(Map &accesses, const std::vector<Access> &recording, uint64_t first_tag) {
+    uint64_t tag = first_tag;
+    for (const auto &access : recording) {
+        for (const auto &range : access.ranges) {
+            UpdateAccess(accesses, range, tag, access.is_write);
+        }
+        ++tag;
+    }
+}
+
+// Modeled on AccessContext::ResolveAccessRange, without the recursion to previous contexts
+template <typename Map>
+void Resolve(Map &resolve_map, const Map &from, const Range &range) {
+    using MergeIterator = sparse_container::parallel_iterator<Map, const Map>;
+    MergeIterator current(resolve_map, from, range.begin);
+    while (current->range.non_empty() && range.includes(current->range.begin)) {
+        const auto current_range = current->range & range;
+        if (current->pos_B->valid) {
+            const auto &access = current->pos_B->lower_bound->second;
+            if (current->pos_A->valid) {
+                const auto trimmed = sparse_container::split(current->pos_A->lower_bound, resolve_map, current_range);
+                trimmed->second.Resolve(access);
+                current.invalidate_A(trimmed);
+            } else {
+                auto inserted = resolve_map.insert(current->pos_A->lower_bound, std::make_pair(current_range, access));
+                current.invalidate_A(inserted);
+            }
+        }
+        if (current->range.non_empty()) {
+            ++current;
+        }
+    }
+}
+
+template <typename MapA, typename MapB>
+bool Equal(const MapA &a, const MapB &b) {
+    if (a.size() != b.size()) return false;
+    auto b_it = b.cbegin();
+    for (const auto &entry : a) {
+        if ((entry.first != b_it->first) || (entry.second != b_it->second)) return false;
+        ++b_it;
+    }
+    return true;
+}
+
+struct Timer {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    double Elapsed() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+struct Workload {
+    const char *name;
+    uint32_t resource_count;
+    uint32_t access_count;
+    uint32_t recording_count;
+};
+
+struct Results {
+    double record = 0.0;
+    double splice = 0.0;
+    double infill = 0.0;
+    double resolve = 0.0;
+    size_t entries = 0;
+};
+
+template <typename Map>
+Results Run(const std::vector<std::vector<Access>> &recordings, const Range &address_space, std::vector<Map> *out_maps) {
+    Results results;
+    std::vector<Map> recorded(recordings.size());
+    Timer record_timer;
+    for (size_t i = 0; i < recordings.size(); ++i) {
+        Record(recorded[i], recordings[i], i * recordings[i].size());
+    }
+    results.record = record_timer.Elapsed();
+
+    // QueueSubmit style import of each command buffer's accesses into the queue's map
+    Map queue_map;
+    Timer splice_timer;
+    for (const auto &map : recorded) {
+        sparse_container::splice(queue_map, map, sparse_container::value_precedence::prefer_source);
+    }
+    results.splice = splice_timer.Elapsed();
+
+    // ResolvePreviousAccess style infill of the unrecorded gaps with a default state
+    Map infill_map = queue_map;
+    Timer infill_timer;
+    for (uint64_t begin = address_space.begin; begin < address_space.end; begin += address_space.distance() / 64) {
+        const Range range(begin, std::min(address_space.end, begin + address_space.distance() / 32));
+        sparse_container::update_range_value(infill_map, range, AccessState(), sparse_container::value_precedence::prefer_dest);
+    }
+    results.infill = infill_timer.Elapsed();
+
+    // Subpass and secondary command buffer style resolve of each context into a common one
+    Map resolve_map;
+    Timer resolve_timer;
+    for (const auto &map : recorded) {
+        Resolve(resolve_map, map, address_space);
+    }
+    results.resolve = resolve_timer.Elapsed();
+
+    results.entries = queue_map.size() + infill_map.size() + resolve_map.size();
+    out_maps->clear();
+    out_maps->push_back(std::move(queue_map));
+    out_maps->push_back(std::move(infill_map));
+    out_maps->push_back(std::move(resolve_map));
+    for (auto &map : recorded) out_maps->push_back(std::move(map));
+    return results;
+}
+
+void Accumulate(Results &total, const Results &results) {
+    total.record += results.record;
+    total.splice += results.splice;
+    total.infill += results.infill;
+    total.resolve += results.resolve;
+    total.entries = results.entries;
+}
+
+void Print(const char *backend, const Results &results) {
+    printf("  %-16s record %9.2f ms  splice %9.2f ms  infill %9.2f ms  resolve %9.2f ms  (%zu entries)\n", backend,
+           results.record, results.splice, results.infill, results.resolve, results.entries);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const int repeat = (argc > 1) ? std::max(1, atoi(argv[1])) : 5;
+    const Workload workloads[] = {
+        {"small command buffers", 16, 64, 256},
+        {"typical frame", 256, 1024, 32},
+        {"large frame", 2048, 8192, 8},
+    };
+
+    int result = 0;
+    for (const auto &workload : workloads) {
+        std::vector<std::vector<Access>> recordings;
+        uint64_t address_end = 0;
+        for (uint32_t i = 0; i < workload.recording_count; ++i) {
+            recordings.push_back(MakeAccesses(1, workload.resource_count, workload.access_count));
+            // Each recording uses a different subset of the accesses, from the same set of resources
+            std::shuffle(recordings.back().begin(), recordings.back().end(), std::mt19937(i));
+            recordings.back().resize(workload.access_count / 2);
+        }
+        for (const auto &recording : recordings) {
+            for (const auto &access : recording) {
+                for (const auto &range : access.ranges) address_end = std::max(address_end, range.end);
+            }
+        }
+        const Range address_space(0, address_end);
+
+        Results std_total;
+        Results flat_total;
+        for (int i = 0; i < repeat; ++i) {
+            std::vector<StdMap> std_maps;
+            std::vector<FlatMap> flat_maps;
+            Accumulate(std_total, Run(recordings, address_space, &std_maps));
+            Accumulate(flat_total, Run(recordings, address_space, &flat_maps));
+            for (size_t map = 0; map < std_maps.size(); ++map) {
+                if (!Equal(std_maps[map], flat_maps[map])) {
+                    fprintf(stderr, "%s: backends differ in map %zu\n", workload.name, map);
+                    result = 1;
+                    break;
+                }
+            }
+        }
+        printf("%s (%u resources, %u recordings of %u accesses, %d repeats)\n", workload.name, workload.resource_count,
+               workload.recording_count, workload.access_count / 2, repeat);
+        Print("std::map", std_total);
+        Print("flat_range_map", flat_total);
+    }
+    return result;
+}
@@ -0,0 +1,203 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures what the SPIRV-Tools objects the layers set up per shader module cost, compared to reusing them per thread as
+// GetThreadSpirvContext() and PreprocessShaderBinary() do: a spv_context for spvValidateWithOptions, and an optimizer
+// running the decoration flattening pass. Modules of several sizes are generated and validated (or flattened) by one or
+// more threads, once creating the object for every module and once with an object created up front by each thread.
+//
+// Usage: spirv_context_benchmark [max threads]
+
+#include "spirv-tools/libspirv.h"
+#include "spirv-tools/optimizer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const spv_target_env kEnv = SPV_ENV_VULKAN_1_0;
+const uint32_t kModulesPerThread = 200;
+
+// A compute shader reading and writing variable_count private variables. With grouped set, the variables are decorated
+// through a decoration group, which is what makes the layers run the flattening pass.
+std::string MakeModuleText(uint32_t variable_count, bool grouped) {
+    std::string text =
+        "OpCapability Shader\n"
+        "OpMemoryModel Logical GLSL450\n"
+        "OpEntryPoint GLCompute %main \"main\"\n"
+        "OpExecutionMode %main LocalSize 1 1 1\n";
+    if (grouped) {
+        text += "OpDecorate %group RelaxedPrecision\n%group = OpDecorationGroup\nOpGroupDecorate %group";
+        for (uint32_t i = 0; i < variable_count; ++i) text += " %v" + std::to_string(i);
+        text += "\n";
+    }
+    text +=
+        "%void = OpTypeVoid\n"
+        "%fn = OpTypeFunction %void\n"
+        "%float = OpTypeFloat 32\n"
+        "%ptr = OpTypePointer Private %float\n"
+        "%one = OpConstant %float 1\n";
+    for (uint32_t i = 0; i < variable_count; ++i) {
+        text += "%v" + std::to_string(i) + " = OpVariable %ptr Private\n";
+    }
+    text += "%main = OpFunction %void None %fn\n%entry = OpLabel\n";
+    for (uint32_t i = 0; i < variable_count; ++i) {
+        const std::string n = std::to_string(i);
+        text += "%x" + n + " = OpLoad %float %v" + n + "\n";
+        text += "%y" + n + " = OpFAdd %float %x" + n + " %one\n";
+        text += "OpStore %v" + n + " %y" + n + "\n";
+    }
+    text += "OpReturn\nOpFunctionEnd\n";
+    return text;
+}
+
+bool Assemble(const std::string &text, std::vector<uint32_t> &words) {
+    spv_context context = spvContextCreate(kEnv);
+    spv_binary binary = nullptr;
+    spv_diagnostic diagnostic = nullptr;
+    const bool assembled = spvTextToBinary(context, text.c_str(), text.size(), &binary, &diagnostic) == SPV_SUCCESS;
+    if (assembled) {
+        words.assign(binary->code, binary->code + binary->wordCount);
+    } else {
+        fprintf(stderr, "failed to assemble module: %s\n", diagnostic && diagnostic->error ? diagnostic->error : "?");
+    }
+    spvBinaryDestroy(binary);
+    spvDiagnosticDestroy(diagnostic);
+    spvContextDestroy(context);
+    return assembled;
+}
+
+bool Validate(spv_context context, const std::vector<uint32_t> &words) {
+    spv_const_binary_t binary{words.data(), words.size()};
+    spv_diagnostic diagnostic = nullptr;
+    spvtools::ValidatorOptions options;
+    const bool valid = spvValidateWithOptions(context, options, &binary, &diagnostic) == SPV_SUCCESS;
+    spvDiagnosticDestroy(diagnostic);
+    return valid;
+}
+
+std::unique_ptr<spvtools::Optimizer> MakeFlattenOptimizer() {
+    std::unique_ptr<spvtools::Optimizer> optimizer(new spvtools::Optimizer(kEnv));
+    optimizer->RegisterPass(spvtools::CreateFlattenDecorationPass());
+    return optimizer;
+}
+
+bool Flatten(spvtools::Optimizer &optimizer, const std::vector<uint32_t> &words) {
+    std::vector<uint32_t> flattened;
+    // Same options as PreprocessShaderBinary(), the module has been validated already
+    return optimizer.Run(words.data(), words.size(), &flattened, spvtools::ValidatorOptions(), true);
+}
+
+struct Result {
+    double ns_per_module;
+    bool ok;
+};
+
+// Runs work(module) on each of thread_count threads, work handles kModulesPerThread modules
+template <typename Work>
+Result Run(uint32_t thread_count, const std::vector<uint32_t> &words, const Work &work) {
+    std::atomic<bool> ok{true};
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&]() {
+            if (!work(words)) ok.store(false, std::memory_order_relaxed);
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    // Threads run in parallel, so this is the average latency of one module as seen by one thread
+    return {elapsed / kModulesPerThread, ok.load()};
+}
+
+bool Report(const char *name, const Result &per_module, const Result &per_thread) {
+    printf("    %-28s per module %10.0f ns  per thread %10.0f ns  (%.1f%% overhead)\n", name, per_module.ns_per_module,
+           per_thread.ns_per_module, 100.0 * (per_module.ns_per_module - per_thread.ns_per_module) / per_thread.ns_per_module);
+    if (!per_module.ok || !per_thread.ok) {
+        fprintf(stderr, "%s: a module failed\n", name);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const uint32_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    const uint32_t max_threads = (argc > 1) ? std::max(1, atoi(argv[1])) : std::min(8u, hardware_threads);
+
+    int result = 0;
+    for (const uint32_t variable_count : {4u, 64u, 1024u}) {
+        std::vector<uint32_t> words;
+        std::vector<uint32_t> grouped_words;
+        if (!Assemble(MakeModuleText(variable_count, false), words) ||
+            !Assemble(MakeModuleText(variable_count, true), grouped_words)) {
+            return 1;
+        }
+        printf("module of %zu words (%u variables)\n", words.size(), variable_count);
+
+        for (uint32_t threads = 1; threads <= max_threads; threads *= 2) {
+            printf("  %u thread(s)\n", threads);
+
+            const auto validate_per_module = Run(threads, words, [](const std::vector<uint32_t> &module) {
+                bool ok = true;
+                for (uint32_t i = 0; i < kModulesPerThread; ++i) {
+                    spv_context context = spvContextCreate(kEnv);
+                    ok &= Validate(context, module);
+                    spvContextDestroy(context);
+                }
+                return ok;
+            });
+            const auto validate_per_thread = Run(threads, words, [](const std::vector<uint32_t> &module) {
+                bool ok = true;
+                spv_context context = spvContextCreate(kEnv);
+                for (uint32_t i = 0; i < kModulesPerThread; ++i) {
+                    ok &= Validate(context, module);
+                }
+                spvContextDestroy(context);
+                return ok;
+            });
+            if (!Report("spvValidateWithOptions", validate_per_module, validate_per_thread)) result = 1;
+
+            const auto flatten_per_module = Run(threads, grouped_words, [](const std::vector<uint32_t> &module) {
+                bool ok = true;
+                for (uint32_t i = 0; i < kModulesPerThread; ++i) {
+                    ok &= Flatten(*MakeFlattenOptimizer(), module);
+                }
+                return ok;
+            });
+            const auto flatten_per_thread = Run(threads, grouped_words, [](const std::vector<uint32_t> &module) {
+                bool ok = true;
+                auto optimizer = MakeFlattenOptimizer();
+                for (uint32_t i = 0; i < kModulesPerThread; ++i) {
+                    ok &= Flatten(*optimizer, module);
+                }
+                return ok;
+            });
+            if (!Report("flatten decorations", flatten_per_module, flatten_per_thread)) result = 1;
+        }
+    }
+    return result;
+}
@@ -15,6 +15,37 @@
  */
 
 #include "layer_validation_tests.h"
+#include "debug_printf_format.h"
+
+void GpuLayerSettings::SetBool(const char *name, bool value) {
+    VkLayerSettingValueEXT setting = {};
+    strncpy(setting.name, name, sizeof(setting.name) - 1);
+    setting.type = VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT;
+    setting.data.valueBool = value ? VK_TRUE : VK_FALSE;
+    values_.push_back(setting);
+    strings_.emplace_back();
+}
+
+void GpuLayerSettings::SetString(const char *name, const char *value) {
+    VkLayerSettingValueEXT setting = {};
+    strncpy(setting.name, name, sizeof(setting.name) - 1);
+    setting.type = VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT;
+    values_.push_back(setting);
+    strings_.emplace_back(value);
+}
+
+void *GpuLayerSettings::pnext() {
+    if (values_.empty()) return nullptr;
+    for (size_t i = 0; i < values_.size(); ++i) {
+        if (values_[i].type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
+            values_[i].data.arrayString.pCharArray = strings_[i].c_str();
+            values_[i].data.arrayString.count = static_cast<uint32_t>(strings_[i].size());
+        }
+    }
+    settings_ = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr,
+                 static_cast<uint32_t>(values_.size()), values_.data()};
+    return &settings_;
+}
 
 bool VkGpuAssistedLayerTest::InitGpuAssistedFramework(bool request_descriptor_indexing) {
     VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
@@ -26,6 +57,7 @@ bool VkGpuAssistedLayerTest::InitGpuAssistedFramework(bool request_descriptor_in
     features.disabledValidationFeatureCount = 4;
     features.pEnabledValidationFeatures = enables;
     features.pDisabledValidationFeatures = disables;
+    features.pNext = gpu_settings_.pnext();
 
     if (request_descriptor_indexing) {
         return CheckDescriptorIndexingSupportAndInitFramework(this, m_instance_extension_names, m_device_extension_names, &features,
@@ -921,6 +953,213 @@ TEST_F(VkGpuAssistedLayerTest, DrawTimeShaderUniformBufferTooSmallNestedStruct)
                          "Descriptor size is 8 and highest byte accessed was 19");
 }
 
+// A compute pipeline whose dispatches write past the end of the 4 byte storage buffer bound to them, which GPU-AV reports as
+// "Descriptor size is 4 and highest byte accessed was 7"
+struct OOBComputePipeline {
+    VkBufferObj buffer;
+    OneOffDescriptorSet ds;
+    CreateComputePipelineHelper pipe;
+
+    OOBComputePipeline(VkLayerTest &test, VkDeviceObj *device)
+        : ds(device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}}), pipe(test) {
+        VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+        buffer.init_as_storage(*device, 4, reqs);
+        ds.WriteDescriptorBufferInfo(0, buffer.handle(), 0, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        ds.UpdateDescriptorSets();
+
+        char const *csSource =
+            "#version 450\n"
+            "layout(set=0, binding=0) buffer foo { int x; int y; } bar;\n"
+            "void main(){\n"
+            "   bar.y = bar.x;\n"
+            "}\n";
+        pipe.InitInfo();
+        pipe.cs_.reset(new VkShaderObj(&test, csSource, VK_SHADER_STAGE_COMPUTE_BIT));
+        pipe.InitState();
+        pipe.pipeline_layout_ = VkPipelineLayoutObj(device, {&ds.layout_});
+        pipe.CreateComputePipeline();
+    }
+
+    void Dispatch(VkCommandBuffer command_buffer) {
+        vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+        vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1, &ds.set_,
+                                  0, nullptr);
+        vk::CmdDispatch(command_buffer, 1, 1, 1);
+    }
+};
+
+TEST_F(VkGpuAssistedLayerTest, GpuInstrumentedShaderCache) {
+    TEST_DESCRIPTION(
+        "Create the same module twice so that the second is instrumented from the instrumented shader cache, and check that the "
+        "errors of each name their own module.");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    gpu_settings_.SetBool("gpuav_instrumented_shader_cache", true);
+    InitGpuAssistedFramework(false);
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    VkPhysicalDeviceFeatures features = {};  // Make sure robust buffer access is not enabled
+    ASSERT_NO_FATAL_FAILURE(InitState(&features));
+
+    for (int i = 0; i < 2; ++i) {
+        OOBComputePipeline oob(*this, m_device);
+        m_commandBuffer->begin();
+        oob.Dispatch(m_commandBuffer->handle());
+        m_commandBuffer->end();
+
+        // The error for "highest byte accessed was 7" names the module by its handle, which has to be the one of this
+        // pipeline's module for the cached copy too
+        std::stringstream module_string;
+        module_string << std::hex << std::showbase << "(" << CastToUint64(oob.pipe.cs_->handle()) << "). Shader Instruction Index";
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, module_string.str());
+        m_commandBuffer->QueueCommandBuffer();
+        m_errorMonitor->VerifyFound();
+    }
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuCompactOutput) {
+    TEST_DESCRIPTION("Errors are reported the same when the output of a command buffer is compacted on the GPU.");
+
+    gpu_settings_.SetBool("gpuav_compact_output", true);
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0, binding=0) buffer readonly foo { int x; int y; } bar;\n"
+        "void main(){\n"
+        "   x = vec4(bar.x, bar.y, 0, 1);\n"
+        "}\n";
+
+    ShaderBufferSizeTest(4,  // buffer size
+                         0,  // binding offset
+                         4,  // binding range
+                         VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, fsSource,
+                         "Descriptor size is 4 and highest byte accessed was 7");
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuCompactOutputOverflow) {
+    TEST_DESCRIPTION(
+        "Record more failing dispatches than the compacted output can hold, so that the rest of the blocks are read directly, "
+        "and check that each error is reported exactly once.");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    gpu_settings_.SetBool("gpuav_compact_output", true);
+    InitGpuAssistedFramework(false);
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    VkPhysicalDeviceFeatures features = {};  // Make sure robust buffer access is not enabled
+    ASSERT_NO_FATAL_FAILURE(InitState(&features));
+
+    // The compacted output holds 256 blocks of the largest record, and each of these records is about that large
+    const uint32_t kDispatches = 400;
+    OOBComputePipeline oob(*this, m_device);
+    m_commandBuffer->begin();
+    for (uint32_t i = 0; i < kDispatches; ++i) {
+        oob.Dispatch(m_commandBuffer->handle());
+    }
+    m_commandBuffer->end();
+
+    for (uint32_t i = 0; i < kDispatches; ++i) {
+        std::stringstream index_string;
+        index_string << std::hex << std::showbase << "Compute Index " << i << ". ";
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, index_string.str());
+    }
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuAsyncReadback) {
+    TEST_DESCRIPTION("Errors are reported by the time the queue is idle when the output is read asynchronously.");
+
+    gpu_settings_.SetBool("gpuav_async_readback", true);
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0, binding=0) buffer readonly foo { int x; int y; } bar;\n"
+        "void main(){\n"
+        "   x = vec4(bar.x, bar.y, 0, 1);\n"
+        "}\n";
+
+    ShaderBufferSizeTest(4,  // buffer size
+                         0,  // binding offset
+                         4,  // binding range
+                         VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, fsSource,
+                         "Descriptor size is 4 and highest byte accessed was 7");
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuAsyncReadbackResubmit) {
+    TEST_DESCRIPTION(
+        "With asynchronous readback, the output of a command buffer is read before the command buffer is submitted again, "
+        "and the output of the new submission is read when the queue is idle.");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    gpu_settings_.SetBool("gpuav_async_readback", true);
+    InitGpuAssistedFramework(false);
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    VkPhysicalDeviceFeatures features = {};  // Make sure robust buffer access is not enabled
+    ASSERT_NO_FATAL_FAILURE(InitState(&features));
+
+    OOBComputePipeline oob(*this, m_device);
+    auto begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    m_commandBuffer->begin(&begin_info);
+    oob.Dispatch(m_commandBuffer->handle());
+    m_commandBuffer->end();
+
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor size is 4 and highest byte accessed was 7");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor size is 4 and highest byte accessed was 7");
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuAsyncReadbackReset) {
+    TEST_DESCRIPTION(
+        "With asynchronous readback, the output of a command buffer whose fence the application waited for is read at the "
+        "latest when the command buffer is reset.");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    gpu_settings_.SetBool("gpuav_async_readback", true);
+    InitGpuAssistedFramework(false);
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    VkPhysicalDeviceFeatures features = {};  // Make sure robust buffer access is not enabled
+    ASSERT_NO_FATAL_FAILURE(InitState(&features, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    OOBComputePipeline oob(*this, m_device);
+    m_commandBuffer->begin();
+    oob.Dispatch(m_commandBuffer->handle());
+    m_commandBuffer->end();
+
+    vk_testing::Fence fence;
+    fence.init(*m_device, vk_testing::Fence::create_info());
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor size is 4 and highest byte accessed was 7");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, fence.handle());
+    // The layer's own fence for the readback is signaled after the application's, so the error may not be reported yet
+    vk::WaitForFences(m_device->device(), 1, &fence.handle(), VK_TRUE, UINT64_MAX);
+    m_commandBuffer->reset();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkGpuAssistedLayerTest, GpuBufferDeviceAddressOOB) {
     SetTargetApiVersion(VK_API_VERSION_1_2);
     bool supported = InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
@@ -2432,6 +2671,7 @@ void VkDebugPrintfTest::InitDebugPrintfFramework() {
     features.disabledValidationFeatureCount = 4;
     features.pEnabledValidationFeatures = enables;
     features.pDisabledValidationFeatures = disables;
+    features.pNext = gpu_settings_.pnext();
 
     InitFramework(m_errorMonitor, &features);
 }
@@ -2847,6 +3087,116 @@ TEST_F(VkDebugPrintfTest, MeshTaskShadersPrintf) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkDebugPrintfTest, GpuDebugPrintfFenceWait) {
+    TEST_DESCRIPTION("The output of debugPrintfEXT is reported by the time the application's wait for a fence returns.");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    m_device_extension_names.push_back(VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME);
+    InitDebugPrintfFramework();
+    if (!DeviceExtensionSupported(gpu(), nullptr, VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME)) {
+        printf("%s Extension %s not supported, skipping this pass. \n", kSkipPrefix,
+               VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME);
+        return;
+    }
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted printf test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    char const *csSource =
+        "#version 450\n"
+        "#extension GL_EXT_debug_printf : enable\n"
+        "void main() {\n"
+        "    debugPrintfEXT(\"fence value %d\", 42);\n"
+        "}\n";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.cs_.reset(new VkShaderObj(this, csSource, VK_SHADER_STAGE_COMPUTE_BIT));
+    pipe.InitState();
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    vk_testing::Fence fence;
+    fence.init(*m_device, vk_testing::Fence::create_info());
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "fence value 42");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, fence.handle());
+    vk::WaitForFences(m_device->device(), 1, &fence.handle(), VK_TRUE, UINT64_MAX);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkDebugPrintfTest, GpuDebugPrintfTraceFile) {
+    TEST_DESCRIPTION("Write the output of debugPrintfEXT to a trace file and decode it the way debug_printf_decode does.");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    const char *trace_path = "debug_printf_trace_test.bin";
+    gpu_settings_.SetString("printf_trace_file", trace_path);
+    m_device_extension_names.push_back(VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME);
+    InitDebugPrintfFramework();
+    if (!DeviceExtensionSupported(gpu(), nullptr, VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME)) {
+        printf("%s Extension %s not supported, skipping this pass. \n", kSkipPrefix,
+               VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME);
+        return;
+    }
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted printf test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    char const *csSource =
+        "#version 450\n"
+        "#extension GL_EXT_debug_printf : enable\n"
+        "void main() {\n"
+        "    debugPrintfEXT(\"trace value %d\", 42);\n"
+        "}\n";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.cs_.reset(new VkShaderObj(this, csSource, VK_SHADER_STAGE_COMPUTE_BIT));
+    pipe.InitState();
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    // The output goes to the trace file instead of the debug stream
+    m_errorMonitor->ExpectSuccess(kErrorBit | kInformationBit);
+    m_commandBuffer->QueueCommandBuffer();
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyNotFound();
+
+    // Destroying the device closes the trace file
+    ShutdownFramework();
+
+    FILE *trace_file = fopen(trace_path, "rb");
+    ASSERT_TRUE(trace_file != nullptr);
+    std::vector<std::string> lines;
+    std::string error;
+    const bool decoded = DPFDecodeTrace(trace_file, [&lines](const std::string &line) { lines.push_back(line); }, error);
+    fclose(trace_file);
+    remove(trace_path);
+
+    ASSERT_TRUE(decoded) << error;
+    ASSERT_EQ(1u, lines.size());
+    ASSERT_NE(std::string::npos, lines[0].find("dispatch 0"));
+    ASSERT_NE(std::string::npos, lines[0].find("trace value 42"));
+}
+
 TEST_F(VkGpuAssistedLayerTest, DrawingWithUnboundUnusedSet) {
     TEST_DESCRIPTION(
         "Test issuing draw command with pipeline layout that has 2 descriptor sets with first descriptor set begin unused and "
@@ -106,6 +106,25 @@ class DuplicateMsgLimit {
     VkLayerSettingsEXT limit_setting;
 };
 
+class SlabHandleWrapping {
+  public:
+    SlabHandleWrapping() {
+        enable_value.valueBool = VK_TRUE;
+
+        strncpy(enable_setting_val.name, "slab_handle_wrapping", sizeof(enable_setting_val.name));
+        enable_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT;
+        enable_setting_val.data = enable_value;
+        enable_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                          &enable_setting_val};
+    }
+    VkLayerSettingsEXT *pnext{&enable_setting};
+
+  private:
+    VkLayerSettingValueDataEXT enable_value{};
+    VkLayerSettingValueEXT enable_setting_val;
+    VkLayerSettingsEXT enable_setting;
+};
+
 TEST_F(VkLayerTest, VersionCheckPromotedAPIs) {
     TEST_DESCRIPTION("Validate that promoted APIs are not valid in old versions.");
     SetTargetApiVersion(VK_API_VERSION_1_0);
@@ -422,6 +441,47 @@ TEST_F(VkLayerTest, DuplicateMessageLimit) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkLayerTest, SlabHandleWrappingStaleHandle) {
+    TEST_DESCRIPTION("Use a destroyed handle after its slab record was reused by a new object");
+
+    auto slab_setting = SlabHandleWrapping();
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, slab_setting.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    const auto buffer_ci = VkBufferObj::create_info(256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkBuffer stale = VK_NULL_HANDLE;
+    vk::CreateBuffer(device(), &buffer_ci, nullptr, &stale);
+    vk::DestroyBuffer(device(), stale, nullptr);
+
+    // Released records are recycled in FIFO order once enough of them are waiting, so this reuses the stale one
+    m_errorMonitor->ExpectSuccess();
+    std::vector<VkBuffer> buffers(4096);
+    for (auto &buffer : buffers) {
+        vk::CreateBuffer(device(), &buffer_ci, nullptr, &buffer);
+        vk::DestroyBuffer(device(), buffer, nullptr);
+    }
+    for (auto &buffer : buffers) {
+        vk::CreateBuffer(device(), &buffer_ci, nullptr, &buffer);
+    }
+    m_errorMonitor->VerifyNotFound();
+
+    VkMemoryRequirements mem_reqs;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkGetBufferMemoryRequirements-buffer-parameter");
+    vk::GetBufferMemoryRequirements(device(), stale, &mem_reqs);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkGetBufferMemoryRequirements-buffer-parameter");
+    vk::GetBufferMemoryRequirements(device(), CastFromUint64<VkBuffer>(0x1234567800000003ull), &mem_reqs);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess();
+    for (auto buffer : buffers) {
+        vk::GetBufferMemoryRequirements(device(), buffer, &mem_reqs);
+        vk::DestroyBuffer(device(), buffer, nullptr);
+    }
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(VkLayerTest, MessageIdFilterString) {
     TEST_DESCRIPTION("Validate that message id string filtering is working");
 
@@ -2147,6 +2207,107 @@ TEST_F(VkLayerTest, ValidationCacheTestBadMerge) {
     fpDestroyValidationCache(m_device->device(), validationCache, nullptr);
 }
 
+TEST_F(VkLayerTest, ShaderCacheFilesRoundTrip) {
+    TEST_DESCRIPTION("Shader modules are validated the same with cache files that are missing, written by a device, or damaged");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const std::string good_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd)";
+    const std::string bad_source = R"(
+               OpCapability Shader
+               OpCapability ImageRect
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd)";
+    std::vector<uint32_t> good_spv;
+    std::vector<uint32_t> bad_spv;
+    ASMtoSPV(SPV_ENV_VULKAN_1_0, 0, good_source.c_str(), good_spv);
+    ASMtoSPV(SPV_ENV_VULKAN_1_0, 0, bad_source.c_str(), bad_spv);
+
+    // The caches are loaded when a device is created and written back when it is destroyed
+    auto validate_on_new_device = [&]() {
+        float priorities[] = {1.0f};
+        VkDeviceQueueCreateInfo queue_info = LvlInitStruct<VkDeviceQueueCreateInfo>();
+        queue_info.queueFamilyIndex = 0;
+        queue_info.queueCount = 1;
+        queue_info.pQueuePriorities = &priorities[0];
+        VkDeviceCreateInfo device_create_info = LvlInitStruct<VkDeviceCreateInfo>();
+        device_create_info.queueCreateInfoCount = 1;
+        device_create_info.pQueueCreateInfos = &queue_info;
+        VkDevice test_device = VK_NULL_HANDLE;
+        ASSERT_VK_SUCCESS(vk::CreateDevice(gpu(), &device_create_info, nullptr, &test_device));
+
+        auto module_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+        VkShaderModule module = VK_NULL_HANDLE;
+        // Twice each, so the second module of each pair is a cache hit
+        for (int i = 0; i < 2; ++i) {
+            m_errorMonitor->ExpectSuccess();
+            module_ci.codeSize = good_spv.size() * sizeof(uint32_t);
+            module_ci.pCode = good_spv.data();
+            vk::CreateShaderModule(test_device, &module_ci, nullptr, &module);
+            m_errorMonitor->VerifyNotFound();
+            vk::DestroyShaderModule(test_device, module, nullptr);
+
+            m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Capability ImageRect is not allowed by Vulkan");
+            module_ci.codeSize = bad_spv.size() * sizeof(uint32_t);
+            module_ci.pCode = bad_spv.data();
+            module = VK_NULL_HANDLE;
+            vk::CreateShaderModule(test_device, &module_ci, nullptr, &module);
+            m_errorMonitor->VerifyFound();
+            if (module != VK_NULL_HANDLE) vk::DestroyShaderModule(test_device, module, nullptr);
+        }
+
+        vk::DestroyDevice(test_device, nullptr);
+    };
+
+    const std::string cache_paths[] = {GetCacheFilePath("shader_validation_cache"),
+                                       GetCacheFilePath("shader_static_data_cache")};
+
+    // Files that are not cache files at all
+    const char garbage[] = "not a shader cache file";
+    for (const auto &path : cache_paths) {
+        ASSERT_TRUE(ReplaceCacheFile(path, garbage, sizeof(garbage)));
+    }
+    validate_on_new_device();
+
+    // Files written by the previous device
+    validate_on_new_device();
+
+    // Files cut off in the middle of their entries
+    for (const auto &path : cache_paths) {
+        std::vector<char> contents;
+        FILE *cache_file = fopen(path.c_str(), "rb");
+        ASSERT_TRUE(cache_file != nullptr);
+        char buffer[4096];
+        size_t read_count;
+        while ((read_count = fread(buffer, 1, sizeof(buffer), cache_file)) > 0) {
+            contents.insert(contents.end(), buffer, buffer + read_count);
+        }
+        fclose(cache_file);
+        ASSERT_TRUE(ReplaceCacheFile(path, contents.data(), contents.size() / 2));
+    }
+    validate_on_new_device();
+
+    // And the files the previous device rebuilt
+    validate_on_new_device();
+}
+
 TEST_F(VkLayerTest, InvalidQueueFamilyIndex) {
     // Miscellaneous queueFamilyIndex validation tests
     bool get_physical_device_properties2 = InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
@@ -16940,3 +16940,209 @@ TEST_F(VkLayerTest, InvalidDepthStencilStateForReadOnlyLayout) {
     pipe.CreateGraphicsPipeline(true, false);
     m_errorMonitor->VerifyFound();
 }
+
+class ValidationWorkerThreads {
+  public:
+    explicit ValidationWorkerThreads(uint32_t count) {
+        count_value.value32 = count;
+
+        strncpy(count_setting_val.name, "validation_worker_threads", sizeof(count_setting_val.name));
+        count_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT;
+        count_setting_val.data = count_value;
+        count_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                         &count_setting_val};
+    }
+    VkLayerSettingsEXT *pnext{&count_setting};
+
+  private:
+    VkLayerSettingValueDataEXT count_value{};
+    VkLayerSettingValueEXT count_setting_val;
+    VkLayerSettingsEXT count_setting;
+};
+
+TEST_F(VkLayerTest, ValidationWorkerThreadsPipelines) {
+    TEST_DESCRIPTION("Create pipelines and shader stages validated on worker threads, errors must be reported as if serial");
+
+    ValidationWorkerThreads worker_threads(4);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, worker_threads.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    const uint32_t x_size_limit = m_device->props.limits.maxComputeWorkGroupSize[0];
+    std::string bad_cs_source = R"(
+        OpCapability Shader
+        OpMemoryModel Logical GLSL450
+        OpEntryPoint GLCompute %main "main"
+        OpExecutionMode %main LocalSize )";
+    bad_cs_source.append(std::to_string(x_size_limit + 1) + " 1 1");
+    bad_cs_source.append(R"(
+        %void = OpTypeVoid
+           %3 = OpTypeFunction %void
+        %main = OpFunction %void None %3
+           %5 = OpLabel
+                OpReturn
+                OpFunctionEnd)");
+    char const *good_cs_source = R"glsl(
+        #version 450
+        layout(local_size_x = 1) in;
+        void main() {}
+    )glsl";
+
+    VkShaderObj bad_cs(this, bad_cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM);
+    VkShaderObj good_cs(this, good_cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    const VkPipelineLayoutObj pipeline_layout(m_device, {});
+
+    // Enough pipelines that every worker gets some, with the bad ones spread out
+    const uint32_t pipeline_count = 16;
+    std::vector<VkComputePipelineCreateInfo> create_infos(pipeline_count, LvlInitStruct<VkComputePipelineCreateInfo>());
+    for (uint32_t i = 0; i < pipeline_count; ++i) {
+        create_infos[i].stage = good_cs.GetStageCreateInfo();
+        create_infos[i].layout = pipeline_layout.handle();
+    }
+    std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+
+    m_errorMonitor->ExpectSuccess();
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyNotFound();
+    for (auto pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+
+    create_infos[3].stage = bad_cs.GetStageCreateInfo();
+    create_infos[11].stage = bad_cs.GetStageCreateInfo();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-RuntimeSpirv-x-06429");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-RuntimeSpirv-x-06429");
+    m_errorMonitor->SetAllowedFailureMsg("VUID-RuntimeSpirv-x-06432");
+    std::fill(pipelines.begin(), pipelines.end(), VK_NULL_HANDLE);
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyFound();
+    for (auto pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+
+    // The stages of a graphics pipeline are validated in parallel too
+    char const *vs_source = R"glsl(
+        #version 450
+        layout(push_constant, std430) uniform foo { float x; } consts;
+        void main(){
+           gl_Position = vec4(consts.x);
+        }
+    )glsl";
+    VkShaderObj vs(this, vs_source, VK_SHADER_STAGE_VERTEX_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), pipe.fs_->GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {});
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkGraphicsPipelineCreateInfo-layout-00756");
+    pipe.CreateGraphicsPipeline();
+    m_errorMonitor->VerifyFound();
+}
+
+class DeferredShaderValidation {
+  public:
+    DeferredShaderValidation() {
+        enable_value.valueBool = VK_TRUE;
+
+        strncpy(enable_setting_val.name, "deferred_shader_validation", sizeof(enable_setting_val.name));
+        enable_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT;
+        enable_setting_val.data = enable_value;
+        enable_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                          &enable_setting_val};
+    }
+    VkLayerSettingsEXT *pnext{&enable_setting};
+
+  private:
+    VkLayerSettingValueDataEXT enable_value{};
+    VkLayerSettingValueEXT enable_setting_val;
+    VkLayerSettingsEXT enable_setting;
+};
+
+TEST_F(VkLayerTest, DeferredShaderValidation) {
+    TEST_DESCRIPTION("SPIR-V errors found by deferred shader validation are reported by the time a pipeline uses the module");
+
+    DeferredShaderValidation deferred;
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, deferred.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Passes the structural check, so its validation is deferred
+    const std::string bad_capability_source = R"(
+               OpCapability Shader
+               OpCapability ImageRect
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd)";
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Capability ImageRect is not allowed by Vulkan");
+    m_errorMonitor->SetAllowedFailureMsg("VUID-VkShaderModuleCreateInfo-pCode-01091");
+    {
+        CreateComputePipelineHelper pipe(*this);
+        pipe.InitInfo();
+        pipe.cs_.reset(new VkShaderObj(this, bad_capability_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0,
+                                       SPV_SOURCE_ASM));
+        pipe.InitState();
+        pipe.CreateComputePipeline();
+    }
+    m_errorMonitor->VerifyFound();
+
+    // The validation works on its own copy of the code, so the module and its code can go away while it is pending. When
+    // its error is reported depends on the workers, so it is only allowed here.
+    m_errorMonitor->SetAllowedFailureMsg("Capability ImageRect is not allowed by Vulkan");
+    {
+        std::vector<uint32_t> spv;
+        ASMtoSPV(SPV_ENV_VULKAN_1_0, 0, bad_capability_source.c_str(), spv);
+        auto module_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+        module_ci.codeSize = spv.size() * sizeof(uint32_t);
+        module_ci.pCode = spv.data();
+        VkShaderModule module = VK_NULL_HANDLE;
+        vk::CreateShaderModule(device(), &module_ci, nullptr, &module);
+        vk::DestroyShaderModule(device(), module, nullptr);
+    }
+}
+
+TEST_F(VkLayerTest, DeferredShaderValidationMalformedModule) {
+    TEST_DESCRIPTION("Modules whose instructions don't fit the code are validated right away even with deferral enabled");
+
+    DeferredShaderValidation deferred;
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, deferred.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    std::vector<uint32_t> spv;
+    ASMtoSPV(SPV_ENV_VULKAN_1_0, 0, R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd)", spv);
+
+    // An instruction with a word count of zero, which would never advance a walk over the module
+    spv.push_back(0);
+    auto module_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+    module_ci.codeSize = spv.size() * sizeof(uint32_t);
+    module_ci.pCode = spv.data();
+    VkShaderModule module = VK_NULL_HANDLE;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, kVUID_Core_Shader_InconsistentSpirv);
+    vk::CreateShaderModule(device(), &module_ci, nullptr, &module);
+    m_errorMonitor->VerifyFound();
+    if (module != VK_NULL_HANDLE) vk::DestroyShaderModule(device(), module, nullptr);
+
+    // Running past the end of the code
+    spv.back() = 4u << 16;  // OpNop
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, kVUID_Core_Shader_InconsistentSpirv);
+    module = VK_NULL_HANDLE;
+    vk::CreateShaderModule(device(), &module_ci, nullptr, &module);
+    m_errorMonitor->VerifyFound();
+    if (module != VK_NULL_HANDLE) vk::DestroyShaderModule(device(), module, nullptr);
+}
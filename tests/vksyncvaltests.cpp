@@ -4156,3 +4156,296 @@ TEST_F(VkSyncValTest, TestCopyingToCompressedImage) {
         m_commandBuffer->end();
     }
 }
+
+TEST_F(VkSyncValTest, SyncQSBufferCopyHazards) {
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    VkCommandBufferObj cb_a(m_device, m_commandPool);
+    VkCommandBufferObj cb_b(m_device, m_commandPool);
+    cb_a.begin();
+    vk::CmdCopyBuffer(cb_a.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_a.end();
+    cb_b.begin();
+    vk::CmdCopyBuffer(cb_b.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_b.end();
+
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &cb_a.handle();
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+
+    // Both copies write buffer_b with nothing ordering them
+    submit_info.pCommandBuffers = &cb_b.handle();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_WRITE");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    // Waiting for the queue completes the first copy
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyNotFound();
+}
+
+// A queue other than first, preferring one of the same family so that no queue family ownership transfers are needed
+static vk_testing::Queue *GetOtherQueue(VkDeviceObj *device, vk_testing::Queue *first) {
+    for (const auto &queues : {device->graphics_queues(), device->compute_queues(), device->dma_queues()}) {
+        for (auto *queue : queues) {
+            if ((queue != first) && (queue->get_family_index() == first->get_family_index())) return queue;
+        }
+    }
+    for (const auto &queues : {device->graphics_queues(), device->compute_queues(), device->dma_queues()}) {
+        for (auto *queue : queues) {
+            if (queue != first) return queue;
+        }
+    }
+    return nullptr;
+}
+
+TEST_F(VkSyncValTest, SyncQSCrossQueueHazards) {
+    TEST_DESCRIPTION("Copies submitted to two queues race unless a semaphore or a host wait orders them");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    vk_testing::Queue *q0 = m_device->graphics_queues()[0];
+    vk_testing::Queue *q1 = GetOtherQueue(m_device, q0);
+    if (q1 == nullptr) {
+        printf("%s Test requires 2 queues, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    VkCommandPoolObj pool0(m_device, q0->get_family_index());
+    VkCommandBufferObj cb0(m_device, &pool0);
+    cb0.begin();
+    vk::CmdCopyBuffer(cb0.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb0.end();
+
+    VkCommandPoolObj pool1(m_device, q1->get_family_index());
+    VkCommandBufferObj cb1(m_device, &pool1);
+    cb1.begin();
+    vk::CmdCopyBuffer(cb1.handle(), buffer_c.handle(), buffer_b.handle(), 1, &region);
+    cb1.end();
+
+    auto submit_info0 = LvlInitStruct<VkSubmitInfo>();
+    submit_info0.commandBufferCount = 1;
+    submit_info0.pCommandBuffers = &cb0.handle();
+    auto submit_info1 = LvlInitStruct<VkSubmitInfo>();
+    submit_info1.commandBufferCount = 1;
+    submit_info1.pCommandBuffers = &cb1.handle();
+
+    // Both copies write buffer_b, and nothing orders the second queue after the first
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(q0->handle(), 1, &submit_info0, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-RACING-WRITE");
+    vk::QueueSubmit(q1->handle(), 1, &submit_info1, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    vk::DeviceWaitIdle(m_device->device());
+
+    // A semaphore signaled by the first submission and waited on by the second orders the copies
+    vk_testing::Semaphore semaphore;
+    semaphore.init(*m_device, vk_testing::Semaphore::create_info(0));
+    const VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    submit_info0.signalSemaphoreCount = 1;
+    submit_info0.pSignalSemaphores = &semaphore.handle();
+    submit_info1.waitSemaphoreCount = 1;
+    submit_info1.pWaitSemaphores = &semaphore.handle();
+    submit_info1.pWaitDstStageMask = &wait_stage;
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(q0->handle(), 1, &submit_info0, VK_NULL_HANDLE);
+    vk::QueueSubmit(q1->handle(), 1, &submit_info1, VK_NULL_HANDLE);
+    vk::DeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyNotFound();
+
+    // As does waiting for the fence of the first submission
+    vk_testing::Fence fence;
+    fence.init(*m_device, vk_testing::Fence::create_info());
+    submit_info0.signalSemaphoreCount = 0;
+    submit_info1.waitSemaphoreCount = 0;
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(q0->handle(), 1, &submit_info0, fence.handle());
+    vk::WaitForFences(m_device->device(), 1, &fence.handle(), VK_TRUE, UINT64_MAX);
+    vk::QueueSubmit(q1->handle(), 1, &submit_info1, VK_NULL_HANDLE);
+    vk::DeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyNotFound();
+
+    // Fence waits order the work of any queue after the waited submission
+    vk::ResetFences(m_device->device(), 1, &fence.handle());
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(q1->handle(), 1, &submit_info1, fence.handle());
+    vk::WaitForFences(m_device->device(), 1, &fence.handle(), VK_TRUE, UINT64_MAX);
+    vk::QueueSubmit(q0->handle(), 1, &submit_info0, VK_NULL_HANDLE);
+    vk::DeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkSyncValTest, SyncQSTimelineSemaphoreSubmit2) {
+    TEST_DESCRIPTION("Copies submitted with vkQueueSubmit2 to two queues are ordered by a timeline semaphore");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    if (DeviceValidationVersion() < VK_API_VERSION_1_2) {
+        printf("%s Test requires Vulkan 1.2+, skipping test\n", kSkipPrefix);
+        return;
+    }
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+    } else {
+        printf("%s Synchronization2 not supported, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    auto timeline_semaphore_features = LvlInitStruct<VkPhysicalDeviceTimelineSemaphoreFeatures>();
+    auto sync2_features = LvlInitStruct<VkPhysicalDeviceSynchronization2FeaturesKHR>(&timeline_semaphore_features);
+    auto features2 = LvlInitStruct<VkPhysicalDeviceFeatures2>(&sync2_features);
+    vk::GetPhysicalDeviceFeatures2(gpu(), &features2);
+    if (!sync2_features.synchronization2 || !timeline_semaphore_features.timelineSemaphore) {
+        printf("%s Synchronization2 and timeline semaphores are required, skipping test\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+    auto fpQueueSubmit2KHR = (PFN_vkQueueSubmit2KHR)vk::GetDeviceProcAddr(m_device->device(), "vkQueueSubmit2KHR");
+    ASSERT_TRUE(fpQueueSubmit2KHR != nullptr);
+
+    vk_testing::Queue *q0 = m_device->graphics_queues()[0];
+    vk_testing::Queue *q1 = GetOtherQueue(m_device, q0);
+    if (q1 == nullptr) {
+        printf("%s Test requires 2 queues, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    // The second copy reads what the first wrote
+    VkCommandPoolObj pool0(m_device, q0->get_family_index());
+    VkCommandBufferObj cb0(m_device, &pool0);
+    cb0.begin();
+    vk::CmdCopyBuffer(cb0.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb0.end();
+
+    VkCommandPoolObj pool1(m_device, q1->get_family_index());
+    VkCommandBufferObj cb1(m_device, &pool1);
+    cb1.begin();
+    vk::CmdCopyBuffer(cb1.handle(), buffer_b.handle(), buffer_c.handle(), 1, &region);
+    cb1.end();
+
+    auto semaphore_type_create_info = LvlInitStruct<VkSemaphoreTypeCreateInfo>();
+    semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    auto semaphore_create_info = LvlInitStruct<VkSemaphoreCreateInfo>(&semaphore_type_create_info);
+    vk_testing::Semaphore semaphore;
+    semaphore.init(*m_device, semaphore_create_info);
+
+    auto cb_info0 = LvlInitStruct<VkCommandBufferSubmitInfoKHR>();
+    cb_info0.commandBuffer = cb0.handle();
+    auto signal_info = LvlInitStruct<VkSemaphoreSubmitInfoKHR>();
+    signal_info.semaphore = semaphore.handle();
+    signal_info.value = 1;
+    signal_info.stageMask = VK_PIPELINE_STAGE_2_COPY_BIT_KHR;
+    auto submit_info0 = LvlInitStruct<VkSubmitInfo2KHR>();
+    submit_info0.commandBufferInfoCount = 1;
+    submit_info0.pCommandBufferInfos = &cb_info0;
+
+    auto cb_info1 = LvlInitStruct<VkCommandBufferSubmitInfoKHR>();
+    cb_info1.commandBuffer = cb1.handle();
+    auto wait_info = LvlInitStruct<VkSemaphoreSubmitInfoKHR>();
+    wait_info.semaphore = semaphore.handle();
+    wait_info.value = 1;
+    wait_info.stageMask = VK_PIPELINE_STAGE_2_COPY_BIT_KHR;
+    auto submit_info1 = LvlInitStruct<VkSubmitInfo2KHR>();
+    submit_info1.commandBufferInfoCount = 1;
+    submit_info1.pCommandBufferInfos = &cb_info1;
+
+    // Without the semaphore the read races the write
+    m_errorMonitor->ExpectSuccess();
+    fpQueueSubmit2KHR(q0->handle(), 1, &submit_info0, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-RACING-WRITE");
+    fpQueueSubmit2KHR(q1->handle(), 1, &submit_info1, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    vk::DeviceWaitIdle(m_device->device());
+
+    submit_info0.signalSemaphoreInfoCount = 1;
+    submit_info0.pSignalSemaphoreInfos = &signal_info;
+    submit_info1.waitSemaphoreInfoCount = 1;
+    submit_info1.pWaitSemaphoreInfos = &wait_info;
+    m_errorMonitor->ExpectSuccess();
+    fpQueueSubmit2KHR(q0->handle(), 1, &submit_info0, VK_NULL_HANDLE);
+    fpQueueSubmit2KHR(q1->handle(), 1, &submit_info1, VK_NULL_HANDLE);
+    vk::DeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkSyncValTest, SyncCommandPoolReuse) {
+    TEST_DESCRIPTION("Command buffers allocated after others were freed from the same pool start from a clean recording");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    // More command buffers than the layer keeps around for a pool, so some are reused and some are released
+    const uint32_t cb_count = 12;
+    for (uint32_t pool_index = 0; pool_index < 2; ++pool_index) {
+        VkCommandPoolObj pool(m_device, m_device->graphics_queue_node_index_);
+        for (uint32_t round = 0; round < 3; ++round) {
+            std::vector<std::unique_ptr<VkCommandBufferObj>> cbs;
+            for (uint32_t i = 0; i < cb_count; ++i) {
+                cbs.emplace_back(new VkCommandBufferObj(m_device, &pool));
+                auto &cb = *cbs.back();
+
+                // Nothing recorded to the freed command buffers must show up here
+                m_errorMonitor->ExpectSuccess();
+                cb.begin();
+                vk::CmdCopyBuffer(cb.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+                m_errorMonitor->VerifyNotFound();
+
+                // While hazards within the recording still do
+                m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_WRITE");
+                vk::CmdCopyBuffer(cb.handle(), buffer_c.handle(), buffer_b.handle(), 1, &region);
+                m_errorMonitor->VerifyFound();
+                cb.end();
+            }
+
+            // The submitted recording is still referenced by the queue when its command buffer is freed
+            auto submit_info = LvlInitStruct<VkSubmitInfo>();
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers = &cbs.front()->handle();
+            m_errorMonitor->ExpectSuccess();
+            vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+            vk::QueueWaitIdle(m_device->m_queue);
+            m_errorMonitor->VerifyNotFound();
+        }
+    }
+}
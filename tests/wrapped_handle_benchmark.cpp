@@ -0,0 +1,144 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the per-call cost of vl_wrapped_handle_map::Unwrap() in the default hashed mode and in slab mode
+// (VK_LAYER_SLAB_HANDLE_WRAPPING). Reader threads unwrap random live IDs while an optional writer thread keeps wrapping
+// and releasing handles, as object creation and destruction do. Each run also checks that released IDs unwrap to 0.
+//
+// Usage: wrapped_handle_benchmark [max reader threads]
+
+#include "vk_layer_data.h"
+#include "vk_layer_utils.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+namespace {
+
+const uint64_t kLiveHandles = 65536;
+const uint64_t kChurnHandles = 4096;
+const uint64_t kUnwrapsPerThread = 4000000;
+
+// Same as HashedUint64 in the generated chassis.h, which can't be included here
+struct HashedUint64 {
+    static const int HASHED_UINT64_SHIFT = 40;
+    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
+
+    static uint64_t hash(uint64_t id) {
+        uint64_t h = (uint64_t)layer_data::hash<uint64_t>()(id);
+        id |= h << HASHED_UINT64_SHIFT;
+        return id;
+    }
+};
+
+using WrappedHandleMap = vl_wrapped_handle_map<4, HashedUint64>;
+
+uint64_t MakeHandle(uint64_t index) { return (index + 1) * 0x1000; }  // Driver handle-like values
+
+struct Result {
+    double ns_per_unwrap;
+    bool valid;
+};
+
+Result Run(bool slab_mode, uint32_t reader_count, bool churn) {
+    WrappedHandleMap map;
+    map.set_slab_mode(slab_mode);
+    std::vector<uint64_t> ids(kLiveHandles);
+    for (uint64_t i = 0; i < kLiveHandles; ++i) {
+        ids[i] = map.Wrap(MakeHandle(i));
+    }
+
+    bool valid = true;
+    // Released IDs must not unwrap to anything, including after their records were reused
+    std::vector<uint64_t> released(kChurnHandles);
+    for (auto &id : released) {
+        id = map.Wrap(MakeHandle(kLiveHandles));
+        map.erase(id);
+    }
+    for (uint64_t i = 0; i < kChurnHandles; ++i) {
+        map.erase(map.Wrap(MakeHandle(kLiveHandles)));
+    }
+    for (const auto id : released) {
+        valid = valid && map.Unwrap(id) == 0 && map.find(id) == map.end();
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread writer;
+    if (churn) {
+        writer = std::thread([&]() {
+            std::vector<uint64_t> churn_ids;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (uint64_t i = 0; i < kChurnHandles; ++i) {
+                    churn_ids.push_back(map.Wrap(MakeHandle(kLiveHandles + i)));
+                }
+                for (const auto id : churn_ids) {
+                    map.erase(id);
+                }
+                churn_ids.clear();
+            }
+        });
+    }
+
+    std::atomic<bool> lookups_valid{true};
+    std::vector<std::thread> readers;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < reader_count; ++t) {
+        readers.emplace_back([&map, &ids, &lookups_valid, t]() {
+            std::mt19937 rng(t + 1);
+            uint64_t mismatches = 0;
+            for (uint64_t i = 0; i < kUnwrapsPerThread; ++i) {
+                const uint64_t index = rng() % kLiveHandles;
+                mismatches += (map.Unwrap(ids[index]) != MakeHandle(index)) ? 1 : 0;
+            }
+            if (mismatches) {
+                lookups_valid.store(false, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto &reader : readers) reader.join();
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    stop.store(true);
+    if (writer.joinable()) writer.join();
+
+    // Each reader thread runs in parallel, so this is the average latency of an unwrap as seen by one thread
+    return {elapsed / kUnwrapsPerThread, valid && lookups_valid.load()};
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const uint32_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    const uint32_t max_readers = (argc > 1) ? std::max(1, atoi(argv[1])) : std::min(16u, hardware_threads);
+
+    int result = 0;
+    for (uint32_t readers = 1; readers <= max_readers; readers *= 2) {
+        for (int churn = 0; churn < 2; ++churn) {
+            const Result hashed = Run(false, readers, churn != 0);
+            const Result slab = Run(true, readers, churn != 0);
+            printf("%2u reader thread(s)%-44s hashed %6.1f ns  slab %6.1f ns\n", readers,
+                   churn ? ", one writer wrapping and releasing handles" : "", hashed.ns_per_unwrap, slab.ns_per_unwrap);
+            if (!hashed.valid || !slab.valid) {
+                fprintf(stderr, "an unwrap returned the wrong handle\n");
+                result = 1;
+            }
+        }
+    }
+    return result;
+}